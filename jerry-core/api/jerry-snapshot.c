@@ -22,6 +22,7 @@
 #include "jcontext.h"
 #include "jerryscript.h"
 #include "jerry-snapshot.h"
+#include "jrt-tracepoints.h"
 #include "js-parser.h"
 #include "lit-char-helpers.h"
 #include "re-compiler.h"
@@ -157,53 +158,19 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
   if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-    /* Regular expression. */
-    if (globals_p->snapshot_buffer_write_offset + sizeof (ecma_compiled_code_t) > snapshot_buffer_size)
-    {
-      globals_p->snapshot_error = jerry_create_error (JERRY_ERROR_RANGE, error_buffer_too_small_p);
-      return 0;
-    }
-
-    globals_p->snapshot_buffer_write_offset += sizeof (ecma_compiled_code_t);
-
-    ecma_value_t pattern = ((re_compiled_code_t *) compiled_code_p)->pattern;
-    ecma_string_t *pattern_string_p = ecma_get_string_from_value (pattern);
-
-    ecma_length_t pattern_size = 0;
-
-    ECMA_STRING_TO_UTF8_STRING (pattern_string_p, buffer_p, buffer_size);
-
-    pattern_size = buffer_size;
-
+    /* Regular expression: the compiled byte code is saved, so it is not compiled
+     * again when the snapshot is loaded. The pattern is stored in the literal table. */
     if (!snapshot_write_to_buffer_by_offset (snapshot_buffer_p,
                                              snapshot_buffer_size,
                                              &globals_p->snapshot_buffer_write_offset,
-                                             buffer_p,
-                                             buffer_size))
+                                             compiled_code_p,
+                                             ecma_compiled_code_get_size (compiled_code_p)))
     {
       globals_p->snapshot_error = jerry_create_error (JERRY_ERROR_RANGE, error_buffer_too_small_p);
-      /* cannot return inside ECMA_FINALIZE_UTF8_STRING */
-    }
-
-    ECMA_FINALIZE_UTF8_STRING (buffer_p, buffer_size);
-
-    if (!ecma_is_value_empty (globals_p->snapshot_error))
-    {
       return 0;
     }
 
     globals_p->regex_found = true;
-    globals_p->snapshot_buffer_write_offset = JERRY_ALIGNUP (globals_p->snapshot_buffer_write_offset,
-                                                             JMEM_ALIGNMENT);
-
-    /* Regexp character size is stored in refs. */
-    copied_code_p->refs = (uint16_t) pattern_size;
-
-    pattern_size += (ecma_length_t) sizeof (ecma_compiled_code_t);
-    copied_code_p->size = (uint16_t) ((pattern_size + JMEM_ALIGNMENT - 1) >> JMEM_ALIGNMENT_LOG);
-
-    copied_code_p->status_flags = compiled_code_p->status_flags;
-
 #else /* CONFIG_DISABLE_REGEXP_BUILTIN */
     JERRY_UNREACHABLE (); /* RegExp is not supported in the selected profile. */
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
@@ -214,7 +181,7 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< compiled
                                            snapshot_buffer_size,
                                            &globals_p->snapshot_buffer_write_offset,
                                            compiled_code_p,
-                                           ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG))
+                                           ecma_compiled_code_get_size (compiled_code_p)))
   {
     globals_p->snapshot_error = jerry_create_error (JERRY_ERROR_RANGE, error_buffer_too_small_p);
     return 0;
@@ -337,7 +304,7 @@ static_snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< c
                                            snapshot_buffer_size,
                                            &globals_p->snapshot_buffer_write_offset,
                                            compiled_code_p,
-                                           ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG))
+                                           ecma_compiled_code_get_size (compiled_code_p)))
   {
     const char *error_message_p = "Snapshot buffer too small.";
     globals_p->snapshot_error = jerry_create_error (JERRY_ERROR_RANGE, (const jerry_char_t *) error_message_p);
@@ -406,7 +373,7 @@ static_snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p, /**< c
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
   {
-    buffer_p += ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+    buffer_p += ecma_compiled_code_get_size (compiled_code_p);
     literal_start_p = ((ecma_value_t *) buffer_p) - argument_end;
 
     for (uint32_t i = 0; i < argument_end; i++)
@@ -435,7 +402,7 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
   do
   {
     ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = (uint32_t) ecma_compiled_code_get_size (bytecode_p);
 
     if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
     {
@@ -479,7 +446,7 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
       if (bytecode_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
       {
         uint8_t *byte_p = (uint8_t *) bytecode_p;
-        byte_p += ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+        byte_p += ecma_compiled_code_get_size (bytecode_p);
         literal_start_p = ((ecma_value_t *) byte_p) - argument_end;
 
         for (uint32_t i = 0; i < argument_end; i++)
@@ -499,10 +466,28 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
           }
         }
       }
+    }
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    else
+    {
+      re_compiled_code_t *re_bytecode_p = (re_compiled_code_t *) buffer_p;
+
+      if (ecma_is_value_string (re_bytecode_p->pattern))
+      {
+        lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
 
-      /* Set reference counter to 1. */
-      bytecode_p->refs = 1;
+        while (current_p->literal_id != re_bytecode_p->pattern)
+        {
+          current_p++;
+        }
+
+        re_bytecode_p->pattern = current_p->literal_offset;
+      }
     }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+
+    /* Set reference counter to 1. */
+    bytecode_p->refs = 1;
 
     JERRY_ASSERT ((code_size % sizeof (uint32_t)) == 0);
     buffer_p += code_size / sizeof (uint32_t);
@@ -534,25 +519,27 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
                              bool copy_bytecode) /**< byte code should be copied to memory */
 {
   ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) base_addr_p;
-  uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+  uint32_t code_size = (uint32_t) ecma_compiled_code_get_size (bytecode_p);
 
   if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
   {
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-    const re_compiled_code_t *re_bytecode_p = NULL;
+    /* Regular expressions are saved in compiled form, only the pattern needs to be resolved. */
+    re_compiled_code_t *re_bytecode_p = (re_compiled_code_t *) jmem_heap_alloc_block (code_size);
 
-    const uint8_t *regex_start_p = ((const uint8_t *) bytecode_p) + sizeof (ecma_compiled_code_t);
+    memcpy (re_bytecode_p, base_addr_p, code_size);
 
-    /* Real size is stored in refs. */
-    ecma_string_t *pattern_str_p = ecma_new_ecma_string_from_utf8 (regex_start_p,
-                                                                   bytecode_p->refs);
+    ecma_value_t pattern = re_bytecode_p->pattern;
 
-    re_compile_bytecode (&re_bytecode_p,
-                         pattern_str_p,
-                         bytecode_p->status_flags);
+    if ((pattern & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
+    {
+      pattern = ecma_snapshot_get_literal (literal_base_p, pattern);
+    }
 
-    ecma_deref_ecma_string (pattern_str_p);
+    /* The byte code owns a reference to its pattern. */
+    re_bytecode_p->pattern = ecma_copy_value (pattern);
 
+    JERRY_ASSERT (re_bytecode_p->header.refs == 1);
     return (ecma_compiled_code_t *) re_bytecode_p;
 #else /* CONFIG_DISABLE_REGEXP_BUILTIN */
     JERRY_UNREACHABLE (); /* RegExp is not supported in the selected profile. */
@@ -626,7 +613,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
 
     memcpy (bytecode_p, base_addr_p, start_offset);
 
-    bytecode_p->size = (uint16_t) (new_code_size >> JMEM_ALIGNMENT_LOG);
+    ecma_compiled_code_set_size (bytecode_p, new_code_size);
 
     uint8_t *byte_p = (uint8_t *) bytecode_p;
 
@@ -763,6 +750,7 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
 
   if (!ecma_is_value_empty (globals.snapshot_error))
   {
+    ecma_bytecode_deref (bytecode_data_p);
     return globals.snapshot_error;
   }
 
@@ -791,6 +779,7 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
                                           &literals_num))
     {
       JERRY_ASSERT (lit_map_p == NULL);
+      ecma_bytecode_deref (bytecode_data_p);
       const char *error_message_p = "Cannot allocate memory for literals.";
       return jerry_create_error (JERRY_ERROR_COMMON, (const jerry_char_t *) error_message_p);
     }
@@ -868,6 +857,86 @@ jerry_generate_snapshot (const jerry_char_t *resource_name_p, /**< script resour
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
 } /* jerry_generate_snapshot */
 
+/**
+ * Compile source code into a relocatable snapshot without using an initialized instance.
+ *
+ * The source is compiled in the current context of the calling thread, which must not
+ * be initialized by jerry_init. With external context this is a freshly created (see
+ * jerry_create_instance) instance, otherwise the only context of the engine before it
+ * is initialized. The context is initialized and cleaned up by this function, so the
+ * memory of an instance can be released or reused after the call. Since each instance
+ * has its own context, heap and literal storage, worker threads can compile scripts
+ * while other instances keep running. The resulting buffer can be executed by
+ * jerry_exec_snapshot in any instance.
+ *
+ * Note:
+ *      the port must return a separate current instance for each thread
+ *      (see jerry_port_get_current_instance)
+ *
+ * @return JERRY_ERROR_NONE - if the snapshot was generated succesfully
+ *         type of the error - otherwise (e.g. JERRY_ERROR_RANGE if the buffer is too small,
+ *                             JERRY_ERROR_COMMON if the context is already initialized
+ *                             or JERRY_ENABLE_SNAPSHOT_SAVE is disabled)
+ */
+jerry_error_t
+jerry_compile_snapshot (const jerry_char_t *source_p, /**< script source */
+                        size_t source_size, /**< script source size */
+                        uint32_t generate_snapshot_opts, /**< jerry_generate_snapshot_opts_t option bits */
+                        uint32_t *buffer_p, /**< buffer to save snapshot to */
+                        size_t buffer_size, /**< the buffer's size */
+                        size_t *snapshot_size_p) /**< [out] size of the snapshot (0 on error) */
+{
+  JERRY_ASSERT (snapshot_size_p != NULL);
+
+  *snapshot_size_p = 0;
+
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_API_AVAILABLE)
+  {
+    return JERRY_ERROR_COMMON;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t generate_result = jerry_generate_snapshot (NULL,
+                                                           0,
+                                                           source_p,
+                                                           source_size,
+                                                           generate_snapshot_opts,
+                                                           buffer_p,
+                                                           buffer_size);
+  jerry_error_t error_type = JERRY_ERROR_NONE;
+
+  if (jerry_value_is_error (generate_result))
+  {
+    jerry_value_clear_error_flag (&generate_result);
+    error_type = jerry_get_error_type (generate_result);
+
+    if (error_type == JERRY_ERROR_NONE)
+    {
+      error_type = JERRY_ERROR_COMMON;
+    }
+  }
+  else
+  {
+    *snapshot_size_p = (size_t) jerry_get_number_value (generate_result);
+  }
+
+  jerry_release_value (generate_result);
+  jerry_cleanup ();
+
+  return error_type;
+#else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
+  JERRY_UNUSED (source_p);
+  JERRY_UNUSED (source_size);
+  JERRY_UNUSED (generate_snapshot_opts);
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return JERRY_ERROR_COMMON;
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+} /* jerry_compile_snapshot */
+
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 /**
  * Execute/load snapshot from specified buffer
@@ -960,6 +1029,8 @@ jerry_snapshot_result (const uint32_t *snapshot_p, /**< snapshot */
     }
   }
 
+  JERRY_TRACEPOINT3 (snapshot__load, (uintptr_t) snapshot_p, snapshot_size, (uintptr_t) bytecode_p);
+
   ecma_value_t ret_val;
 
   if (as_function)
@@ -1025,6 +1096,23 @@ jerry_exec_snapshot (const uint32_t *snapshot_p, /**< snapshot */
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
+/**
+ * Get the offset of the first compiled code block of a snapshot.
+ *
+ * Note:
+ *      the compiled code blocks are stored right after the function offset table,
+ *      the first primary function is not necessarily the first block
+ *
+ * @return offset of the function area
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+snapshot_get_functions_start (const jerry_snapshot_header_t *header_p) /**< snapshot header */
+{
+  return (uint32_t) JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t)
+                                   + (header_p->number_of_funcs - 1) * sizeof (uint32_t),
+                                   JMEM_ALIGNMENT);
+} /* snapshot_get_functions_start */
+
 /**
  * Collect all literals from a snapshot file.
  */
@@ -1039,7 +1127,7 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
   do
   {
     ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = (uint32_t) ecma_compiled_code_get_size (bytecode_p);
 
     if ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
@@ -1078,7 +1166,7 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
       if (bytecode_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
       {
         uint8_t *byte_p = (uint8_t *) bytecode_p;
-        byte_p += ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+        byte_p += ecma_compiled_code_get_size (bytecode_p);
         literal_start_p = ((ecma_value_t *) byte_p) - argument_end;
 
         for (uint32_t i = 0; i < argument_end; i++)
@@ -1092,6 +1180,19 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
         }
       }
     }
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    else if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+    {
+      re_compiled_code_t *re_bytecode_p = (re_compiled_code_t *) buffer_p;
+
+      if ((re_bytecode_p->pattern & ECMA_VALUE_TYPE_MASK) == ECMA_TYPE_SNAPSHOT_OFFSET)
+      {
+        ecma_value_t lit_value = ecma_snapshot_get_literal (literal_base_p, re_bytecode_p->pattern);
+        re_bytecode_p->pattern = lit_value;
+        ecma_save_literals_append_value (lit_value, lit_pool_p);
+      }
+    }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 
     buffer_p += code_size;
   }
@@ -1111,7 +1212,7 @@ update_literal_offsets (uint8_t *buffer_p, /**< snapshot buffer start */
   do
   {
     ecma_compiled_code_t *bytecode_p = (ecma_compiled_code_t *) buffer_p;
-    uint32_t code_size = ((uint32_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+    uint32_t code_size = (uint32_t) ecma_compiled_code_get_size (bytecode_p);
 
     if ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
@@ -1156,7 +1257,7 @@ update_literal_offsets (uint8_t *buffer_p, /**< snapshot buffer start */
       if (bytecode_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
       {
         uint8_t *byte_p = (uint8_t *) bytecode_p;
-        byte_p += ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+        byte_p += ecma_compiled_code_get_size (bytecode_p);
         literal_start_p = ((ecma_value_t *) byte_p) - argument_end;
 
         for (uint32_t i = 0; i < argument_end; i++)
@@ -1175,6 +1276,24 @@ update_literal_offsets (uint8_t *buffer_p, /**< snapshot buffer start */
         }
       }
     }
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    else if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+    {
+      re_compiled_code_t *re_bytecode_p = (re_compiled_code_t *) buffer_p;
+
+      if (ecma_is_value_string (re_bytecode_p->pattern))
+      {
+        lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
+
+        while (current_p->literal_id != re_bytecode_p->pattern)
+        {
+          current_p++;
+        }
+
+        re_bytecode_p->pattern = current_p->literal_offset;
+      }
+    }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 
     buffer_p += code_size;
   }
@@ -1232,7 +1351,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
 
     merged_global_flags |= header_p->global_flags;
 
-    uint32_t start_offset = header_p->func_offsets[0];
+    uint32_t start_offset = snapshot_get_functions_start (header_p);
     const uint8_t *data_p = (const uint8_t *) inp_buffers_p[i];
     const uint8_t *literal_base_p = (uint8_t *) (data_p + header_p->lit_table_offset);
 
@@ -1288,7 +1407,7 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
   {
     const jerry_snapshot_header_t *current_header_p = (const jerry_snapshot_header_t *) inp_buffers_p[i];
 
-    uint32_t start_offset = current_header_p->func_offsets[0];
+    uint32_t start_offset = snapshot_get_functions_start (current_header_p);
 
     memcpy (dst_p,
             ((const uint8_t *) inp_buffers_p[i]) + start_offset,
@@ -1333,6 +1452,803 @@ jerry_merge_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers t
 
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
 
+/**
+ * Status bits of compiled code blocks processed by the snapshot optimizer.
+ */
+typedef enum
+{
+  SNAPSHOT_OPTIMIZE_REACHABLE = (1u << 0), /**< code block is reachable from an entry function */
+  SNAPSHOT_OPTIMIZE_PLACED = (1u << 1), /**< code block is placed in the output */
+} snapshot_optimize_status_t;
+
+/**
+ * Compiled code block of an input snapshot.
+ */
+typedef struct
+{
+  const uint8_t *code_p; /**< start of the compiled code in the input snapshot */
+  uint32_t size; /**< size of the compiled code */
+  uint32_t input_index; /**< index of the input snapshot */
+  uint32_t canonical_index; /**< index of the identical code block which is written to the output */
+  uint32_t new_offset; /**< offset of the code block in the output */
+  uint32_t status; /**< snapshot_optimize_status_t bits */
+} snapshot_optimize_code_t;
+
+/**
+ * Snapshot optimizer state.
+ */
+typedef struct
+{
+  snapshot_optimize_code_t *codes_p; /**< compiled code blocks of all input snapshots */
+  uint32_t *input_start_p; /**< index of the first code block of each input snapshot
+                            *   (the list is terminated by the total number of blocks) */
+  uint32_t *order_p; /**< code block indices in output order */
+  uint32_t order_size; /**< number of items in the order list */
+} snapshot_optimize_state_t;
+
+/**
+ * Get the literal area of a compiled function.
+ *
+ * @return start of the literal area
+ */
+static ecma_value_t *
+snapshot_optimize_get_literals (const uint8_t *code_p, /**< compiled function */
+                                uint32_t *const_literal_end_p, /**< [out] end of the constant literals */
+                                uint32_t *literal_end_p) /**< [out] end of the literals */
+{
+  const ecma_compiled_code_t *bytecode_p = (const ecma_compiled_code_t *) code_p;
+
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION);
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    const cbc_uint16_arguments_t *args_p = (const cbc_uint16_arguments_t *) code_p;
+    *const_literal_end_p = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+    *literal_end_p = (uint32_t) (args_p->literal_end - args_p->register_end);
+    return (ecma_value_t *) (code_p + sizeof (cbc_uint16_arguments_t));
+  }
+
+  const cbc_uint8_arguments_t *args_p = (const cbc_uint8_arguments_t *) code_p;
+  *const_literal_end_p = (uint32_t) (args_p->const_literal_end - args_p->register_end);
+  *literal_end_p = (uint32_t) (args_p->literal_end - args_p->register_end);
+  return (ecma_value_t *) (code_p + sizeof (cbc_uint8_arguments_t));
+} /* snapshot_optimize_get_literals */
+
+/**
+ * Find the code block which starts at the given address of an input snapshot.
+ *
+ * @return index of the code block - if found
+ *         UINT32_MAX - otherwise
+ */
+static uint32_t
+snapshot_optimize_find_code (const snapshot_optimize_state_t *state_p, /**< optimizer state */
+                             uint32_t input_index, /**< index of the input snapshot */
+                             const uint8_t *code_p) /**< start of the code block */
+{
+  uint32_t start = state_p->input_start_p[input_index];
+  uint32_t end = state_p->input_start_p[input_index + 1];
+
+  while (start < end)
+  {
+    uint32_t middle = start + ((end - start) >> 1);
+    const uint8_t *middle_p = state_p->codes_p[middle].code_p;
+
+    if (middle_p == code_p)
+    {
+      return middle;
+    }
+
+    if (middle_p < code_p)
+    {
+      start = middle + 1;
+    }
+    else
+    {
+      end = middle;
+    }
+  }
+
+  return UINT32_MAX;
+} /* snapshot_optimize_find_code */
+
+/**
+ * Get the code block referenced by a sub-function literal.
+ *
+ * @return index of the code block - if the reference is valid
+ *         UINT32_MAX - otherwise
+ */
+static uint32_t
+snapshot_optimize_get_child (const snapshot_optimize_state_t *state_p, /**< optimizer state */
+                             uint32_t code_index, /**< index of the parent code block */
+                             ecma_value_t literal) /**< sub-function literal (offset from the parent) */
+{
+  if (literal == 0)
+  {
+    /* Self reference. */
+    return code_index;
+  }
+
+  const snapshot_optimize_code_t *code_p = state_p->codes_p + code_index;
+  return snapshot_optimize_find_code (state_p, code_p->input_index, code_p->code_p + literal);
+} /* snapshot_optimize_get_child */
+
+/**
+ * Mark the code blocks which are reachable from a code block.
+ *
+ * @return true - if all sub-function references are valid
+ *         false - otherwise
+ */
+static bool
+snapshot_optimize_mark (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                        uint32_t code_index) /**< index of the code block */
+{
+  snapshot_optimize_code_t *code_p = state_p->codes_p + code_index;
+
+  if (code_p->status & SNAPSHOT_OPTIMIZE_REACHABLE)
+  {
+    return true;
+  }
+
+  code_p->status |= SNAPSHOT_OPTIMIZE_REACHABLE;
+
+  if (!(((const ecma_compiled_code_t *) code_p->code_p)->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return true;
+  }
+
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+  ecma_value_t *literal_start_p = snapshot_optimize_get_literals (code_p->code_p, &const_literal_end, &literal_end);
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    uint32_t child_index = snapshot_optimize_get_child (state_p, code_index, literal_start_p[i]);
+
+    if (child_index == UINT32_MAX
+        || !snapshot_optimize_mark (state_p, child_index))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* snapshot_optimize_mark */
+
+/**
+ * Compare two reachable code blocks. Sub-function references are equal
+ * if they refer to code blocks with the same canonical block.
+ *
+ * Note:
+ *      literals must be resolved to ecma values before the comparison
+ *
+ * @return true - if the code blocks are identical
+ *         false - otherwise
+ */
+static bool
+snapshot_optimize_compare (const snapshot_optimize_state_t *state_p, /**< optimizer state */
+                           uint32_t code_index, /**< index of the first code block */
+                           uint32_t other_code_index) /**< index of the second code block */
+{
+  const snapshot_optimize_code_t *code_p = state_p->codes_p + code_index;
+  const snapshot_optimize_code_t *other_code_p = state_p->codes_p + other_code_index;
+
+  if (code_p->size != other_code_p->size)
+  {
+    return false;
+  }
+
+  if (!(((const ecma_compiled_code_t *) code_p->code_p)->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return memcmp (code_p->code_p, other_code_p->code_p, code_p->size) == 0;
+  }
+
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+  ecma_value_t *literal_start_p = snapshot_optimize_get_literals (code_p->code_p, &const_literal_end, &literal_end);
+  size_t literal_offset = (size_t) ((uint8_t *) literal_start_p - code_p->code_p);
+  size_t prefix_size = literal_offset + const_literal_end * sizeof (ecma_value_t);
+
+  /* The header is the part of the prefix, so the literal ranges are the same if the prefixes are equal. */
+  if (memcmp (code_p->code_p, other_code_p->code_p, prefix_size) != 0)
+  {
+    return false;
+  }
+
+  ecma_value_t *other_literal_start_p = (ecma_value_t *) (other_code_p->code_p + literal_offset);
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    uint32_t child_index = snapshot_optimize_get_child (state_p, code_index, literal_start_p[i]);
+    uint32_t other_child_index = snapshot_optimize_get_child (state_p, other_code_index, other_literal_start_p[i]);
+
+    if (child_index == code_index || other_child_index == other_code_index)
+    {
+      if (literal_start_p[i] != other_literal_start_p[i])
+      {
+        return false;
+      }
+      continue;
+    }
+
+    if (state_p->codes_p[child_index].canonical_index != state_p->codes_p[other_child_index].canonical_index)
+    {
+      return false;
+    }
+  }
+
+  size_t suffix_offset = literal_offset + literal_end * sizeof (ecma_value_t);
+
+  return memcmp (code_p->code_p + suffix_offset,
+                 other_code_p->code_p + suffix_offset,
+                 code_p->size - suffix_offset) == 0;
+} /* snapshot_optimize_compare */
+
+/**
+ * Append the canonical code blocks reachable from a code block to the order
+ * list in post order, so the reversed list places each block before its
+ * sub-functions.
+ */
+static void
+snapshot_optimize_place (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                         uint32_t code_index) /**< index of a canonical code block */
+{
+  snapshot_optimize_code_t *code_p = state_p->codes_p + code_index;
+
+  JERRY_ASSERT (code_p->canonical_index == code_index);
+
+  if (code_p->status & SNAPSHOT_OPTIMIZE_PLACED)
+  {
+    return;
+  }
+
+  code_p->status |= SNAPSHOT_OPTIMIZE_PLACED;
+
+  if (((const ecma_compiled_code_t *) code_p->code_p)->status_flags & CBC_CODE_FLAGS_FUNCTION)
+  {
+    uint32_t const_literal_end;
+    uint32_t literal_end;
+    ecma_value_t *literal_start_p = snapshot_optimize_get_literals (code_p->code_p, &const_literal_end, &literal_end);
+
+    /* Sub-functions are visited backwards, so they follow their parent in source order. */
+    for (uint32_t i = literal_end; i > const_literal_end; i--)
+    {
+      uint32_t child_index = snapshot_optimize_get_child (state_p, code_index, literal_start_p[i - 1]);
+
+      snapshot_optimize_place (state_p, state_p->codes_p[child_index].canonical_index);
+    }
+  }
+
+  state_p->order_p[state_p->order_size++] = code_index;
+} /* snapshot_optimize_place */
+
+/**
+ * Get the canonical code block of a primary function.
+ *
+ * @return index of the code block - if the function index is valid
+ *         UINT32_MAX - otherwise
+ */
+static uint32_t
+snapshot_optimize_get_function (const snapshot_optimize_state_t *state_p, /**< optimizer state */
+                                const uint32_t **inp_buffers_p, /**< array of input buffers */
+                                size_t number_of_snapshots, /**< number of snapshots */
+                                uint32_t func_index) /**< primary function index in the merged index space */
+{
+  for (uint32_t i = 0; i < number_of_snapshots; i++)
+  {
+    const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) inp_buffers_p[i];
+
+    if (func_index < header_p->number_of_funcs)
+    {
+      uint32_t offset = header_p->func_offsets[func_index] & ~(uint32_t) (JMEM_ALIGNMENT - 1);
+      return snapshot_optimize_find_code (state_p, i, ((const uint8_t *) header_p) + offset);
+    }
+
+    func_index -= header_p->number_of_funcs;
+  }
+
+  return UINT32_MAX;
+} /* snapshot_optimize_get_function */
+
+/**
+ * Get the flag bits of a primary function offset.
+ *
+ * @return flag bits
+ */
+static uint32_t
+snapshot_optimize_get_function_flags (const uint32_t **inp_buffers_p, /**< array of input buffers */
+                                      uint32_t func_index) /**< valid primary function index */
+{
+  for (uint32_t i = 0; ; i++)
+  {
+    const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) inp_buffers_p[i];
+
+    if (func_index < header_p->number_of_funcs)
+    {
+      return header_p->func_offsets[func_index] & (uint32_t) (JMEM_ALIGNMENT - 1);
+    }
+
+    func_index -= header_p->number_of_funcs;
+  }
+} /* snapshot_optimize_get_function_flags */
+
+/**
+ * Get the primary function index of an entry function.
+ *
+ * @return primary function index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+snapshot_optimize_get_entry (const uint32_t *entry_funcs_p, /**< entry function indices or NULL */
+                             uint32_t index) /**< index of the entry function */
+{
+  return (entry_funcs_p != NULL) ? entry_funcs_p[index] : index;
+} /* snapshot_optimize_get_entry */
+
+/**
+ * Collect the compiled code blocks of the input snapshots.
+ */
+static void
+snapshot_optimize_collect (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                           const uint32_t **inp_buffers_p, /**< array of input buffers */
+                           size_t number_of_snapshots) /**< number of snapshots */
+{
+  uint32_t number_of_codes = 0;
+
+  for (uint32_t i = 0; i < number_of_snapshots; i++)
+  {
+    const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) inp_buffers_p[i];
+    const uint8_t *data_p = (const uint8_t *) inp_buffers_p[i];
+    uint32_t offset = snapshot_get_functions_start (header_p);
+
+    state_p->input_start_p[i] = number_of_codes;
+
+    while (offset < header_p->lit_table_offset)
+    {
+      snapshot_optimize_code_t *code_p = state_p->codes_p + number_of_codes;
+
+      code_p->code_p = data_p + offset;
+      code_p->size = (uint32_t) ecma_compiled_code_get_size ((const ecma_compiled_code_t *) code_p->code_p);
+      code_p->input_index = i;
+      code_p->canonical_index = number_of_codes;
+      code_p->new_offset = 0;
+      code_p->status = 0;
+
+      offset += code_p->size;
+      number_of_codes++;
+    }
+  }
+
+  state_p->input_start_p[number_of_snapshots] = number_of_codes;
+} /* snapshot_optimize_collect */
+
+/**
+ * Merge identical reachable code blocks. Sub-functions are stored after their
+ * parents, so processing the blocks of each snapshot backwards ensures that
+ * the canonical blocks of the sub-functions are known when a block is compared.
+ */
+static void
+snapshot_optimize_deduplicate (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                               size_t number_of_snapshots) /**< number of snapshots */
+{
+  /* The order list temporarily holds the canonical blocks. */
+  uint32_t number_of_canonical_codes = 0;
+
+  for (uint32_t i = 0; i < number_of_snapshots; i++)
+  {
+    for (uint32_t j = state_p->input_start_p[i + 1]; j > state_p->input_start_p[i]; j--)
+    {
+      uint32_t code_index = j - 1;
+
+      if (!(state_p->codes_p[code_index].status & SNAPSHOT_OPTIMIZE_REACHABLE))
+      {
+        continue;
+      }
+
+      uint32_t k;
+
+      for (k = 0; k < number_of_canonical_codes; k++)
+      {
+        if (snapshot_optimize_compare (state_p, code_index, state_p->order_p[k]))
+        {
+          state_p->codes_p[code_index].canonical_index = state_p->order_p[k];
+          break;
+        }
+      }
+
+      if (k == number_of_canonical_codes)
+      {
+        state_p->order_p[number_of_canonical_codes++] = code_index;
+      }
+    }
+  }
+} /* snapshot_optimize_deduplicate */
+
+/**
+ * Check whether a primary function is listed in the execution profile.
+ *
+ * @return true - if the function is listed
+ *         false - otherwise
+ */
+static bool
+snapshot_optimize_is_profiled (const uint32_t *profile_p, /**< execution profile */
+                               size_t profile_size, /**< number of items in the profile */
+                               uint32_t func_index) /**< primary function index */
+{
+  for (size_t i = 0; i < profile_size; i++)
+  {
+    if (profile_p[i] == func_index)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* snapshot_optimize_is_profiled */
+
+/**
+ * Compute the order of the canonical code blocks in the output.
+ *
+ * The blocks are ordered in reverse post order, so each block precedes its
+ * sub-functions (sub-function offsets are always positive). The entry functions
+ * are visited in reverse order of their expected use: the profiled functions
+ * are visited last, so they are placed first in the order of the profile.
+ */
+static void
+snapshot_optimize_layout (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                          const uint32_t **inp_buffers_p, /**< array of input buffers */
+                          size_t number_of_snapshots, /**< number of snapshots */
+                          const uint32_t *entry_funcs_p, /**< entry function indices or NULL */
+                          uint32_t number_of_entry_funcs, /**< number of entry functions */
+                          const uint32_t *profile_p, /**< execution profile */
+                          size_t profile_size) /**< number of items in the profile */
+{
+  state_p->order_size = 0;
+
+  for (uint32_t i = number_of_entry_funcs; i > 0; i--)
+  {
+    uint32_t func_index = snapshot_optimize_get_entry (entry_funcs_p, i - 1);
+
+    if (!snapshot_optimize_is_profiled (profile_p, profile_size, func_index))
+    {
+      uint32_t code_index = snapshot_optimize_get_function (state_p, inp_buffers_p, number_of_snapshots, func_index);
+      snapshot_optimize_place (state_p, state_p->codes_p[code_index].canonical_index);
+    }
+  }
+
+  for (size_t i = profile_size; i > 0; i--)
+  {
+    uint32_t func_index = profile_p[i - 1];
+    uint32_t j;
+
+    /* Functions which are not entry functions are ignored. */
+    for (j = 0; j < number_of_entry_funcs; j++)
+    {
+      if (snapshot_optimize_get_entry (entry_funcs_p, j) == func_index)
+      {
+        break;
+      }
+    }
+
+    if (j < number_of_entry_funcs)
+    {
+      uint32_t code_index = snapshot_optimize_get_function (state_p, inp_buffers_p, number_of_snapshots, func_index);
+      snapshot_optimize_place (state_p, state_p->codes_p[code_index].canonical_index);
+    }
+  }
+
+  for (uint32_t i = 0, j = state_p->order_size - 1; i < j; i++, j--)
+  {
+    uint32_t tmp = state_p->order_p[i];
+    state_p->order_p[i] = state_p->order_p[j];
+    state_p->order_p[j] = tmp;
+  }
+} /* snapshot_optimize_layout */
+
+/**
+ * Write the canonical code blocks to the output in the computed order.
+ */
+static void
+snapshot_optimize_write_functions (snapshot_optimize_state_t *state_p, /**< optimizer state */
+                                   uint8_t *out_p, /**< output buffer */
+                                   lit_mem_to_snapshot_id_map_entry_t *lit_map_p) /**< literal map */
+{
+  for (uint32_t i = 0; i < state_p->order_size; i++)
+  {
+    uint32_t code_index = state_p->order_p[i];
+    snapshot_optimize_code_t *code_p = state_p->codes_p + code_index;
+    uint8_t *dst_p = out_p + code_p->new_offset;
+
+    memcpy (dst_p, code_p->code_p, code_p->size);
+
+    if (((const ecma_compiled_code_t *) code_p->code_p)->status_flags & CBC_CODE_FLAGS_FUNCTION)
+    {
+      uint32_t const_literal_end;
+      uint32_t literal_end;
+      ecma_value_t *literal_start_p = snapshot_optimize_get_literals (code_p->code_p,
+                                                                      &const_literal_end,
+                                                                      &literal_end);
+      ecma_value_t *dst_literal_start_p = (ecma_value_t *) (dst_p + ((uint8_t *) literal_start_p - code_p->code_p));
+
+      for (uint32_t j = const_literal_end; j < literal_end; j++)
+      {
+        uint32_t child_index = snapshot_optimize_get_child (state_p, code_index, literal_start_p[j]);
+
+        if (child_index != code_index)
+        {
+          const snapshot_optimize_code_t *child_p = state_p->codes_p + state_p->codes_p[child_index].canonical_index;
+
+          JERRY_ASSERT (child_p->new_offset > code_p->new_offset);
+          dst_literal_start_p[j] = child_p->new_offset - code_p->new_offset;
+        }
+      }
+    }
+
+    update_literal_offsets (dst_p, dst_p + code_p->size, lit_map_p);
+  }
+} /* snapshot_optimize_write_functions */
+
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+
+/**
+ * Optimize snapshots: the functions reachable from the entry functions are
+ * merged into a single snapshot which has one literal table, identical
+ * compiled code blocks are stored only once, and the code blocks are ordered
+ * by the execution profile.
+ *
+ * Note:
+ *      the literals of the input buffers are resolved in place, so the input
+ *      buffers cannot be used after the call
+ *
+ * @return length of the optimized snapshot
+ *         0 on error
+ */
+size_t
+jerry_optimize_snapshots (const uint32_t **inp_buffers_p, /**< array of (pointers to start of) input buffers */
+                          size_t *inp_buffer_sizes_p, /**< array of input buffer sizes */
+                          size_t number_of_snapshots, /**< number of snapshots */
+                          const uint32_t *entry_funcs_p, /**< primary function indices of the entry functions,
+                                                          *   NULL means all functions */
+                          size_t number_of_entry_funcs, /**< number of entry functions */
+                          const uint32_t *profile_p, /**< primary function indices in order of execution */
+                          size_t profile_size, /**< number of items in the profile */
+                          uint32_t *out_buffer_p, /**< output buffer */
+                          size_t out_buffer_size, /**< output buffer size */
+                          const char **error_p) /**< error description */
+{
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+  uint32_t number_of_funcs = 0;
+  uint32_t number_of_codes = 0;
+  uint32_t optimized_global_flags = 0;
+
+  if (number_of_snapshots == 0)
+  {
+    *error_p = "at least one snapshot must be passed";
+    return 0;
+  }
+
+  for (uint32_t i = 0; i < number_of_snapshots; i++)
+  {
+    const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) inp_buffers_p[i];
+
+    if (inp_buffer_sizes_p[i] < sizeof (jerry_snapshot_header_t))
+    {
+      *error_p = "invalid snapshot file";
+      return 0;
+    }
+
+    if (header_p->magic != JERRY_SNAPSHOT_MAGIC
+        || header_p->version != JERRY_SNAPSHOT_VERSION
+        || !snapshot_check_global_flags (header_p->global_flags))
+    {
+      *error_p = "invalid snapshot version or unsupported features present";
+      return 0;
+    }
+
+    uint32_t offset = snapshot_get_functions_start (header_p);
+
+    if (header_p->number_of_funcs == 0
+        || header_p->lit_table_offset > inp_buffer_sizes_p[i]
+        || offset >= header_p->lit_table_offset)
+    {
+      *error_p = "invalid snapshot file";
+      return 0;
+    }
+
+    while (offset < header_p->lit_table_offset)
+    {
+      const ecma_compiled_code_t *bytecode_p = (const ecma_compiled_code_t *) (((const uint8_t *) header_p) + offset);
+      uint32_t code_size = (uint32_t) ecma_compiled_code_get_size (bytecode_p);
+
+      if (code_size == 0 || code_size > header_p->lit_table_offset - offset)
+      {
+        *error_p = "invalid snapshot file";
+        return 0;
+      }
+
+      offset += code_size;
+      number_of_codes++;
+    }
+
+    optimized_global_flags |= header_p->global_flags;
+    number_of_funcs += header_p->number_of_funcs;
+  }
+
+  if (entry_funcs_p == NULL || number_of_entry_funcs == 0)
+  {
+    entry_funcs_p = NULL;
+    number_of_entry_funcs = number_of_funcs;
+  }
+
+  snapshot_optimize_state_t state;
+  size_t codes_size = number_of_codes * sizeof (snapshot_optimize_code_t);
+  size_t input_start_size = (number_of_snapshots + 1) * sizeof (uint32_t);
+  size_t order_size = number_of_codes * sizeof (uint32_t);
+
+  state.codes_p = (snapshot_optimize_code_t *) jmem_heap_alloc_block_null_on_error (codes_size);
+  state.input_start_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (input_start_size);
+  state.order_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (order_size);
+  state.order_size = 0;
+
+  size_t functions_size = 0;
+  lit_mem_to_snapshot_id_map_entry_t *lit_map_p = NULL;
+  uint32_t literals_num = 0;
+
+  *error_p = NULL;
+
+  if (state.codes_p == NULL || state.input_start_p == NULL || state.order_p == NULL)
+  {
+    *error_p = "out of memory";
+  }
+  else
+  {
+    snapshot_optimize_collect (&state, inp_buffers_p, number_of_snapshots);
+
+    for (uint32_t i = 0; i < number_of_entry_funcs; i++)
+    {
+      uint32_t code_index = snapshot_optimize_get_function (&state,
+                                                            inp_buffers_p,
+                                                            number_of_snapshots,
+                                                            snapshot_optimize_get_entry (entry_funcs_p, i));
+
+      if (code_index == UINT32_MAX)
+      {
+        *error_p = "invalid entry function index";
+        break;
+      }
+
+      if (!snapshot_optimize_mark (&state, code_index))
+      {
+        *error_p = "invalid snapshot file";
+        break;
+      }
+    }
+  }
+
+  if (*error_p == NULL)
+  {
+    /* Only the literals of the reachable functions are kept. */
+    ecma_collection_header_t *lit_pool_p = ecma_new_values_collection ();
+
+    for (uint32_t i = 0; i < number_of_codes; i++)
+    {
+      const snapshot_optimize_code_t *code_p = state.codes_p + i;
+
+      if (code_p->status & SNAPSHOT_OPTIMIZE_REACHABLE)
+      {
+        const jerry_snapshot_header_t *header_p = (const jerry_snapshot_header_t *) inp_buffers_p[code_p->input_index];
+
+        scan_snapshot_functions (code_p->code_p,
+                                 code_p->code_p + code_p->size,
+                                 lit_pool_p,
+                                 ((const uint8_t *) header_p) + header_p->lit_table_offset);
+      }
+    }
+
+    snapshot_optimize_deduplicate (&state, number_of_snapshots);
+    snapshot_optimize_layout (&state,
+                              inp_buffers_p,
+                              number_of_snapshots,
+                              entry_funcs_p,
+                              (uint32_t) number_of_entry_funcs,
+                              profile_p,
+                              profile_size);
+
+    functions_size = JERRY_ALIGNUP (sizeof (jerry_snapshot_header_t)
+                                    + (number_of_entry_funcs - 1) * sizeof (uint32_t),
+                                    JMEM_ALIGNMENT);
+
+    for (uint32_t i = 0; i < state.order_size; i++)
+    {
+      snapshot_optimize_code_t *code_p = state.codes_p + state.order_p[i];
+
+      code_p->new_offset = (uint32_t) functions_size;
+      functions_size += code_p->size;
+    }
+
+    if (functions_size >= out_buffer_size)
+    {
+      *error_p = "output buffer is too small";
+      ecma_free_values_collection (lit_pool_p, ECMA_COLLECTION_NO_COPY);
+    }
+    else
+    {
+      jerry_snapshot_header_t *header_p = (jerry_snapshot_header_t *) out_buffer_p;
+
+      header_p->magic = JERRY_SNAPSHOT_MAGIC;
+      header_p->version = JERRY_SNAPSHOT_VERSION;
+      header_p->global_flags = optimized_global_flags;
+      header_p->lit_table_offset = (uint32_t) functions_size;
+      header_p->number_of_funcs = (uint32_t) number_of_entry_funcs;
+
+      if (!ecma_save_literals_for_snapshot (lit_pool_p,
+                                            out_buffer_p,
+                                            out_buffer_size,
+                                            &functions_size,
+                                            &lit_map_p,
+                                            &literals_num))
+      {
+        *error_p = "output buffer is too small";
+      }
+      else
+      {
+        snapshot_optimize_write_functions (&state, (uint8_t *) out_buffer_p, lit_map_p);
+
+        for (uint32_t i = 0; i < number_of_entry_funcs; i++)
+        {
+          uint32_t func_index = snapshot_optimize_get_entry (entry_funcs_p, i);
+          uint32_t code_index = snapshot_optimize_get_function (&state,
+                                                                inp_buffers_p,
+                                                                number_of_snapshots,
+                                                                func_index);
+
+          code_index = state.codes_p[code_index].canonical_index;
+
+          /* Updating offset without changing any flags. */
+          header_p->func_offsets[i] = (state.codes_p[code_index].new_offset
+                                       | snapshot_optimize_get_function_flags (inp_buffers_p, func_index));
+        }
+      }
+    }
+  }
+
+  if (lit_map_p != NULL)
+  {
+    jmem_heap_free_block (lit_map_p, literals_num * sizeof (lit_mem_to_snapshot_id_map_entry_t));
+  }
+
+  if (state.codes_p != NULL)
+  {
+    jmem_heap_free_block (state.codes_p, codes_size);
+  }
+
+  if (state.input_start_p != NULL)
+  {
+    jmem_heap_free_block (state.input_start_p, input_start_size);
+  }
+
+  if (state.order_p != NULL)
+  {
+    jmem_heap_free_block (state.order_p, order_size);
+  }
+
+  return (*error_p == NULL) ? functions_size : 0;
+#else /* !JERRY_ENABLE_SNAPSHOT_SAVE */
+  JERRY_UNUSED (inp_buffers_p);
+  JERRY_UNUSED (inp_buffer_sizes_p);
+  JERRY_UNUSED (number_of_snapshots);
+  JERRY_UNUSED (entry_funcs_p);
+  JERRY_UNUSED (number_of_entry_funcs);
+  JERRY_UNUSED (profile_p);
+  JERRY_UNUSED (profile_size);
+  JERRY_UNUSED (out_buffer_p);
+  JERRY_UNUSED (out_buffer_size);
+
+  *error_p = "snapshot optimization not supported";
+  return 0;
+#endif /* JERRY_ENABLE_SNAPSHOT_SAVE */
+} /* jerry_optimize_snapshots */
+
+#ifdef JERRY_ENABLE_SNAPSHOT_SAVE
+
 /**
  * ====================== Functions for literal saving ==========================
  */
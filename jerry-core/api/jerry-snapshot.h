@@ -40,8 +40,13 @@ typedef struct
 
 /**
  * Jerry snapshot format version.
+ *
+ * Note:
+ *      regular expression literals are saved as compiled byte code,
+ *      so the version must also be increased when the format of
+ *      re_compiled_code_t or the regular expression opcodes change.
  */
-#define JERRY_SNAPSHOT_VERSION (13u)
+#define JERRY_SNAPSHOT_VERSION (18u)
 
 /**
  * Snapshot configuration flags.
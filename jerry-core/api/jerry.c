@@ -38,6 +38,7 @@
 #include "jmem.h"
 #include "js-parser.h"
 #include "re-compiler.h"
+#include "vm-jit.h"
 
 JERRY_STATIC_ASSERT (sizeof (jerry_value_t) == sizeof (ecma_value_t),
                      size_of_jerry_value_t_must_be_equal_to_size_of_ecma_value_t);
@@ -55,7 +56,8 @@ JERRY_STATIC_ASSERT ((int) ECMA_ERROR_NONE == (int) JERRY_ERROR_NONE
 JERRY_STATIC_ASSERT ((int) ECMA_INIT_EMPTY == (int) JERRY_INIT_EMPTY
                      && (int) ECMA_INIT_SHOW_OPCODES == (int) JERRY_INIT_SHOW_OPCODES
                      && (int) ECMA_INIT_SHOW_REGEXP_OPCODES == (int) JERRY_INIT_SHOW_REGEXP_OPCODES
-                     && (int) ECMA_INIT_MEM_STATS == (int) JERRY_INIT_MEM_STATS,
+                     && (int) ECMA_INIT_MEM_STATS == (int) JERRY_INIT_MEM_STATS
+                     && (int) ECMA_INIT_DEFERRED_FINALIZERS == (int) JERRY_INIT_DEFERRED_FINALIZERS,
                      ecma_init_flag_t_must_be_equal_to_jerry_init_flag_t);
 
 #if defined JERRY_DISABLE_JS_PARSER && !defined JERRY_ENABLE_SNAPSHOT_EXEC
@@ -189,6 +191,11 @@ jerry_init (jerry_init_flag_t flags) /**< combination of Jerry flags */
 
   JERRY_CONTEXT (jerry_init_flags) = flags;
 
+#ifdef JERRY_QUOTAS
+  JERRY_CONTEXT (quota_heap_limit) = SIZE_MAX;
+  JERRY_CONTEXT (quota_call_depth_limit) = UINT32_MAX;
+#endif /* JERRY_QUOTAS */
+
   jerry_make_api_available ();
 
   jmem_init ();
@@ -224,6 +231,9 @@ jerry_cleanup (void)
   ecma_free_all_enqueued_jobs ();
 #endif /* CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
   ecma_finalize ();
+#ifdef JERRY_JIT
+  vm_jit_finalize ();
+#endif /* JERRY_JIT */
   jerry_make_api_unavailable ();
 
   for (jerry_context_data_header_t *this_p = JERRY_CONTEXT (context_data_p), *next_p = NULL;
@@ -303,6 +313,25 @@ jerry_gc (void)
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
 } /* jerry_gc */
 
+/**
+ * Run the native free callbacks which were queued by the garbage collector
+ * when the engine is initialized with JERRY_INIT_DEFERRED_FINALIZERS.
+ *
+ * Note:
+ *      the callbacks are called in the order they were queued, and the
+ *      remaining ones are called by jerry_cleanup at the latest
+ *
+ * @return number of callbacks which are still pending
+ */
+uint32_t
+jerry_run_deferred_finalizers (uint32_t count_limit, /**< maximum number of callbacks to call, 0 - no limit */
+                               uint32_t time_limit_ms) /**< time budget in milliseconds, 0 - no limit */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_run_finalizers (count_limit, time_limit_ms);
+} /* jerry_run_deferred_finalizers */
+
 /**
  * Get heap memory stats.
  *
@@ -327,7 +356,9 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
     .version = 1,
     .size = jmem_heap_stats.size,
     .allocated_bytes = jmem_heap_stats.allocated_bytes,
-    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes
+    .peak_allocated_bytes = jmem_heap_stats.peak_allocated_bytes,
+    .external_bytes = jmem_heap_stats.external_bytes,
+    .peak_external_bytes = jmem_heap_stats.peak_external_bytes
   };
 
   return true;
@@ -337,6 +368,29 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif
 } /* jerry_get_memory_stats */
 
+/**
+ * Get the retained size of a set of values, i.e. the number of heap bytes which
+ * would become free if the references held by the values were released.
+ *
+ * Note:
+ *      only objects retain memory, other values are ignored
+ *
+ * @return retained size in bytes
+ */
+size_t
+jerry_get_retained_size (const jerry_value_t *values_p, /**< values */
+                         size_t values_count) /**< number of values */
+{
+  jerry_assert_api_available ();
+
+  if (values_p == NULL)
+  {
+    return 0;
+  }
+
+  return ecma_gc_get_retained_size (values_p, values_count);
+} /* jerry_get_retained_size */
+
 /**
  * Simple Jerry runner
  *
@@ -893,6 +947,15 @@ jerry_is_feature_enabled (const jerry_feature_t feature) /**< feature to check *
 #ifdef JERRY_VM_EXEC_STOP
           || feature == JERRY_FEATURE_VM_EXEC_STOP
 #endif /* JERRY_VM_EXEC_STOP */
+#ifdef JERRY_QUOTAS
+          || feature == JERRY_FEATURE_QUOTAS
+#endif /* JERRY_QUOTAS */
+#ifdef JERRY_TRACEPOINTS
+          || feature == JERRY_FEATURE_TRACEPOINTS
+#endif /* JERRY_TRACEPOINTS */
+#ifdef JERRY_JIT
+          || feature == JERRY_FEATURE_JIT
+#endif /* JERRY_JIT */
 #ifndef CONFIG_DISABLE_JSON_BUILTIN
           || feature == JERRY_FEATURE_JSON
 #endif /* !CONFIG_DISABLE_JSON_BUILTIN */
@@ -1397,6 +1460,24 @@ jerry_create_object (void)
   return ecma_make_object_value (ecma_op_create_object_object_noarg ());
 } /* jerry_create_object */
 
+/**
+ * Create an empty object with a reserved native pointer slot.
+ *
+ * Note:
+ *      the native pointer of the created object can be get and set in constant time
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return value of the created object
+ */
+jerry_value_t
+jerry_create_native_object (void *native_pointer_p, /**< native pointer */
+                            const jerry_object_native_info_t *native_info_p) /**< object's native type info */
+{
+  jerry_assert_api_available ();
+
+  return ecma_make_object_value (ecma_create_native_object (native_pointer_p, (void *) native_info_p));
+} /* jerry_create_native_object */
+
 /**
  * Create an empty Promise object which can be resolve/reject later
  * by calling jerry_resolve_or_reject_promise.
@@ -1760,6 +1841,85 @@ jerry_substring_to_utf8_char_buffer (const jerry_value_t value, /**< input strin
                                              buffer_size);
 } /* jerry_substring_to_utf8_char_buffer */
 
+/**
+ * Initialize a cursor for exporting the contents of a string in chunks.
+ *
+ * Note:
+ *      the cursor does not hold a reference to the string, so the
+ *      string value must be kept alive while the cursor is used
+ */
+void
+jerry_string_cursor_init (jerry_string_cursor_t *cursor_p, /**< [out] string cursor */
+                          const jerry_value_t value) /**< input string value */
+{
+  jerry_assert_api_available ();
+
+  cursor_p->value = jerry_get_arg_value (value);
+  cursor_p->offset = 0;
+} /* jerry_string_cursor_init */
+
+/**
+ * Copy the next chunk of a string to the buffer. The chunks are exported in
+ * cesu-8 encoding, and they never contain partial characters.
+ *
+ * Note:
+ *      the total cost of exporting a string is linear in the size of the string,
+ *      since each chunk continues where the previous one ended
+ *
+ * @return number of bytes copied to the buffer
+ *         0 - if the whole string is exported, the value is not a string,
+ *             or the buffer is too small for the next character
+ */
+jerry_size_t
+jerry_string_cursor_next (jerry_string_cursor_t *cursor_p, /**< [in, out] string cursor */
+                          jerry_char_t *buffer_p, /**< [out] output characters buffer */
+                          jerry_size_t buffer_size) /**< size of output buffer */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (cursor_p->value) || buffer_p == NULL)
+  {
+    return 0;
+  }
+
+  return ecma_string_copy_chunk_to_buffer (ecma_get_string_from_value (cursor_p->value),
+                                           &cursor_p->offset,
+                                           (lit_utf8_byte_t *) buffer_p,
+                                           buffer_size,
+                                           false);
+} /* jerry_string_cursor_next */
+
+/**
+ * Copy the next chunk of a string to the buffer. The chunks are exported in
+ * utf-8 encoding, and they never contain partial characters.
+ *
+ * Note:
+ *      the total cost of exporting a string is linear in the size of the string,
+ *      since each chunk continues where the previous one ended
+ *
+ * @return number of bytes copied to the buffer
+ *         0 - if the whole string is exported, the value is not a string,
+ *             or the buffer is too small for the next character
+ */
+jerry_size_t
+jerry_string_cursor_next_utf8 (jerry_string_cursor_t *cursor_p, /**< [in, out] string cursor */
+                               jerry_char_t *buffer_p, /**< [out] output characters buffer */
+                               jerry_size_t buffer_size) /**< size of output buffer */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (cursor_p->value) || buffer_p == NULL)
+  {
+    return 0;
+  }
+
+  return ecma_string_copy_chunk_to_buffer (ecma_get_string_from_value (cursor_p->value),
+                                           &cursor_p->offset,
+                                           (lit_utf8_byte_t *) buffer_p,
+                                           buffer_size,
+                                           true);
+} /* jerry_string_cursor_next_utf8 */
+
 /**
  * Checks whether the object or it's prototype objects have the given property.
  *
@@ -2524,6 +2684,30 @@ jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *native_i
   JERRY_ASSERT (foreach_p != NULL);
 
   ecma_native_pointer_t *native_pointer_p;
+  ecma_native_info_registry_t *registry_p = ecma_find_native_info_registry ((void *) native_info_p);
+
+  if (registry_p != NULL)
+  {
+    jmem_cpointer_t item_cp = registry_p->first_object_cp;
+
+    while (item_cp != ECMA_NULL_POINTER)
+    {
+      ecma_native_info_object_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_native_info_object_t, item_cp);
+      ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, item_p->object_cp);
+      item_cp = item_p->next_cp;
+
+      native_pointer_p = ecma_get_native_pointer_value (object_p, LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER);
+      JERRY_ASSERT (native_pointer_p != NULL
+                    && ((const jerry_object_native_info_t *) native_pointer_p->u.info_p) == native_info_p);
+
+      if (!foreach_p (ecma_make_object_value (object_p), native_pointer_p->data_p, user_data_p))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
 
   for (ecma_object_t *iter_p = JERRY_CONTEXT (ecma_gc_objects_p);
        iter_p != NULL;
@@ -2621,6 +2805,98 @@ jerry_set_object_native_pointer (const jerry_value_t obj_val, /**< object to set
   }
 } /* jerry_set_object_native_pointer */
 
+/**
+ * Register a native type info for fast enumeration.
+ *
+ * Note:
+ *      the objects which have the registered type info are tracked on
+ *      a list, so jerry_objects_foreach_by_native_info does not need to
+ *      walk all objects of the heap for this type info. Registering a
+ *      type info walks the heap once, and each object using this type
+ *      info needs a small list item.
+ */
+void
+jerry_register_object_native_info (const jerry_object_native_info_t *native_info_p) /**< native type info */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (native_info_p != NULL);
+
+  ecma_register_native_info ((void *) native_info_p);
+} /* jerry_register_object_native_info */
+
+/**
+ * Create a weak reference to an object. Unlike acquired values, a weak
+ * reference does not prevent the garbage collector from freeing the object.
+ *
+ * Note:
+ *      the weak reference must be freed with jerry_free_weak_ref,
+ *      or it is freed by jerry_cleanup
+ *
+ * @return pointer to the weak reference - if obj_val is an object
+ *         NULL - otherwise
+ */
+jerry_weak_ref_t *
+jerry_create_weak_ref (const jerry_value_t obj_val, /**< object value */
+                       jerry_weak_ref_callback_t callback_p, /**< callback which is called when the object
+                                                              *   is freed (can be NULL) */
+                       void *user_p) /**< argument of the callback */
+{
+  jerry_assert_api_available ();
+
+  jerry_value_t obj_value = jerry_get_arg_value (obj_val);
+
+  if (!ecma_is_value_object (obj_value))
+  {
+    return NULL;
+  }
+
+  return (jerry_weak_ref_t *) ecma_create_weak_ref (ecma_get_object_from_value (obj_value),
+                                                    callback_p,
+                                                    user_p);
+} /* jerry_create_weak_ref */
+
+/**
+ * Get the target object of a weak reference.
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return the object - if it is still alive
+ *         undefined - if the object is freed by the garbage collector
+ */
+jerry_value_t
+jerry_get_weak_ref_value (const jerry_weak_ref_t *weak_ref_p) /**< weak reference */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (weak_ref_p != NULL);
+
+  ecma_object_t *object_p = ((const ecma_weak_ref_t *) weak_ref_p)->object_p;
+
+  if (object_p == NULL)
+  {
+    return ECMA_VALUE_UNDEFINED;
+  }
+
+  ecma_ref_object (object_p);
+  return ecma_make_object_value (object_p);
+} /* jerry_get_weak_ref_value */
+
+/**
+ * Free a weak reference. The callback of the weak reference is not called
+ * after this function returns.
+ */
+void
+jerry_free_weak_ref (jerry_weak_ref_t *weak_ref_p) /**< weak reference */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (weak_ref_p != NULL);
+
+  ecma_free_weak_ref ((ecma_weak_ref_t *) weak_ref_p);
+} /* jerry_free_weak_ref */
+
 /**
  * Applies the given function to the every property in the object.
  *
@@ -2850,6 +3126,53 @@ jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, /**< per
 #endif /* JERRY_VM_EXEC_STOP */
 } /* jerry_set_vm_exec_stop_callback */
 
+/**
+ * If JERRY_QUOTAS is defined, set the execution and memory quotas of the current instance.
+ * Zero fields of the quotas mean no limit. The number of backward jumps and function
+ * calls is counted from zero again.
+ *
+ * When a quota is exceeded, the engine throws a RangeError with the abort flag set,
+ * which cannot be caught by the script. The branch quota remains exceeded until
+ * the quotas are set again.
+ *
+ * Note:
+ *      the heap usage is checked at backward jumps and function calls, and a garbage
+ *      collection is performed before the quota is reported as exceeded. Allocations
+ *      between two checks may exceed the heap limit, so it should be lower than the
+ *      size of the heap.
+ */
+void
+jerry_set_quotas (const jerry_quotas_t *quotas_p) /**< quotas */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_QUOTAS
+  JERRY_CONTEXT (quota_heap_limit) = (quotas_p->heap_limit != 0) ? quotas_p->heap_limit : SIZE_MAX;
+  JERRY_CONTEXT (quota_branch_limit) = quotas_p->branch_limit;
+
+  /* The counter is decremented before it is checked, so branch_limit branches
+   * are allowed if it starts from branch_limit + 1 (saturated at UINT32_MAX). */
+  uint32_t branch_counter = UINT32_MAX;
+
+  if (quotas_p->branch_limit != 0 && quotas_p->branch_limit < UINT32_MAX)
+  {
+    branch_counter = quotas_p->branch_limit + 1;
+  }
+
+  JERRY_CONTEXT (quota_branch_counter) = branch_counter;
+  JERRY_CONTEXT (quota_branch_deferred) = 0;
+  JERRY_CONTEXT (quota_call_depth_limit) = ((quotas_p->call_depth_limit != 0) ? quotas_p->call_depth_limit
+                                                                               : UINT32_MAX);
+
+  if (JERRY_CONTEXT (jmem_heap_allocated_size) > JERRY_CONTEXT (quota_heap_limit))
+  {
+    jmem_heap_request_quota_check ();
+  }
+#else /* !JERRY_QUOTAS */
+  JERRY_UNUSED (quotas_p);
+#endif /* JERRY_QUOTAS */
+} /* jerry_set_quotas */
+
 /**
  * Get backtrace. The backtrace is an array of strings where
  * each string contains the position of the corresponding frame.
@@ -3074,7 +3397,8 @@ jerry_get_arraybuffer_byte_length (const jerry_value_t value) /**< ArrayBuffer *
  * Get a pointer for the start of the ArrayBuffer.
  *
  * Note:
- *    * Only valid for ArrayBuffers created with jerry_create_arraybuffer_external.
+ *    * Only valid for ArrayBuffers created with jerry_create_arraybuffer_external, or
+ *      ArrayBuffers whose data is allocated by jerry_port_arraybuffer_alloc.
  *    * This is a high-risk operation as the bounds are not checked
  *      when accessing the pointer elements.
  *    * jerry_release_value must be called on the ArrayBuffer when the pointer is no longer needed.
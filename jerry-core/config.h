@@ -60,6 +60,26 @@
  */
 #define CONFIG_MEM_HEAP_DESIRED_LIMIT (JERRY_MIN (CONFIG_MEM_HEAP_AREA_SIZE / 32, CONFIG_MEM_HEAP_MAX_LIMIT))
 
+/**
+ * Minimum size of ArrayBuffers whose data is allocated by the port
+ * (see also: jerry_port_arraybuffer_alloc) instead of the heap.
+ *
+ * Only used if JERRY_ARRAYBUFFER_PORT_ALLOCATOR is defined.
+ */
+#ifndef CONFIG_ECMA_ARRAYBUFFER_PORT_ALLOC_THRESHOLD
+# define CONFIG_ECMA_ARRAYBUFFER_PORT_ALLOC_THRESHOLD (4 * 1024)
+#endif /* !CONFIG_ECMA_ARRAYBUFFER_PORT_ALLOC_THRESHOLD */
+
+/**
+ * Amount of ArrayBuffer data allocated by the port, after reaching which
+ * a garbage collection is started before the next port allocation.
+ *
+ * Only used if JERRY_ARRAYBUFFER_PORT_ALLOCATOR is defined.
+ */
+#ifndef CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT
+# define CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT (CONFIG_MEM_HEAP_AREA_SIZE)
+#endif /* !CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT */
+
 /**
  * Use 32-bit/64-bit float for ecma-numbers
  */
@@ -90,6 +110,16 @@
  */
 // #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 
+/**
+ * Disable the cache of constructor prototypes and instance sizes
+ */
+// #define CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+
+/**
+ * Disable the element store of ordinary objects
+ */
+// #define CONFIG_ECMA_ELEMENT_STORE_DISABLE
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
@@ -99,4 +129,39 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC (16)
 
+/**
+ * Maximum number of bytes kept by the allocator for reusing freed property pairs,
+ * and the same amount for reusing freed extended objects. The blocks which are
+ * not reused until the next garbage collection are returned to the heap, and
+ * all kept blocks are returned when memory is low.
+ *
+ * Recycling is disabled if the limit is zero.
+ */
+#ifndef CONFIG_ECMA_RECYCLE_LIMIT
+# define CONFIG_ECMA_RECYCLE_LIMIT (CONFIG_MEM_HEAP_DESIRED_LIMIT / 2)
+#endif /* !CONFIG_ECMA_RECYCLE_LIMIT */
+
+/**
+ * Maximum number of frames recorded by the backtrace of error objects when
+ * line info is enabled. The recorded frames are converted to the array of
+ * the "stack" property when the property is first accessed.
+ *
+ * The depth is unlimited if the value is zero.
+ */
+#ifndef CONFIG_ECMA_ERROR_BACKTRACE_DEPTH
+# define CONFIG_ECMA_ERROR_BACKTRACE_DEPTH (32)
+#endif /* !CONFIG_ECMA_ERROR_BACKTRACE_DEPTH */
+
+/**
+ * Number of calls and backward branches of a function, after which it is
+ * compiled to native code by the baseline JIT compiler.
+ *
+ * Every function is compiled before its first run if the value is zero.
+ *
+ * Only used if JERRY_JIT is defined.
+ */
+#ifndef CONFIG_VM_JIT_THRESHOLD
+# define CONFIG_VM_JIT_THRESHOLD (1000)
+#endif /* !CONFIG_VM_JIT_THRESHOLD */
+
 #endif /* !CONFIG_H */
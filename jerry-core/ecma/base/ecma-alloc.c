@@ -17,6 +17,7 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jmem.h"
 
@@ -50,6 +51,103 @@ JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <=
  *     else - shutdown engine.
  */
 
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+
+/**
+ * Maximum number of recycled property pairs.
+ */
+#define ECMA_RECYCLED_PROPERTY_PAIRS_LIMIT (CONFIG_ECMA_RECYCLE_LIMIT / sizeof (ecma_property_pair_t))
+
+/**
+ * Maximum number of recycled extended objects.
+ */
+#define ECMA_RECYCLED_EXTENDED_OBJECTS_LIMIT (CONFIG_ECMA_RECYCLE_LIMIT / sizeof (ecma_extended_object_t))
+
+/**
+ * Take a block from a recycle list.
+ *
+ * @return pointer to the block - if the list is not empty
+ *         NULL - otherwise
+ */
+static inline void * JERRY_ATTR_ALWAYS_INLINE
+ecma_recycle_take (jmem_pools_chunk_t **list_p, /**< [in,out] recycle list */
+                   uint32_t *count_p) /**< [in,out] number of blocks in the list */
+{
+  jmem_pools_chunk_t *chunk_p = *list_p;
+
+  if (chunk_p != NULL)
+  {
+    *list_p = chunk_p->next_p;
+    (*count_p)--;
+  }
+
+  return chunk_p;
+} /* ecma_recycle_take */
+
+/**
+ * Put a freed block onto a recycle list unless the list is full.
+ *
+ * @return true - if the block is kept for reuse
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_recycle_put (jmem_pools_chunk_t **list_p, /**< [in,out] recycle list */
+                  uint32_t *count_p, /**< [in,out] number of blocks in the list */
+                  uint32_t limit, /**< maximum number of blocks in the list */
+                  void *block_p) /**< freed block */
+{
+  if (*count_p >= limit)
+  {
+    return false;
+  }
+
+  jmem_pools_chunk_t *chunk_p = (jmem_pools_chunk_t *) block_p;
+
+  chunk_p->next_p = *list_p;
+  *list_p = chunk_p;
+  (*count_p)++;
+  return true;
+} /* ecma_recycle_put */
+
+/**
+ * Return the blocks of a recycle list to the heap.
+ */
+static void
+ecma_recycle_release (jmem_pools_chunk_t **list_p, /**< [in,out] recycle list */
+                      uint32_t *count_p, /**< [out] number of blocks in the list */
+                      size_t size) /**< size of the blocks */
+{
+  jmem_pools_chunk_t *chunk_p = *list_p;
+
+  *list_p = NULL;
+  *count_p = 0;
+
+  while (chunk_p != NULL)
+  {
+    jmem_pools_chunk_t *next_p = chunk_p->next_p;
+    jmem_heap_free_block (chunk_p, size);
+    chunk_p = next_p;
+  }
+} /* ecma_recycle_release */
+
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
+/**
+ * Return the freed property pairs and extended objects kept for reuse to the heap.
+ */
+void
+ecma_free_recycled_blocks (void)
+{
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  ecma_recycle_release (&JERRY_CONTEXT (ecma_recycled_property_pairs_p),
+                        &JERRY_CONTEXT (ecma_recycled_property_pairs_count),
+                        sizeof (ecma_property_pair_t));
+  ecma_recycle_release (&JERRY_CONTEXT (ecma_recycled_extended_objects_p),
+                        &JERRY_CONTEXT (ecma_recycled_extended_objects_count),
+                        sizeof (ecma_extended_object_t));
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+} /* ecma_free_recycled_blocks */
+
 /**
  * Template of an allocation routine.
  */
@@ -122,6 +220,19 @@ ecma_alloc_extended_object (size_t size) /**< size of object */
   jmem_stats_allocate_object_bytes (size);
 #endif /* JMEM_STATS */
 
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  if (size == sizeof (ecma_extended_object_t))
+  {
+    void *block_p = ecma_recycle_take (&JERRY_CONTEXT (ecma_recycled_extended_objects_p),
+                                       &JERRY_CONTEXT (ecma_recycled_extended_objects_count));
+
+    if (block_p != NULL)
+    {
+      return (ecma_extended_object_t *) block_p;
+    }
+  }
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
   return jmem_heap_alloc_block (size);
 } /* ecma_alloc_extended_object */
 
@@ -136,6 +247,17 @@ ecma_dealloc_extended_object (ecma_object_t *object_p, /**< extended object */
   jmem_stats_free_object_bytes (size);
 #endif /* JMEM_STATS */
 
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  if (size == sizeof (ecma_extended_object_t)
+      && ecma_recycle_put (&JERRY_CONTEXT (ecma_recycled_extended_objects_p),
+                           &JERRY_CONTEXT (ecma_recycled_extended_objects_count),
+                           ECMA_RECYCLED_EXTENDED_OBJECTS_LIMIT,
+                           object_p))
+  {
+    return;
+  }
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
   jmem_heap_free_block (object_p, size);
 } /* ecma_dealloc_extended_object */
 
@@ -237,6 +359,16 @@ ecma_alloc_property_pair (void)
   jmem_stats_allocate_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* JMEM_STATS */
 
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  void *block_p = ecma_recycle_take (&JERRY_CONTEXT (ecma_recycled_property_pairs_p),
+                                     &JERRY_CONTEXT (ecma_recycled_property_pairs_count));
+
+  if (block_p != NULL)
+  {
+    return (ecma_property_pair_t *) block_p;
+  }
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
   return jmem_heap_alloc_block (sizeof (ecma_property_pair_t));
 } /* ecma_alloc_property_pair */
 
@@ -250,6 +382,16 @@ ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property
   jmem_stats_free_property_bytes (sizeof (ecma_property_pair_t));
 #endif /* JMEM_STATS */
 
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  if (ecma_recycle_put (&JERRY_CONTEXT (ecma_recycled_property_pairs_p),
+                        &JERRY_CONTEXT (ecma_recycled_property_pairs_count),
+                        ECMA_RECYCLED_PROPERTY_PAIRS_LIMIT,
+                        property_pair_p))
+  {
+    return;
+  }
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
   jmem_heap_free_block (property_pair_p, sizeof (ecma_property_pair_t));
 } /* ecma_dealloc_property_pair */
 
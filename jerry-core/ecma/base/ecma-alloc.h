@@ -109,6 +109,11 @@ ecma_property_pair_t *ecma_alloc_property_pair (void);
  */
 void ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p);
 
+/**
+ * Return the freed blocks kept for reuse to the heap
+ */
+void ecma_free_recycled_blocks (void);
+
 /**
  * @}
  * @}
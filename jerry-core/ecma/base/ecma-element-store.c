@@ -0,0 +1,483 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-element-store.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaelementstore Element store
+ * @{
+ */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
+                     element_values_must_be_accessible_as_property_values);
+
+/**
+ * Number of slots of a newly created element store.
+ */
+#define ECMA_ELEMENT_STORE_MINIMUM_SIZE 2
+
+/**
+ * Compute the total size of an element store.
+ */
+#define ECMA_ELEMENT_STORE_GET_TOTAL_SIZE(slot_count) \
+  (sizeof (ecma_element_store_t) + (slot_count) * (sizeof (uint32_t) + sizeof (ecma_value_t)))
+
+/**
+ * Compute the slot where the search for an index starts.
+ *
+ * @return slot index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_element_store_hash (uint32_t index, /**< array index */
+                         uint32_t size) /**< number of slots */
+{
+  /* Consecutive indices are spread over the whole store, and the
+   * upper bits of the hash are mapped to the [0, size) range. */
+  uint32_t hash = index * 0x9e3779b1u;
+  return (uint32_t) (((uint64_t) hash * size) >> 32);
+} /* ecma_element_store_hash */
+
+/**
+ * Get the next slot of a probe sequence.
+ *
+ * @return slot index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_element_store_next_slot (uint32_t slot, /**< slot index */
+                              uint32_t size) /**< number of slots */
+{
+  return (slot + 1 < size) ? slot + 1 : 0;
+} /* ecma_element_store_next_slot */
+
+/**
+ * Get the number of probe steps between two slots.
+ *
+ * @return number of steps
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_element_store_distance (uint32_t from_slot, /**< first slot */
+                             uint32_t to_slot, /**< last slot */
+                             uint32_t size) /**< number of slots */
+{
+  return (to_slot >= from_slot) ? to_slot - from_slot : to_slot + size - from_slot;
+} /* ecma_element_store_distance */
+
+/**
+ * Get the element store of an object.
+ *
+ * @return pointer to the element store - if the object has one
+ *         NULL - otherwise
+ */
+inline ecma_element_store_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_get_element_store (const ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  if (object_p->property_list_or_bound_object_cp == ECMA_NULL_POINTER)
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                        object_p->property_list_or_bound_object_cp);
+
+  if (first_property_p->types[0] != ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    return NULL;
+  }
+
+  return (ecma_element_store_t *) first_property_p;
+} /* ecma_get_element_store */
+
+/**
+ * Find the value of an element.
+ *
+ * @return pointer to the value of the element - if the element is found
+ *         NULL - otherwise
+ */
+ecma_value_t *
+ecma_element_store_find (ecma_element_store_t *store_p, /**< element store */
+                         uint32_t index) /**< array index */
+{
+  JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
+
+  uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+  uint32_t size = store_p->size;
+  uint32_t slot = ecma_element_store_hash (index, size);
+
+  /* At least one slot is always unused, so the search terminates. */
+  while (keys_p[slot] != index)
+  {
+    if (keys_p[slot] == ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      return NULL;
+    }
+
+    slot = ecma_element_store_next_slot (slot, size);
+  }
+
+  return ECMA_ELEMENT_STORE_VALUES (store_p) + slot;
+} /* ecma_element_store_find */
+
+/**
+ * Find the value of an element of an object by its property name.
+ *
+ * @return pointer to the value of the element - if the element is found
+ *         NULL - otherwise
+ */
+ecma_value_t *
+ecma_element_store_find_by_name (ecma_object_t *object_p, /**< object */
+                                 ecma_string_t *name_p) /**< property name */
+{
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  if (store_p == NULL)
+  {
+    return NULL;
+  }
+
+  uint32_t index = ecma_string_get_array_index (name_p);
+
+  if (index == ECMA_STRING_NOT_ARRAY_INDEX)
+  {
+    return NULL;
+  }
+
+  return ecma_element_store_find (store_p, index);
+} /* ecma_element_store_find_by_name */
+
+/**
+ * Allocate an element store and move the elements of the old store into it.
+ *
+ * @return pointer to the new element store - if the allocation is successful
+ *         NULL - otherwise
+ */
+static ecma_element_store_t *
+ecma_element_store_resize (ecma_element_store_t *old_store_p, /**< old element store or NULL */
+                           uint32_t slot_count) /**< number of slots */
+{
+  JERRY_ASSERT (slot_count >= ECMA_ELEMENT_STORE_MINIMUM_SIZE);
+
+  size_t total_size = ECMA_ELEMENT_STORE_GET_TOTAL_SIZE (slot_count);
+  ecma_element_store_t *store_p = (ecma_element_store_t *) jmem_heap_alloc_block_null_on_error (total_size);
+
+  if (store_p == NULL)
+  {
+    return NULL;
+  }
+
+#ifdef JMEM_STATS
+  jmem_stats_allocate_property_bytes (total_size);
+#endif /* JMEM_STATS */
+
+  store_p->header.types[0] = ECMA_PROPERTY_TYPE_ELEMENTS;
+  store_p->header.types[1] = 0;
+  store_p->header.next_property_cp = ECMA_NULL_POINTER;
+  store_p->count = 0;
+  store_p->size = slot_count;
+
+  uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+  memset (keys_p, 0xff, slot_count * sizeof (uint32_t));
+
+  if (old_store_p == NULL)
+  {
+    return store_p;
+  }
+
+  ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+  uint32_t *old_keys_p = ECMA_ELEMENT_STORE_KEYS (old_store_p);
+  ecma_value_t *old_values_p = ECMA_ELEMENT_STORE_VALUES (old_store_p);
+
+  for (uint32_t i = 0; i < old_store_p->size; i++)
+  {
+    if (old_keys_p[i] != ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      uint32_t slot = ecma_element_store_hash (old_keys_p[i], slot_count);
+
+      while (keys_p[slot] != ECMA_STRING_NOT_ARRAY_INDEX)
+      {
+        slot = ecma_element_store_next_slot (slot, slot_count);
+      }
+
+      keys_p[slot] = old_keys_p[i];
+      values_p[slot] = old_values_p[i];
+    }
+  }
+
+  store_p->header.next_property_cp = old_store_p->header.next_property_cp;
+  store_p->count = old_store_p->count;
+
+  size_t old_total_size = ECMA_ELEMENT_STORE_GET_TOTAL_SIZE (old_store_p->size);
+
+#ifdef JMEM_STATS
+  jmem_stats_free_property_bytes (old_total_size);
+#endif /* JMEM_STATS */
+
+  jmem_heap_free_block (old_store_p, old_total_size);
+  return store_p;
+} /* ecma_element_store_resize */
+
+/**
+ * Checks whether the property list of an object is large enough to have a property hashmap.
+ *
+ * @return true - if the property list has a hashmap
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_element_store_is_large_object (const ecma_object_t *object_p) /**< object */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_property_header_t *property_list_p = ecma_get_property_list (object_p);
+
+  return (property_list_p != NULL && property_list_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  JERRY_UNUSED (object_p);
+  return false;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_element_store_is_large_object */
+
+/**
+ * Insert a new element into the element store of an object. The
+ * element store is created when the object has no element store.
+ *
+ * Note:
+ *      only ordinary objects have element stores, and the caller must
+ *      ensure that the object has no property with the same name
+ *
+ * @return true - if the element is inserted
+ *         false - if the element must be stored as a named data property
+ */
+bool
+ecma_element_store_insert (ecma_object_t *object_p, /**< object */
+                           uint32_t index, /**< array index */
+                           ecma_value_t value) /**< value of the element */
+{
+  JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
+
+#ifndef CONFIG_ECMA_ELEMENT_STORE_DISABLE
+  if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL
+      || ecma_get_object_is_builtin (object_p))
+  {
+    return false;
+  }
+
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  /* Smaller indices are direct strings, and property pairs store them more compactly
+   * than the element store. They are only inserted when the object is already large. */
+  if (index <= ECMA_DIRECT_STRING_MAX_IMM
+      && store_p == NULL
+      && !ecma_element_store_is_large_object (object_p))
+  {
+    return false;
+  }
+
+  uint32_t slot_count = ECMA_ELEMENT_STORE_MINIMUM_SIZE;
+
+  if (store_p != NULL)
+  {
+    JERRY_ASSERT (ecma_element_store_find (store_p, index) == NULL);
+    slot_count = store_p->size;
+  }
+
+  /* At most seven eighths of the slots are used, so at least one slot is unused. */
+  if (store_p == NULL || (store_p->count + 1) * 8 > slot_count * 7)
+  {
+    if (store_p != NULL)
+    {
+      /* The store grows by half of its size to keep the memory overhead low. */
+      slot_count += slot_count >> 1;
+    }
+
+    ecma_element_store_t *new_store_p = ecma_element_store_resize (store_p, slot_count);
+
+    if (new_store_p == NULL)
+    {
+      return false;
+    }
+
+    if (store_p == NULL)
+    {
+      new_store_p->header.next_property_cp = object_p->property_list_or_bound_object_cp;
+    }
+
+    store_p = new_store_p;
+    ECMA_SET_NON_NULL_POINTER (object_p->property_list_or_bound_object_cp, store_p);
+  }
+
+  uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+  uint32_t slot = ecma_element_store_hash (index, store_p->size);
+
+  while (keys_p[slot] != ECMA_STRING_NOT_ARRAY_INDEX)
+  {
+    slot = ecma_element_store_next_slot (slot, store_p->size);
+  }
+
+  keys_p[slot] = index;
+  ECMA_ELEMENT_STORE_VALUES (store_p)[slot] = ecma_copy_value_if_not_object (value);
+  store_p->count++;
+  return true;
+#else /* CONFIG_ECMA_ELEMENT_STORE_DISABLE */
+  JERRY_UNUSED (object_p);
+  JERRY_UNUSED (value);
+  return false;
+#endif /* !CONFIG_ECMA_ELEMENT_STORE_DISABLE */
+} /* ecma_element_store_insert */
+
+/**
+ * Remove an element from the element store of an object. The
+ * element store is freed when its last element is removed.
+ *
+ * Note:
+ *      the value of the element is not freed, and the value
+ *      pointers of the other elements may change
+ */
+void
+ecma_element_store_delete (ecma_object_t *object_p, /**< object */
+                           ecma_value_t *value_p) /**< value of the element */
+{
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  JERRY_ASSERT (store_p != NULL && store_p->count > 0);
+
+  uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+  ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+  uint32_t size = store_p->size;
+  uint32_t slot = (uint32_t) (value_p - values_p);
+
+  JERRY_ASSERT (slot < size && keys_p[slot] != ECMA_STRING_NOT_ARRAY_INDEX);
+
+  if (--store_p->count == 0)
+  {
+    ecma_element_store_free (object_p);
+    return;
+  }
+
+  /* Move back the following elements of the probe sequence which
+   * cannot be found anymore when the slot becomes unused. */
+  uint32_t next_slot = slot;
+
+  while (true)
+  {
+    next_slot = ecma_element_store_next_slot (next_slot, size);
+
+    if (keys_p[next_slot] == ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      break;
+    }
+
+    uint32_t home_slot = ecma_element_store_hash (keys_p[next_slot], size);
+
+    if (ecma_element_store_distance (home_slot, next_slot, size)
+        >= ecma_element_store_distance (slot, next_slot, size))
+    {
+      keys_p[slot] = keys_p[next_slot];
+      values_p[slot] = values_p[next_slot];
+      slot = next_slot;
+    }
+  }
+
+  keys_p[slot] = ECMA_STRING_NOT_ARRAY_INDEX;
+} /* ecma_element_store_delete */
+
+/**
+ * Free the element store of an object and the values of its elements.
+ *
+ * Note:
+ *      only the values which are not freed by the caller are released,
+ *      i.e. the store must be empty or the object must be freed by the gc
+ */
+void
+ecma_element_store_free (ecma_object_t *object_p) /**< object */
+{
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  JERRY_ASSERT (store_p != NULL);
+
+  if (store_p->count > 0)
+  {
+    uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+    ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+
+    for (uint32_t i = 0; i < store_p->size; i++)
+    {
+      if (keys_p[i] != ECMA_STRING_NOT_ARRAY_INDEX)
+      {
+        ecma_free_value_if_not_object (values_p[i]);
+      }
+    }
+  }
+
+  object_p->property_list_or_bound_object_cp = store_p->header.next_property_cp;
+
+  size_t total_size = ECMA_ELEMENT_STORE_GET_TOTAL_SIZE (store_p->size);
+
+#ifdef JMEM_STATS
+  jmem_stats_free_property_bytes (total_size);
+#endif /* JMEM_STATS */
+
+  jmem_heap_free_block (store_p, total_size);
+} /* ecma_element_store_free */
+
+/**
+ * Get the size of an element store.
+ *
+ * @return size of the allocated block in bytes
+ */
+size_t
+ecma_element_store_get_size (ecma_element_store_t *store_p) /**< element store */
+{
+  return ECMA_ELEMENT_STORE_GET_TOTAL_SIZE (store_p->size);
+} /* ecma_element_store_get_size */
+
+/**
+ * Append the names of the elements of an object to a collection.
+ *
+ * Note:
+ *      elements are always enumerable, and the names are not sorted
+ */
+void
+ecma_element_store_list_names (ecma_object_t *object_p, /**< object */
+                               ecma_collection_header_t *prop_names_p) /**< collection of property names */
+{
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  if (store_p == NULL)
+  {
+    return;
+  }
+
+  uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+
+  for (uint32_t i = 0; i < store_p->size; i++)
+  {
+    if (keys_p[i] != ECMA_STRING_NOT_ARRAY_INDEX)
+    {
+      ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (keys_p[i]);
+      ecma_append_to_values_collection (prop_names_p, ecma_make_string_value (name_p), 0);
+      ecma_deref_ecma_string (name_p);
+    }
+  }
+} /* ecma_element_store_list_names */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,76 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_ELEMENT_STORE_H
+#define ECMA_ELEMENT_STORE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaelementstore Element store
+ * @{
+ */
+
+/**
+ * Element store of an ordinary object.
+ *
+ * The element store keeps the configurable, enumerable and writable data
+ * properties of an object whose names are array indices, so they can be
+ * found without creating a property name. The store is always the first
+ * item of the property list, and a property name is either in the element
+ * store or in the rest of the property list.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header of the property */
+  uint32_t count; /**< number of elements */
+  uint32_t size; /**< number of slots */
+
+  /*
+   * The store is followed by size uint32_t keys and size
+   * ecma_value_t values. Unused slots have ECMA_STRING_NOT_ARRAY_INDEX
+   * keys, and the slots are searched with linear probing.
+   */
+} ecma_element_store_t;
+
+/**
+ * Get the keys of an element store.
+ */
+#define ECMA_ELEMENT_STORE_KEYS(store_p) \
+  ((uint32_t *) ((store_p) + 1))
+
+/**
+ * Get the values of an element store.
+ */
+#define ECMA_ELEMENT_STORE_VALUES(store_p) \
+  ((ecma_value_t *) (ECMA_ELEMENT_STORE_KEYS (store_p) + (store_p)->size))
+
+ecma_element_store_t *ecma_get_element_store (const ecma_object_t *object_p);
+ecma_value_t *ecma_element_store_find (ecma_element_store_t *store_p, uint32_t index);
+ecma_value_t *ecma_element_store_find_by_name (ecma_object_t *object_p, ecma_string_t *name_p);
+bool ecma_element_store_insert (ecma_object_t *object_p, uint32_t index, ecma_value_t value);
+void ecma_element_store_delete (ecma_object_t *object_p, ecma_value_t *value_p);
+void ecma_element_store_free (ecma_object_t *object_p);
+size_t ecma_element_store_get_size (ecma_element_store_t *store_p);
+void ecma_element_store_list_names (ecma_object_t *object_p, ecma_collection_header_t *prop_names_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_ELEMENT_STORE_H */
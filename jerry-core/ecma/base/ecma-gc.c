@@ -18,6 +18,8 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-element-store.h"
+#include "ecma-function-object.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -27,11 +29,14 @@
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
+#include "jrt-tracepoints.h"
 #include "re-compiler.h"
+#include "vm.h"
 #include "vm-defines.h"
 #include "vm-stack.h"
 
 #ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+#include "ecma-arraybuffer-object.h"
 #include "ecma-typedarray-object.h"
 #endif
 #ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
@@ -130,15 +135,28 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 void
 ecma_ref_object (ecma_object_t *object_p) /**< object */
 {
-  if (JERRY_LIKELY (object_p->type_flags_refs < ECMA_OBJECT_MAX_REF))
+  if (JERRY_UNLIKELY (object_p->type_flags_refs >= ECMA_OBJECT_MAX_REF))
   {
-    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+    ecma_ref_overflow_spill (object_p, ECMA_OBJECT_SPILL_REFS);
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs
+                                            - (ECMA_OBJECT_SPILL_REFS * ECMA_OBJECT_REF_ONE));
   }
-  else
+
+  object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+} /* ecma_ref_object */
+
+/**
+ * Move the spilled references of an object back from the reference overflow table.
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_refill_object_refs (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_ref_overflow_refill (object_p, ECMA_OBJECT_SPILL_REFS))
   {
-    jerry_fatal (ERR_REF_COUNT_LIMIT);
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs
+                                            + (ECMA_OBJECT_SPILL_REFS * ECMA_OBJECT_REF_ONE));
   }
-} /* ecma_ref_object */
+} /* ecma_refill_object_refs */
 
 /**
  * Decrease reference counter of an object
@@ -147,6 +165,13 @@ inline void JERRY_ATTR_ALWAYS_INLINE
 ecma_deref_object (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+
+  /* The references of the object may have been spilled only if the counter is above the refill limit. */
+  if (JERRY_UNLIKELY ((uint32_t) (object_p->type_flags_refs - ECMA_OBJECT_REFILL_LIMIT) < ECMA_OBJECT_REF_ONE))
+  {
+    ecma_refill_object_refs (object_p);
+  }
+
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs - ECMA_OBJECT_REF_ONE);
 } /* ecma_deref_object */
 
@@ -385,6 +410,25 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
   if (traverse_properties)
   {
+    if (!ecma_is_lexical_environment (object_p))
+    {
+      ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+      if (store_p != NULL)
+      {
+        uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+        ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+
+        for (uint32_t i = 0; i < store_p->size; i++)
+        {
+          if (keys_p[i] != ECMA_STRING_NOT_ARRAY_INDEX && ecma_is_value_object (values_p[i]))
+          {
+            ecma_gc_set_object_visited (ecma_get_object_from_value (values_p[i]));
+          }
+        }
+      }
+    }
+
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
     if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
@@ -406,6 +450,155 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   }
 } /* ecma_gc_mark */
 
+/**
+ * Call a native free callback.
+ */
+static void
+ecma_gc_call_finalizer (const ecma_finalizer_t *finalizer_p, /**< finalizer */
+                        bool is_handle) /**< true - if the callback belongs to a native handle */
+{
+  if (is_handle)
+  {
+    finalizer_p->u.handle_cb ((uintptr_t) finalizer_p->data_p);
+  }
+  else
+  {
+    finalizer_p->u.native_cb (finalizer_p->data_p);
+  }
+} /* ecma_gc_call_finalizer */
+
+/**
+ * Call a native free callback, or append it to the deferred finalizer queue
+ * if the engine was initialized with ECMA_INIT_DEFERRED_FINALIZERS.
+ *
+ * Note:
+ *      the callback is called immediately if the queue cannot be extended,
+ *      since the garbage collector cannot run itself to free up memory
+ */
+static void
+ecma_gc_run_or_defer_finalizer (const ecma_finalizer_t *finalizer_p, /**< finalizer */
+                                bool is_handle) /**< true - if the callback belongs to a native handle */
+{
+  if (JERRY_CONTEXT (jerry_init_flags) & ECMA_INIT_DEFERRED_FINALIZERS)
+  {
+    ecma_finalizer_block_t *block_p = JERRY_CONTEXT (finalizer_last_block_p);
+
+    if (block_p == NULL || block_p->end == ECMA_FINALIZER_BLOCK_SIZE)
+    {
+      ecma_finalizer_block_t *new_block_p;
+      new_block_p = (ecma_finalizer_block_t *) jmem_heap_alloc_block_no_gc (sizeof (ecma_finalizer_block_t));
+
+      if (new_block_p != NULL)
+      {
+        new_block_p->next_p = NULL;
+        new_block_p->first = 0;
+        new_block_p->end = 0;
+        new_block_p->handle_bits = 0;
+
+        if (block_p == NULL)
+        {
+          JERRY_CONTEXT (finalizer_first_block_p) = new_block_p;
+        }
+        else
+        {
+          block_p->next_p = new_block_p;
+        }
+
+        JERRY_CONTEXT (finalizer_last_block_p) = new_block_p;
+      }
+
+      block_p = new_block_p;
+    }
+
+    if (JERRY_LIKELY (block_p != NULL))
+    {
+      if (is_handle)
+      {
+        block_p->handle_bits = (uint8_t) (block_p->handle_bits | (1u << block_p->end));
+      }
+
+      block_p->items[block_p->end++] = *finalizer_p;
+      JERRY_CONTEXT (finalizer_count)++;
+      return;
+    }
+  }
+
+  ecma_gc_call_finalizer (finalizer_p, is_handle);
+} /* ecma_gc_run_or_defer_finalizer */
+
+/**
+ * Call a native free callback of an object, or defer the call.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_free_native_data (ecma_object_native_free_callback_t free_cb, /**< native free callback */
+                          void *data_p) /**< argument of the callback */
+{
+  ecma_finalizer_t finalizer;
+  finalizer.data_p = data_p;
+  finalizer.u.native_cb = free_cb;
+
+  ecma_gc_run_or_defer_finalizer (&finalizer, false);
+} /* ecma_gc_free_native_data */
+
+/**
+ * Run the pending deferred finalizers in the order they were queued.
+ *
+ * Note:
+ *      a finalizer is removed from the queue before it is called, so
+ *      finalizers may run garbage collection and queue further finalizers
+ *
+ * @return number of finalizers which are still pending
+ */
+uint32_t
+ecma_gc_run_finalizers (uint32_t count_limit, /**< maximum number of finalizers to run, 0 - no limit */
+                        uint32_t time_limit) /**< time budget in milliseconds, 0 - no limit */
+{
+  double end_time = 0;
+
+  if (time_limit != 0)
+  {
+    end_time = jerry_port_get_current_time () + (double) time_limit;
+  }
+
+  uint32_t executed = 0;
+
+  while (JERRY_CONTEXT (finalizer_first_block_p) != NULL)
+  {
+    if ((count_limit != 0 && executed >= count_limit)
+        || (time_limit != 0 && executed != 0 && jerry_port_get_current_time () >= end_time))
+    {
+      break;
+    }
+
+    ecma_finalizer_block_t *block_p = JERRY_CONTEXT (finalizer_first_block_p);
+    JERRY_ASSERT (block_p->first < block_p->end);
+
+    uint32_t index = block_p->first++;
+    ecma_finalizer_t finalizer = block_p->items[index];
+    bool is_handle = (block_p->handle_bits & (1u << index)) != 0;
+
+    if (block_p->first == block_p->end)
+    {
+      JERRY_CONTEXT (finalizer_first_block_p) = block_p->next_p;
+
+      if (block_p->next_p == NULL)
+      {
+        JERRY_CONTEXT (finalizer_last_block_p) = NULL;
+      }
+
+      jmem_heap_free_block (block_p, sizeof (ecma_finalizer_block_t));
+    }
+
+    JERRY_ASSERT (JERRY_CONTEXT (finalizer_count) > 0);
+    JERRY_CONTEXT (finalizer_count)--;
+
+    ecma_gc_call_finalizer (&finalizer, is_handle);
+    executed++;
+  }
+
+  return JERRY_CONTEXT (finalizer_count);
+} /* ecma_gc_run_finalizers */
+
 /**
  * Free the native handle/pointer by calling its free callback.
  */
@@ -428,7 +621,11 @@ ecma_gc_free_native_pointer (ecma_property_t *property_p, /**< property */
   {
     if (native_pointer_p->u.callback_p != NULL)
     {
-      native_pointer_p->u.callback_p ((uintptr_t) native_pointer_p->data_p);
+      ecma_finalizer_t finalizer;
+      finalizer.data_p = native_pointer_p->data_p;
+      finalizer.u.handle_cb = native_pointer_p->u.callback_p;
+
+      ecma_gc_run_or_defer_finalizer (&finalizer, true);
     }
   }
   else
@@ -439,12 +636,110 @@ ecma_gc_free_native_pointer (ecma_property_t *property_p, /**< property */
 
       if (free_cb != NULL)
       {
-        free_cb (native_pointer_p->data_p);
+        ecma_gc_free_native_data (free_cb, native_pointer_p->data_p);
       }
     }
   }
 } /* ecma_gc_free_native_pointer */
 
+/**
+ * Remove the unmarked objects from the object lists of the registered native type infos.
+ */
+static void
+ecma_gc_sweep_native_info_registry (void)
+{
+  ecma_native_info_registry_t *registry_p = JERRY_CONTEXT (native_info_registry_p);
+
+  while (registry_p != NULL)
+  {
+    jmem_cpointer_t *item_cp_p = &registry_p->first_object_cp;
+
+    while (*item_cp_p != ECMA_NULL_POINTER)
+    {
+      ecma_native_info_object_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_native_info_object_t, *item_cp_p);
+      ecma_object_t *object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, item_p->object_cp);
+
+      if (ecma_gc_is_object_visited (object_p))
+      {
+        item_cp_p = &item_p->next_cp;
+        continue;
+      }
+
+      *item_cp_p = item_p->next_cp;
+      jmem_pools_free (item_p, sizeof (ecma_native_info_object_t));
+    }
+
+    registry_p = registry_p->next_p;
+  }
+} /* ecma_gc_sweep_native_info_registry */
+
+/**
+ * Clear the weak references whose objects are unmarked.
+ *
+ * All weak references are cleared before any callback is called, so the callbacks
+ * cannot observe the objects being freed. The callbacks may free any weak reference.
+ */
+static void
+ecma_gc_sweep_weak_refs (void)
+{
+  ecma_weak_ref_t *weak_ref_p = JERRY_CONTEXT (weak_refs_p);
+  bool has_callback = false;
+
+  while (weak_ref_p != NULL)
+  {
+    if (weak_ref_p->object_p != NULL && !ecma_gc_is_object_visited (weak_ref_p->object_p))
+    {
+      /* A cleared weak reference with a non-NULL callback has a pending callback. */
+      weak_ref_p->object_p = NULL;
+      has_callback |= (weak_ref_p->callback_p != NULL);
+    }
+
+    weak_ref_p = weak_ref_p->next_p;
+  }
+
+  if (!has_callback)
+  {
+    return;
+  }
+
+  /* The cursor is linked into the list, so it remains
+   * valid when a callback frees other weak references. */
+  ecma_weak_ref_t cursor;
+  cursor.object_p = NULL;
+  cursor.callback_p = NULL;
+  cursor.user_p = NULL;
+
+  weak_ref_p = JERRY_CONTEXT (weak_refs_p);
+
+  while (weak_ref_p != NULL)
+  {
+    ecma_object_native_free_callback_t callback_p = weak_ref_p->callback_p;
+
+    if (weak_ref_p->object_p != NULL || callback_p == NULL)
+    {
+      weak_ref_p = weak_ref_p->next_p;
+      continue;
+    }
+
+    weak_ref_p->callback_p = NULL;
+
+    cursor.prev_p = weak_ref_p;
+    cursor.next_p = weak_ref_p->next_p;
+
+    if (cursor.next_p != NULL)
+    {
+      cursor.next_p->prev_p = &cursor;
+    }
+
+    weak_ref_p->next_p = &cursor;
+
+    ecma_gc_free_native_data (callback_p, weak_ref_p->user_p);
+
+    weak_ref_p = cursor.next_p;
+    ecma_unlink_weak_ref (&cursor);
+  }
+} /* ecma_gc_sweep_weak_refs */
+
 /**
  * Free specified object.
  */
@@ -460,6 +755,11 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   if (obj_is_not_lex_env
       || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
   {
+    if (obj_is_not_lex_env && ecma_get_element_store (object_p) != NULL)
+    {
+      ecma_element_store_free (object_p);
+    }
+
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
     if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
@@ -470,12 +770,9 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 
     while (prop_iter_p != NULL)
     {
+      /* Both entries can be deleted if the object had a property hashmap. */
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
-      /* Both cannot be deleted. */
-      JERRY_ASSERT (prop_iter_p->types[0] != ECMA_PROPERTY_TYPE_DELETED
-                    || prop_iter_p->types[1] != ECMA_PROPERTY_TYPE_DELETED);
-
       ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
 
       for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
@@ -541,8 +838,21 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
         case LIT_MAGIC_STRING_UNDEFINED:
         case LIT_MAGIC_STRING_ARGUMENTS_UL:
         case LIT_MAGIC_STRING_BOOLEAN_UL:
+        {
+          break;
+        }
+
         case LIT_MAGIC_STRING_ERROR_UL:
         {
+#ifdef JERRY_ENABLE_LINE_INFO
+          ecma_backtrace_t *backtrace_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_backtrace_t,
+                                                                               ext_object_p->u.class_prop.u.value);
+
+          if (backtrace_p != NULL)
+          {
+            vm_free_backtrace (backtrace_p);
+          }
+#endif /* JERRY_ENABLE_LINE_INFO */
           break;
         }
 
@@ -553,6 +863,20 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
           break;
         }
 
+        case LIT_MAGIC_STRING_OBJECT_UL:
+        {
+          ecma_native_pointer_t *native_pointer_p = &((ecma_native_object_t *) object_p)->native_pointer;
+
+          if (native_pointer_p->u.info_p != NULL
+              && native_pointer_p->u.info_p->free_cb != NULL)
+          {
+            ecma_gc_free_native_data (native_pointer_p->u.info_p->free_cb, native_pointer_p->data_p);
+          }
+
+          ext_object_size = sizeof (ecma_native_object_t);
+          break;
+        }
+
         case LIT_MAGIC_STRING_DATE_UL:
         {
           ecma_number_t *num_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_number_t,
@@ -587,9 +911,17 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
             ecma_arraybuffer_external_info *array_p = (ecma_arraybuffer_external_info *) ext_object_p;
             JERRY_ASSERT (array_p != NULL);
 
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+            if (ECMA_ARRAYBUFFER_HAS_PORT_MEMORY (ext_object_p))
+            {
+              /* Port allocated buffers have no free callback. */
+              ecma_arraybuffer_free_port_memory (object_p);
+            }
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
             if (array_p->free_cb != NULL)
             {
-              (array_p->free_cb) (array_p->buffer_p);
+              ecma_gc_free_native_data (array_p->free_cb, array_p->buffer_p);
             }
           }
           else
@@ -760,20 +1092,16 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 } /* ecma_gc_free_object */
 
 /**
- * Run garbage collection
+ * Move the root objects (i.e. the objects whose reference counter is not zero)
+ * of the white-gray list to the black list and mark the objects referenced by them.
  */
-void
-ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
+static void
+ecma_gc_mark_root_objects (ecma_object_t **white_gray_objects_p, /**< [in, out] white-gray list */
+                           ecma_object_t **black_objects_p) /**< [in, out] black list */
 {
-  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
-
-  ecma_object_t *white_gray_objects_p = JERRY_CONTEXT (ecma_gc_objects_p);
-  ecma_object_t *black_objects_p = NULL;
-
-  ecma_object_t *obj_iter_p = white_gray_objects_p;
+  ecma_object_t *obj_iter_p = *white_gray_objects_p;
   ecma_object_t *obj_prev_p = NULL;
 
-  /* Move root objects (i.e. they have global or stack references) to the black list. */
   while (obj_iter_p != NULL)
   {
     ecma_object_t *obj_next_p = ecma_gc_get_object_next (obj_iter_p);
@@ -790,11 +1118,11 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
       }
       else
       {
-        white_gray_objects_p = obj_next_p;
+        *white_gray_objects_p = obj_next_p;
       }
 
-      ecma_gc_set_object_next (obj_iter_p, black_objects_p);
-      black_objects_p = obj_iter_p;
+      ecma_gc_set_object_next (obj_iter_p, *black_objects_p);
+      *black_objects_p = obj_iter_p;
     }
     else
     {
@@ -805,24 +1133,30 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
   }
 
   /* Mark root objects. */
-  obj_iter_p = black_objects_p;
+  obj_iter_p = *black_objects_p;
   while (obj_iter_p != NULL)
   {
     ecma_gc_mark (obj_iter_p);
     obj_iter_p = ecma_gc_get_object_next (obj_iter_p);
   }
+} /* ecma_gc_mark_root_objects */
 
-  ecma_object_t *first_root_object_p = black_objects_p;
-
-  /* Mark non-root objects. */
+/**
+ * Move the visited objects of the white-gray list to the black list and mark
+ * the objects referenced by them until no more objects can be reached.
+ */
+static void
+ecma_gc_mark_non_root_objects (ecma_object_t **white_gray_objects_p, /**< [in, out] white-gray list */
+                               ecma_object_t **black_objects_p) /**< [in, out] black list */
+{
   bool marked_anything_during_current_iteration;
 
   do
   {
     marked_anything_during_current_iteration = false;
 
-    obj_prev_p = NULL;
-    obj_iter_p = white_gray_objects_p;
+    ecma_object_t *obj_prev_p = NULL;
+    ecma_object_t *obj_iter_p = *white_gray_objects_p;
 
     while (obj_iter_p != NULL)
     {
@@ -840,11 +1174,11 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
         }
         else
         {
-          white_gray_objects_p = obj_next_p;
+          *white_gray_objects_p = obj_next_p;
         }
 
-        ecma_gc_set_object_next (obj_iter_p, black_objects_p);
-        black_objects_p = obj_iter_p;
+        ecma_gc_set_object_next (obj_iter_p, *black_objects_p);
+        *black_objects_p = obj_iter_p;
 
         ecma_gc_mark (obj_iter_p);
         marked_anything_during_current_iteration = true;
@@ -858,9 +1192,47 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
     }
   }
   while (marked_anything_during_current_iteration);
+} /* ecma_gc_mark_non_root_objects */
+
+/**
+ * Run garbage collection
+ */
+void
+ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
+{
+  size_t allocated_size = JERRY_CONTEXT (jmem_heap_allocated_size);
+  size_t objects_number = JERRY_CONTEXT (ecma_gc_objects_number);
+
+  JERRY_TRACEPOINT3 (gc__begin, severity, allocated_size, objects_number);
+
+  /* The blocks which were not reused since the previous collection are returned to the heap. */
+  ecma_free_recycled_blocks ();
+
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  ecma_object_t *white_gray_objects_p = JERRY_CONTEXT (ecma_gc_objects_p);
+  ecma_object_t *black_objects_p = NULL;
+
+  /* Move root objects (i.e. they have global or stack references) to the black list. */
+  ecma_gc_mark_root_objects (&white_gray_objects_p, &black_objects_p);
+
+  ecma_object_t *first_root_object_p = black_objects_p;
+
+  /* Mark non-root objects. */
+  ecma_gc_mark_non_root_objects (&white_gray_objects_p, &black_objects_p);
+
+  if (JERRY_CONTEXT (native_info_registry_p) != NULL)
+  {
+    ecma_gc_sweep_native_info_registry ();
+  }
+
+  if (JERRY_CONTEXT (weak_refs_p) != NULL)
+  {
+    ecma_gc_sweep_weak_refs ();
+  }
 
   /* Sweep objects that are currently unmarked. */
-  obj_iter_p = white_gray_objects_p;
+  ecma_object_t *obj_iter_p = white_gray_objects_p;
 
   while (obj_iter_p != NULL)
   {
@@ -907,12 +1279,521 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
 
   JERRY_CONTEXT (ecma_gc_objects_p) = black_objects_p;
 
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+  /* The cached functions might have been freed */
+  ecma_op_function_construct_cache_clear ();
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
   /* Free RegExp bytecodes stored in cache */
   re_cache_gc_run ();
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+
+  /* The collection may allocate memory (e.g. for deferred finalizers). */
+  size_t freed_size = 0;
+
+  if (allocated_size > JERRY_CONTEXT (jmem_heap_allocated_size))
+  {
+    freed_size = allocated_size - JERRY_CONTEXT (jmem_heap_allocated_size);
+  }
+
+  JERRY_TRACEPOINT2 (gc__end, freed_size, objects_number - JERRY_CONTEXT (ecma_gc_objects_number));
 } /* ecma_gc_run */
 
+/**
+ * Release (or restore) a reference of a string, which is held by a retained object,
+ * and get the number of bytes which are freed when the last reference of the string
+ * is released.
+ *
+ * Note:
+ *      the string is not freed when its reference counter becomes zero, and the
+ *      references are restored by calling this function again with is_restore set
+ *      to true for the same references
+ *
+ * @return size of the string in bytes, if all of its references are released
+ *         0 - otherwise
+ */
+static size_t
+ecma_gc_get_string_size (ecma_string_t *string_p, /**< ecma-string */
+                         bool is_restore) /**< restore the reference instead of releasing it */
+{
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    return 0;
+  }
+
+  if (is_restore)
+  {
+    if (string_p->refs_and_container < ECMA_STRING_REF_ONE)
+    {
+      string_p->refs_and_container = (uint16_t) (string_p->refs_and_container + ECMA_STRING_REF_ONE);
+    }
+    else
+    {
+      ecma_ref_ecma_string (string_p);
+    }
+    return 0;
+  }
+
+  JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
+
+  /* Same as ecma_deref_ecma_string, except that the string is not freed. */
+  if (JERRY_UNLIKELY ((uint32_t) (string_p->refs_and_container - ECMA_STRING_REFILL_LIMIT) < ECMA_STRING_REF_ONE)
+      && ecma_ref_overflow_refill (string_p, ECMA_STRING_SPILL_REFS))
+  {
+    string_p->refs_and_container = (uint16_t) (string_p->refs_and_container
+                                               + (ECMA_STRING_SPILL_REFS * ECMA_STRING_REF_ONE));
+  }
+
+  string_p->refs_and_container = (uint16_t) (string_p->refs_and_container - ECMA_STRING_REF_ONE);
+
+  if (string_p->refs_and_container >= ECMA_STRING_REF_ONE)
+  {
+    return 0;
+  }
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      return string_p->u.utf8_string.size + sizeof (ecma_string_t);
+    }
+    case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    {
+      return string_p->u.long_utf8_string_size + sizeof (ecma_long_string_t);
+    }
+    case ECMA_STRING_LITERAL_NUMBER:
+    {
+      if (ecma_is_value_float_number (string_p->u.lit_number))
+      {
+        return sizeof (ecma_string_t) + sizeof (ecma_number_t);
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return sizeof (ecma_string_t);
+} /* ecma_gc_get_string_size */
+
+/**
+ * Get the number of bytes which are owned by a non-object value.
+ *
+ * @return size of the value in bytes
+ */
+static size_t
+ecma_gc_get_value_size (ecma_value_t value, /**< value */
+                        bool is_restore) /**< restore the string references (see ecma_gc_get_string_size) */
+{
+  if (ecma_is_value_float_number (value))
+  {
+    return sizeof (ecma_number_t);
+  }
+
+  if (ecma_is_value_string (value))
+  {
+    return ecma_gc_get_string_size (ecma_get_string_from_value (value), is_restore);
+  }
+
+  return 0;
+} /* ecma_gc_get_value_size */
+
+/**
+ * Get the number of bytes which are freed by ecma_gc_free_object, i.e. the size of
+ * the object itself, its property list and the non-object values owned by them.
+ *
+ * Note:
+ *      byte code is shared between function objects, so it is not included
+ *
+ * @return size of the object in bytes
+ */
+static size_t
+ecma_gc_get_object_size (ecma_object_t *object_p, /**< object */
+                         bool is_restore) /**< restore the string references (see ecma_gc_get_string_size) */
+{
+  size_t size = 0;
+  bool obj_is_not_lex_env = !ecma_is_lexical_environment (object_p);
+
+  if (obj_is_not_lex_env
+      || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    ecma_element_store_t *store_p = obj_is_not_lex_env ? ecma_get_element_store (object_p) : NULL;
+
+    if (store_p != NULL)
+    {
+      uint32_t *keys_p = ECMA_ELEMENT_STORE_KEYS (store_p);
+      ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+
+      size += ecma_element_store_get_size (store_p);
+
+      for (uint32_t i = 0; i < store_p->size; i++)
+      {
+        if (keys_p[i] != ECMA_STRING_NOT_ARRAY_INDEX)
+        {
+          size += ecma_gc_get_value_size (values_p[i], is_restore);
+        }
+      }
+    }
+
+    ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+    if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      size += ecma_property_hashmap_get_size (object_p);
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+
+    while (prop_iter_p != NULL)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      size += sizeof (ecma_property_pair_t);
+
+      for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+      {
+        uint8_t property = prop_iter_p->types[i];
+        jmem_cpointer_t name_cp = prop_pair_p->names_cp[i];
+
+        if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_SPECIAL)
+        {
+          continue;
+        }
+
+        if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR)
+        {
+          size += ecma_gc_get_string_size (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp), is_restore);
+        }
+
+        if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+        {
+#ifdef JERRY_CPOINTER_32_BIT
+          size += sizeof (ecma_getter_setter_pointers_t);
+#endif /* JERRY_CPOINTER_32_BIT */
+          continue;
+        }
+
+        if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+            && (name_cp == LIT_INTERNAL_MAGIC_STRING_NATIVE_HANDLE
+                || name_cp == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER))
+        {
+          size += sizeof (ecma_native_pointer_t);
+          continue;
+        }
+
+        size += ecma_gc_get_value_size (prop_pair_p->values[i].value, is_restore);
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+  }
+
+  if (!obj_is_not_lex_env)
+  {
+    return size + sizeof (ecma_object_t);
+  }
+
+  ecma_object_type_t object_type = ecma_get_object_type (object_p);
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  size_t ext_object_size = sizeof (ecma_extended_object_t);
+
+  if (ecma_get_object_is_builtin (object_p))
+  {
+    uint8_t length_and_bitset_size;
+
+    if (object_type == ECMA_OBJECT_TYPE_CLASS
+        || object_type == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      ext_object_size = sizeof (ecma_extended_built_in_object_t);
+      length_and_bitset_size = ((ecma_extended_built_in_object_t *) object_p)->built_in.length_and_bitset_size;
+    }
+    else
+    {
+      length_and_bitset_size = ext_object_p->u.built_in.length_and_bitset_size;
+    }
+
+    ext_object_size += (2 * sizeof (uint32_t)) * (length_and_bitset_size >> ECMA_BUILT_IN_BITSET_SHIFT);
+  }
+
+  switch (object_type)
+  {
+    case ECMA_OBJECT_TYPE_CLASS:
+    {
+      switch (ext_object_p->u.class_prop.class_id)
+      {
+        case LIT_MAGIC_STRING_STRING_UL:
+        case LIT_MAGIC_STRING_NUMBER_UL:
+        {
+          return size + ext_object_size + ecma_gc_get_value_size (ext_object_p->u.class_prop.u.value, is_restore);
+        }
+        case LIT_MAGIC_STRING_OBJECT_UL:
+        {
+          return size + sizeof (ecma_native_object_t);
+        }
+        case LIT_MAGIC_STRING_DATE_UL:
+        {
+          return size + ext_object_size + sizeof (ecma_number_t);
+        }
+#ifdef JERRY_ENABLE_LINE_INFO
+        case LIT_MAGIC_STRING_ERROR_UL:
+        {
+          ecma_backtrace_t *backtrace_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_backtrace_t,
+                                                                               ext_object_p->u.class_prop.u.value);
+
+          if (backtrace_p != NULL)
+          {
+            size += ECMA_BACKTRACE_GET_SIZE (backtrace_p->frame_count);
+          }
+
+          return size + ext_object_size;
+        }
+#endif /* JERRY_ENABLE_LINE_INFO */
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case LIT_MAGIC_STRING_ARRAY_BUFFER_UL:
+        {
+          if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (ext_object_p))
+          {
+            return size + sizeof (ecma_arraybuffer_external_info);
+          }
+
+          return size + sizeof (ecma_extended_object_t) + ext_object_p->u.class_prop.u.length;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+        case LIT_MAGIC_STRING_PROMISE_UL:
+        {
+          return (size + sizeof (ecma_promise_object_t)
+                  + ecma_gc_get_value_size (ext_object_p->u.class_prop.u.value, is_restore));
+        }
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+        default:
+        {
+          return size + ext_object_size;
+        }
+      }
+    }
+    case ECMA_OBJECT_TYPE_ARRAY:
+    case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+    {
+      return size + ext_object_size;
+    }
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    {
+      if (ecma_get_object_is_builtin (object_p))
+      {
+        return size + ext_object_size;
+      }
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+      if (ext_object_p->u.function.bytecode_cp == ECMA_NULL_POINTER)
+      {
+        return size + sizeof (ecma_static_function_t);
+      }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+      return size + sizeof (ecma_extended_object_t);
+    }
+#ifndef CONFIG_DISABLE_ES2015_ARROW_FUNCTION
+    case ECMA_OBJECT_TYPE_ARROW_FUNCTION:
+    {
+      ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) object_p;
+
+      size += ecma_gc_get_value_size (arrow_func_p->this_binding, is_restore);
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+      if (arrow_func_p->bytecode_cp == ECMA_NULL_POINTER)
+      {
+        return size + sizeof (ecma_static_arrow_function_t);
+      }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+      return size + sizeof (ecma_arrow_function_t);
+    }
+#endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
+    case ECMA_OBJECT_TYPE_PSEUDO_ARRAY:
+    {
+      switch (ext_object_p->u.pseudo_array.type)
+      {
+        case ECMA_PSEUDO_ARRAY_ARGUMENTS:
+        {
+          ecma_length_t formal_params_number = ext_object_p->u.pseudo_array.u1.length;
+          ecma_value_t *arg_Literal_p = (ecma_value_t *) (ext_object_p + 1);
+
+          for (ecma_length_t i = 0; i < formal_params_number; i++)
+          {
+            if (arg_Literal_p[i] != ECMA_VALUE_EMPTY)
+            {
+              size += ecma_gc_get_value_size (arg_Literal_p[i], is_restore);
+            }
+          }
+
+          return size + sizeof (ecma_extended_object_t) + formal_params_number * sizeof (ecma_value_t);
+        }
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case ECMA_PSEUDO_ARRAY_TYPEDARRAY_WITH_INFO:
+        {
+          return size + sizeof (ecma_extended_typedarray_object_t);
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+        default:
+        {
+          return size + sizeof (ecma_extended_object_t);
+        }
+      }
+    }
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    {
+      ecma_value_t args_len_or_this = ext_object_p->u.bound_function.args_len_or_this;
+
+      if (!ecma_is_value_integer_number (args_len_or_this))
+      {
+        return size + sizeof (ecma_extended_object_t) + ecma_gc_get_value_size (args_len_or_this, is_restore);
+      }
+
+      ecma_integer_value_t args_length = ecma_get_integer_from_value (args_len_or_this);
+      ecma_value_t *args_p = (ecma_value_t *) (ext_object_p + 1);
+
+      for (ecma_integer_value_t i = 0; i < args_length; i++)
+      {
+        size += ecma_gc_get_value_size (args_p[i], is_restore);
+      }
+
+      return size + sizeof (ecma_extended_object_t) + ((size_t) args_length) * sizeof (ecma_value_t);
+    }
+    default:
+    {
+      if (ecma_get_object_is_builtin (object_p))
+      {
+        return size + ext_object_size;
+      }
+
+      return size + sizeof (ecma_object_t);
+    }
+  }
+} /* ecma_gc_get_object_size */
+
+/**
+ * Compute the retained size of a set of objects, i.e. the number of bytes which would
+ * be freed by the next garbage collection if the references held by the elements of
+ * the set were released.
+ *
+ * An object is retained by the set if it is reachable from the set but not from any
+ * other root. The computation follows the same edges as the marking phase of the
+ * garbage collector, but it does not free anything and the reference counters and
+ * the object list are restored before returning.
+ *
+ * Note:
+ *      each element must hold its own reference to the object, objects which are
+ *      kept alive by other references (e.g. the stack) retain nothing
+ *
+ * @return retained size in bytes
+ */
+size_t
+ecma_gc_get_retained_size (const ecma_value_t *roots_p, /**< root values */
+                           size_t roots_count) /**< number of root values */
+{
+  /* Release the references held by the roots. */
+  for (size_t i = 0; i < roots_count; i++)
+  {
+    if (ecma_is_value_object (roots_p[i]))
+    {
+      ecma_deref_object (ecma_get_object_from_value (roots_p[i]));
+    }
+  }
+
+  ecma_object_t *white_gray_objects_p = JERRY_CONTEXT (ecma_gc_objects_p);
+  ecma_object_t *black_objects_p = NULL;
+
+  /* Mark everything which is reachable without the roots. */
+  ecma_gc_mark_root_objects (&white_gray_objects_p, &black_objects_p);
+
+  ecma_object_t *first_root_object_p = black_objects_p;
+
+  ecma_gc_mark_non_root_objects (&white_gray_objects_p, &black_objects_p);
+
+  /* The remaining white objects are either garbage already, or retained by the roots. */
+  for (size_t i = 0; i < roots_count; i++)
+  {
+    if (ecma_is_value_object (roots_p[i]))
+    {
+      ecma_gc_set_object_visited (ecma_get_object_from_value (roots_p[i]));
+    }
+  }
+
+  ecma_object_t *retained_objects_p = NULL;
+  ecma_gc_mark_non_root_objects (&white_gray_objects_p, &retained_objects_p);
+
+  size_t retained_size = 0;
+  ecma_object_t *objects_p = white_gray_objects_p;
+  ecma_object_t *obj_iter_p = retained_objects_p;
+
+  /* A string is retained if all of its references are held by retained objects. */
+  while (obj_iter_p != NULL)
+  {
+    retained_size += ecma_gc_get_object_size (obj_iter_p, false);
+    obj_iter_p = ecma_gc_get_object_next (obj_iter_p);
+  }
+
+  obj_iter_p = retained_objects_p;
+
+  while (obj_iter_p != NULL)
+  {
+    ecma_object_t *obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+
+    ecma_gc_get_object_size (obj_iter_p, true);
+
+    /* The reference counter must be 1. */
+    ecma_deref_object (obj_iter_p);
+    JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+
+    ecma_gc_set_object_next (obj_iter_p, objects_p);
+    objects_p = obj_iter_p;
+    obj_iter_p = obj_next_p;
+  }
+
+  /* Reset the reference counter of non-root black objects. */
+  bool is_root_object = false;
+  obj_iter_p = black_objects_p;
+
+  while (obj_iter_p != NULL)
+  {
+    ecma_object_t *obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+
+    if (obj_iter_p == first_root_object_p)
+    {
+      is_root_object = true;
+    }
+
+    if (!is_root_object)
+    {
+      /* The reference counter must be 1. */
+      ecma_deref_object (obj_iter_p);
+      JERRY_ASSERT (obj_iter_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+    }
+
+    ecma_gc_set_object_next (obj_iter_p, objects_p);
+    objects_p = obj_iter_p;
+    obj_iter_p = obj_next_p;
+  }
+
+  JERRY_CONTEXT (ecma_gc_objects_p) = objects_p;
+
+  for (size_t i = 0; i < roots_count; i++)
+  {
+    if (ecma_is_value_object (roots_p[i]))
+    {
+      ecma_ref_object (ecma_get_object_from_value (roots_p[i]));
+    }
+  }
+
+  return retained_size;
+} /* ecma_gc_get_retained_size */
+
 /**
  * Try to free some memory (depending on severity).
  */
@@ -965,8 +1846,9 @@ ecma_free_unused_memory (jmem_free_unused_memory_severity_t severity) /**< sever
     }
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 
-    /* Freeing as much memory as we currently can */
+    /* Freeing as much memory as we currently can, including the blocks freed by the collection. */
     ecma_gc_run (severity);
+    ecma_free_recycled_blocks ();
   }
 } /* ecma_free_unused_memory */
 
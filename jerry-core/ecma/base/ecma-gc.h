@@ -30,6 +30,8 @@ void ecma_init_gc_info (ecma_object_t *object_p);
 void ecma_ref_object (ecma_object_t *object_p);
 void ecma_deref_object (ecma_object_t *object_p);
 void ecma_gc_run (jmem_free_unused_memory_severity_t severity);
+size_t ecma_gc_get_retained_size (const ecma_value_t *roots_p, size_t roots_count);
+uint32_t ecma_gc_run_finalizers (uint32_t count_limit, uint32_t time_limit);
 void ecma_free_unused_memory (jmem_free_unused_memory_severity_t severity);
 
 /**
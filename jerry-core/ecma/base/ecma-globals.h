@@ -62,6 +62,7 @@ typedef enum
   ECMA_INIT_SHOW_OPCODES        = (1u << 0), /**< dump byte-code to log after parse */
   ECMA_INIT_SHOW_REGEXP_OPCODES = (1u << 1), /**< dump regexp byte-code to log after compilation */
   ECMA_INIT_MEM_STATS           = (1u << 2), /**< dump memory statistics */
+  ECMA_INIT_DEFERRED_FINALIZERS = (1u << 5), /**< queue native free callbacks during garbage collection */
 } ecma_init_flag_t;
 
 /**
@@ -274,6 +275,55 @@ typedef struct
   } u;
 } ecma_native_pointer_t;
 
+/**
+ * Item of the object list of a registered native type info.
+ */
+typedef struct
+{
+  jmem_cpointer_t object_cp; /**< object which has the native type info */
+  jmem_cpointer_t next_cp; /**< next item */
+} ecma_native_info_object_t;
+
+/**
+ * Registered native type info.
+ */
+typedef struct ecma_native_info_registry_t
+{
+  struct ecma_native_info_registry_t *next_p; /**< next registered native type info */
+  ecma_object_native_info_t *info_p; /**< native type info */
+  jmem_cpointer_t first_object_cp; /**< first item of the object list (ecma_native_info_object_t) */
+} ecma_native_info_registry_t;
+
+/**
+ * Queued native free callback.
+ */
+typedef struct
+{
+  void *data_p; /**< argument of the callback */
+  union
+  {
+    ecma_object_native_free_callback_t native_cb; /**< native free callback */
+    ecma_object_free_callback_t handle_cb; /**< free callback of a native handle */
+  } u;
+} ecma_finalizer_t;
+
+/**
+ * Number of finalizers stored in a block of the finalizer queue.
+ */
+#define ECMA_FINALIZER_BLOCK_SIZE 8
+
+/**
+ * Block of the deferred finalizer queue.
+ */
+typedef struct ecma_finalizer_block_t
+{
+  struct ecma_finalizer_block_t *next_p; /**< next block */
+  uint8_t first; /**< index of the first pending finalizer */
+  uint8_t end; /**< index after the last queued finalizer */
+  uint8_t handle_bits; /**< bit n is set if the n-th finalizer is a native handle callback */
+  ecma_finalizer_t items[ECMA_FINALIZER_BLOCK_SIZE]; /**< queued finalizers */
+} ecma_finalizer_block_t;
+
 /**
  * Property's 'Writable' attribute's values description.
  */
@@ -311,6 +361,7 @@ typedef enum
  *   first property pair, only property pair items are allowed.
  *
  *   Example for other items is property name hash map, or array of items.
+ *   The element store of an object precedes all other items.
  */
 
 /**
@@ -391,6 +442,7 @@ typedef enum
    * ECMA_PROPERTY_IS_PROPERTY_PAIR must be updated as well. */
   ECMA_SPECIAL_PROPERTY_HASHMAP, /**< hashmap property */
   ECMA_SPECIAL_PROPERTY_DELETED, /**< deleted property */
+  ECMA_SPECIAL_PROPERTY_ELEMENTS, /**< element store */
 
   ECMA_SPECIAL_PROPERTY__COUNT /**< Number of special property types */
 } ecma_internal_property_id_t;
@@ -411,6 +463,11 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_HASHMAP)
 
+/**
+ * Type of element store property.
+ */
+#define ECMA_PROPERTY_TYPE_ELEMENTS ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_ELEMENTS)
+
 /**
  * Name constant of a deleted property.
  */
@@ -494,6 +551,8 @@ typedef union
 #else /* !JERRY_CPOINTER_32_BIT */
   ecma_getter_setter_pointers_t getter_setter_pair; /**< getter setter pair */
 #endif /* JERRY_CPOINTER_32_BIT */
+  jmem_cpointer_t next_free_pair_cp; /**< next property pair with a deleted slot
+                                      *   (stored in deleted slots of objects with property hashmap) */
 } ecma_property_value_t;
 
 /**
@@ -523,7 +582,8 @@ typedef struct
  */
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
   (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types[0]) != ECMA_PROPERTY_TYPE_VIRTUAL \
-   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP \
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_ELEMENTS)
 
 /**
  * Returns true if the property is named property.
@@ -550,6 +610,14 @@ typedef struct
 #define ECMA_PROPERTY_VALUE_PTR(property_p) \
   ((ecma_property_value_t *) ECMA_PROPERTY_VALUE_DATA_PTR (property_p))
 
+/**
+ * Compute the property pair which contains a property data.
+ * Property pairs are aligned to JMEM_ALIGNMENT.
+ */
+#define ECMA_PROPERTY_VALUE_GET_PAIR(prop_value_p) \
+  ((ecma_property_pair_t *) ((((uintptr_t) (prop_value_p)) - sizeof (ecma_property_header_t)) \
+                             & ~((uintptr_t) JMEM_ALIGNMENT - 1)))
+
 /**
  * Depth limit for property search (maximum prototype chain depth).
  */
@@ -662,6 +730,18 @@ typedef enum
  */
 #define ECMA_OBJECT_MAX_REF (0x3ffu << 6)
 
+/**
+ * Number of references moved into the reference overflow table
+ * when the object reference counter reaches its maximum.
+ */
+#define ECMA_OBJECT_SPILL_REFS 0x200u
+
+/**
+ * The spilled references are moved back when the
+ * object reference counter is decreased from this value.
+ */
+#define ECMA_OBJECT_REFILL_LIMIT (0x100u << 6)
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -672,7 +752,8 @@ typedef struct
                      depending on ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV
       flags : 2 bit : ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV,
                       ECMA_OBJECT_FLAG_EXTENSIBLE
-      refs : 10 bit (max 1023) */
+      refs : 10 bit (max 1023, further references are kept in the
+                     reference overflow table, see ecma_ref_overflow_t) */
   uint16_t type_flags_refs;
 
   /** next in the object chain maintained by the garbage collector */
@@ -788,6 +869,77 @@ typedef struct
   } u;
 } ecma_extended_object_t;
 
+/**
+ * Description of objects with a reserved native pointer slot.
+ *
+ * Note:
+ *      these objects are class objects with LIT_MAGIC_STRING_OBJECT_UL class id
+ */
+typedef struct
+{
+  ecma_extended_object_t extended_object; /**< extended object part */
+  ecma_native_pointer_t native_pointer; /**< native pointer slot */
+} ecma_native_object_t;
+
+/**
+ * Weak reference to an object.
+ */
+typedef struct ecma_weak_ref_t
+{
+  struct ecma_weak_ref_t *prev_p; /**< previous weak reference */
+  struct ecma_weak_ref_t *next_p; /**< next weak reference */
+  ecma_object_t *object_p; /**< target object, NULL if the object is freed */
+  ecma_object_native_free_callback_t callback_p; /**< callback which is called when the object is freed */
+  void *user_p; /**< argument of the callback */
+} ecma_weak_ref_t;
+
+/**
+ * Item of the reference overflow table, which stores the references of
+ * objects, strings and byte codes whose reference counter is saturated.
+ *
+ * Note:
+ *   an item exists only while the reference counter of the target
+ *   is above the refill limit of its type, so the target is never freed
+ *   while it has references in the table
+ */
+typedef struct ecma_ref_overflow_t
+{
+  struct ecma_ref_overflow_t *next_p; /**< next item */
+  const void *target_p; /**< object, string or byte code */
+  uint32_t refs; /**< number of references stored in the table */
+} ecma_ref_overflow_t;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Frame of a backtrace captured by an error object.
+ */
+typedef struct
+{
+  ecma_value_t resource_name; /**< resource name of the frame (literal string) */
+  uint32_t line; /**< current line of the frame */
+} ecma_backtrace_frame_t;
+
+/**
+ * Backtrace captured by an error object.
+ *
+ * Note:
+ *      the header is followed by frame_count ecma_backtrace_frame_t items, and
+ *      the error object refers to it until its "stack" property is instantiated
+ */
+typedef struct
+{
+  uint32_t frame_count; /**< number of frames */
+} ecma_backtrace_t;
+
+/**
+ * Get the size of a backtrace with the specified number of frames.
+ */
+#define ECMA_BACKTRACE_GET_SIZE(frame_count) \
+  (sizeof (ecma_backtrace_t) + (frame_count) * sizeof (ecma_backtrace_frame_t))
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Description of built-in extended ECMA-object.
  */
@@ -799,10 +951,15 @@ typedef struct
 
 /**
  * Compiled byte code data.
+ *
+ * Note:
+ *      the size of functions which are larger than ECMA_COMPILED_CODE_COMPACT_SIZE_LIMIT
+ *      is extended by the size_high field of cbc_uint16_arguments_t, use
+ *      ecma_compiled_code_get_size and ecma_compiled_code_set_size to access it
  */
 typedef struct
 {
-  uint16_t size;                    /**< real size >> JMEM_ALIGNMENT_LOG */
+  uint16_t size;                    /**< real size >> JMEM_ALIGNMENT_LOG (lower 16 bits) */
   uint16_t refs;                    /**< reference counter for the byte code */
   uint16_t status_flags;            /**< various status flags:
                                       *    CBC_CODE_FLAGS_FUNCTION flag tells whether
@@ -811,6 +968,23 @@ typedef struct
                                       *    If regexp, the other flags must be RE_FLAG... */
 } ecma_compiled_code_t;
 
+/**
+ * Maximum size of a compiled code whose size fits into the compact header.
+ */
+#define ECMA_COMPILED_CODE_COMPACT_SIZE_LIMIT (((size_t) UINT16_MAX) << JMEM_ALIGNMENT_LOG)
+
+/**
+ * Number of references moved into the reference overflow table
+ * when the byte code reference counter reaches its maximum.
+ */
+#define ECMA_BYTECODE_SPILL_REFS 0x8000u
+
+/**
+ * The spilled references are moved back when the
+ * byte code reference counter is decreased from this value.
+ */
+#define ECMA_BYTECODE_REFILL_LIMIT 0x4000u
+
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
 /**
@@ -1232,6 +1406,18 @@ typedef enum
  */
 #define ECMA_STRING_MAX_REF (0x1fffu << 3)
 
+/**
+ * Number of references moved into the reference overflow table
+ * when the string reference counter reaches its maximum.
+ */
+#define ECMA_STRING_SPILL_REFS 0x1000u
+
+/**
+ * The spilled references are moved back when the
+ * string reference counter is decreased from this value.
+ */
+#define ECMA_STRING_REFILL_LIMIT (0x800u << 3)
+
 /**
  * Set reference counter to zero (for refs_and_container member below).
  */
@@ -1375,6 +1561,30 @@ typedef struct
 
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+
+/**
+ * Entry of the construct cache
+ */
+typedef struct
+{
+  /** Constructor function (NULL marks the entry empty) */
+  ecma_object_t *function_p;
+
+  /** Value of the non-configurable 'prototype' data property of the function */
+  ecma_property_value_t *prototype_value_p;
+
+  /** Number of named properties of the last instance created by the function */
+  uint32_t property_count;
+} ecma_construct_cache_entry_t;
+
+/**
+ * Number of entries in the construct cache (must be power of 2)
+ */
+#define ECMA_CONSTRUCT_CACHE_SIZE 16
+
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+
 #ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
 
 /**
@@ -1384,11 +1594,15 @@ typedef enum
 {
   ECMA_ARRAYBUFFER_INTERNAL_MEMORY = 0u,        /* ArrayBuffer memory is handled internally. */
   ECMA_ARRAYBUFFER_EXTERNAL_MEMORY = (1u << 0), /* ArrayBuffer created via jerry_create_arraybuffer_external. */
+  ECMA_ARRAYBUFFER_PORT_MEMORY = (1u << 1),     /* External memory allocated via jerry_port_arraybuffer_alloc. */
 } ecma_arraybuffer_extra_flag_t;
 
 #define ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY(object_p) \
     ((((ecma_extended_object_t *) object_p)->u.class_prop.extra_info & ECMA_ARRAYBUFFER_EXTERNAL_MEMORY) != 0)
 
+#define ECMA_ARRAYBUFFER_HAS_PORT_MEMORY(object_p) \
+    ((((ecma_extended_object_t *) object_p)->u.class_prop.extra_info & ECMA_ARRAYBUFFER_PORT_MEMORY) != 0)
+
 /**
  * Struct to store information for ArrayBuffers with external memory.
  *
@@ -14,8 +14,11 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -45,27 +48,64 @@ ecma_create_native_property (ecma_object_t *obj_p, /**< object to create propert
   JERRY_ASSERT (id == LIT_INTERNAL_MAGIC_STRING_NATIVE_HANDLE
                 || id == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER);
 
-  ecma_string_t *name_p = ecma_get_magic_string (id);
-  ecma_property_t *property_p = ecma_find_named_property (obj_p, name_p);
+  ecma_native_pointer_t *native_pointer_p = NULL;
+  bool is_new = false;
 
-  bool is_new = (property_p == NULL);
-
-  ecma_native_pointer_t *native_pointer_p;
+  if (id == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER)
+  {
+    native_pointer_p = ecma_get_native_object_slot (obj_p);
+  }
 
-  if (is_new)
+  if (native_pointer_p == NULL)
   {
-    ecma_property_value_t *value_p;
-    value_p = ecma_create_named_data_property (obj_p, name_p, ECMA_PROPERTY_FLAG_WRITABLE, NULL);
+    ecma_string_t *name_p = ecma_get_magic_string (id);
+    ecma_property_t *property_p = ecma_find_named_property (obj_p, name_p);
+
+    is_new = (property_p == NULL);
+
+    if (is_new)
+    {
+      ecma_property_value_t *value_p;
+      value_p = ecma_create_named_data_property (obj_p, name_p, ECMA_PROPERTY_FLAG_WRITABLE, NULL);
 
-    native_pointer_p = jmem_heap_alloc_block (sizeof (ecma_native_pointer_t));
+      native_pointer_p = jmem_heap_alloc_block (sizeof (ecma_native_pointer_t));
+      native_pointer_p->u.info_p = NULL;
 
-    ECMA_SET_INTERNAL_VALUE_POINTER (value_p->value, native_pointer_p);
+      ECMA_SET_INTERNAL_VALUE_POINTER (value_p->value, native_pointer_p);
+    }
+    else
+    {
+      ecma_property_value_t *value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+
+      native_pointer_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_native_pointer_t, value_p->value);
+    }
   }
-  else
+
+  if (id == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER
+      && native_pointer_p->u.info_p != info_p)
   {
-    ecma_property_value_t *value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+    /* An object is on the list of a registered type info only while it has that type info. */
+    ecma_native_info_registry_t *registry_p;
+
+    if (native_pointer_p->u.info_p != NULL)
+    {
+      registry_p = ecma_find_native_info_registry (native_pointer_p->u.info_p);
 
-    native_pointer_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_native_pointer_t, value_p->value);
+      if (registry_p != NULL)
+      {
+        ecma_native_info_registry_remove (registry_p, obj_p);
+      }
+    }
+
+    if (info_p != NULL)
+    {
+      registry_p = ecma_find_native_info_registry (info_p);
+
+      if (registry_p != NULL)
+      {
+        ecma_native_info_registry_insert (registry_p, obj_p);
+      }
+    }
   }
 
   native_pointer_p->data_p = data_p;
@@ -127,6 +167,16 @@ ecma_get_native_pointer_value (ecma_object_t *obj_p, /**< object to get property
   JERRY_ASSERT (id == LIT_INTERNAL_MAGIC_STRING_NATIVE_HANDLE
                 || id == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER);
 
+  if (id == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER)
+  {
+    ecma_native_pointer_t *native_pointer_p = ecma_get_native_object_slot (obj_p);
+
+    if (native_pointer_p != NULL)
+    {
+      return native_pointer_p;
+    }
+  }
+
   ecma_property_t *property_p = ecma_find_named_property (obj_p, ecma_get_magic_string (id));
 
   if (property_p == NULL)
@@ -139,6 +189,190 @@ ecma_get_native_pointer_value (ecma_object_t *obj_p, /**< object to get property
   return ECMA_GET_INTERNAL_VALUE_POINTER (ecma_native_pointer_t, value_p->value);
 } /* ecma_get_native_pointer_value */
 
+/**
+ * Create an object with a reserved native pointer slot.
+ *
+ * Note:
+ *      the native pointer of these objects is accessed in constant time
+ *
+ * @return pointer to the created object
+ */
+ecma_object_t *
+ecma_create_native_object (void *native_p, /**< native pointer */
+                           void *info_p) /**< native pointer's type info */
+{
+  ecma_object_t *object_prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+
+  ecma_object_t *obj_p = ecma_create_object (object_prototype_p,
+                                             sizeof (ecma_native_object_t),
+                                             ECMA_OBJECT_TYPE_CLASS);
+
+  ecma_deref_object (object_prototype_p);
+
+  ecma_native_object_t *native_object_p = (ecma_native_object_t *) obj_p;
+  native_object_p->extended_object.u.class_prop.class_id = LIT_MAGIC_STRING_OBJECT_UL;
+  native_object_p->native_pointer.data_p = NULL;
+  native_object_p->native_pointer.u.info_p = NULL;
+
+  ecma_create_native_pointer_property (obj_p, native_p, info_p);
+
+  return obj_p;
+} /* ecma_create_native_object */
+
+/**
+ * Get the reserved native pointer slot of an object.
+ *
+ * @return pointer to the slot - if the object was created by ecma_create_native_object
+ *         NULL - otherwise
+ */
+ecma_native_pointer_t *
+ecma_get_native_object_slot (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_is_lexical_environment (obj_p)
+      || ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_CLASS
+      || ((ecma_extended_object_t *) obj_p)->u.class_prop.class_id != LIT_MAGIC_STRING_OBJECT_UL)
+  {
+    return NULL;
+  }
+
+  return &((ecma_native_object_t *) obj_p)->native_pointer;
+} /* ecma_get_native_object_slot */
+
+/**
+ * Find a registered native type info.
+ *
+ * @return pointer to the registry entry - if the type info is registered
+ *         NULL - otherwise
+ */
+ecma_native_info_registry_t *
+ecma_find_native_info_registry (void *info_p) /**< native pointer's type info */
+{
+  ecma_native_info_registry_t *registry_p = JERRY_CONTEXT (native_info_registry_p);
+
+  while (registry_p != NULL && registry_p->info_p != info_p)
+  {
+    registry_p = registry_p->next_p;
+  }
+
+  return registry_p;
+} /* ecma_find_native_info_registry */
+
+/**
+ * Insert an object into the object list of a registered native type info.
+ */
+void
+ecma_native_info_registry_insert (ecma_native_info_registry_t *registry_p, /**< registry entry */
+                                  ecma_object_t *obj_p) /**< object */
+{
+  jmem_cpointer_t obj_cp;
+  ECMA_SET_NON_NULL_POINTER (obj_cp, obj_p);
+
+  ecma_native_info_object_t *item_p;
+  item_p = (ecma_native_info_object_t *) jmem_pools_alloc (sizeof (ecma_native_info_object_t));
+
+  item_p->object_cp = obj_cp;
+  item_p->next_cp = registry_p->first_object_cp;
+  ECMA_SET_NON_NULL_POINTER (registry_p->first_object_cp, item_p);
+} /* ecma_native_info_registry_insert */
+
+/**
+ * Remove an object from the object list of a registered native type info.
+ */
+void
+ecma_native_info_registry_remove (ecma_native_info_registry_t *registry_p, /**< registry entry */
+                                  ecma_object_t *obj_p) /**< object */
+{
+  jmem_cpointer_t obj_cp;
+  ECMA_SET_NON_NULL_POINTER (obj_cp, obj_p);
+
+  jmem_cpointer_t *item_cp_p = &registry_p->first_object_cp;
+
+  while (*item_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_native_info_object_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_native_info_object_t, *item_cp_p);
+
+    if (item_p->object_cp == obj_cp)
+    {
+      *item_cp_p = item_p->next_cp;
+      jmem_pools_free (item_p, sizeof (ecma_native_info_object_t));
+      return;
+    }
+
+    item_cp_p = &item_p->next_cp;
+  }
+
+  JERRY_UNREACHABLE ();
+} /* ecma_native_info_registry_remove */
+
+/**
+ * Register a native type info: the objects which have this type info
+ * are tracked on a list, so they can be enumerated without walking
+ * all objects of the heap.
+ */
+void
+ecma_register_native_info (void *info_p) /**< native pointer's type info */
+{
+  JERRY_ASSERT (info_p != NULL);
+
+  if (ecma_find_native_info_registry (info_p) != NULL)
+  {
+    return;
+  }
+
+  ecma_native_info_registry_t *registry_p;
+  registry_p = (ecma_native_info_registry_t *) jmem_heap_alloc_block (sizeof (ecma_native_info_registry_t));
+
+  registry_p->info_p = (ecma_object_native_info_t *) info_p;
+  registry_p->first_object_cp = ECMA_NULL_POINTER;
+
+  /* The already existing objects are collected first. */
+  for (ecma_object_t *iter_p = JERRY_CONTEXT (ecma_gc_objects_p);
+       iter_p != NULL;
+       iter_p = ECMA_GET_POINTER (ecma_object_t, iter_p->gc_next_cp))
+  {
+    if (!ecma_is_lexical_environment (iter_p))
+    {
+      ecma_native_pointer_t *native_pointer_p;
+      native_pointer_p = ecma_get_native_pointer_value (iter_p, LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER);
+
+      if (native_pointer_p != NULL && native_pointer_p->u.info_p == info_p)
+      {
+        ecma_native_info_registry_insert (registry_p, iter_p);
+      }
+    }
+  }
+
+  registry_p->next_p = JERRY_CONTEXT (native_info_registry_p);
+  JERRY_CONTEXT (native_info_registry_p) = registry_p;
+} /* ecma_register_native_info */
+
+/**
+ * Free all registered native type infos.
+ */
+void
+ecma_finalize_native_info_registry (void)
+{
+  ecma_native_info_registry_t *registry_p = JERRY_CONTEXT (native_info_registry_p);
+
+  while (registry_p != NULL)
+  {
+    ecma_native_info_registry_t *next_p = registry_p->next_p;
+    jmem_cpointer_t item_cp = registry_p->first_object_cp;
+
+    while (item_cp != ECMA_NULL_POINTER)
+    {
+      ecma_native_info_object_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_native_info_object_t, item_cp);
+      item_cp = item_p->next_cp;
+      jmem_pools_free (item_p, sizeof (ecma_native_info_object_t));
+    }
+
+    jmem_heap_free_block (registry_p, sizeof (ecma_native_info_registry_t));
+    registry_p = next_p;
+  }
+
+  JERRY_CONTEXT (native_info_registry_p) = NULL;
+} /* ecma_finalize_native_info_registry */
+
 /**
  * Free the allocated native package struct.
  */
@@ -153,6 +387,89 @@ ecma_free_native_pointer (ecma_property_t *prop_p) /**< native property */
   jmem_heap_free_block (native_pointer_p, sizeof (ecma_native_pointer_t));
 } /* ecma_free_native_pointer */
 
+/**
+ * Create a weak reference to an object. The weak reference does not keep
+ * the object alive, it is cleared by the garbage collector instead.
+ *
+ * @return pointer to the weak reference
+ */
+ecma_weak_ref_t *
+ecma_create_weak_ref (ecma_object_t *obj_p, /**< target object */
+                      ecma_object_native_free_callback_t callback_p, /**< callback which is called when the
+                                                                      *   object is freed (can be NULL) */
+                      void *user_p) /**< argument of the callback */
+{
+  ecma_weak_ref_t *weak_ref_p = (ecma_weak_ref_t *) jmem_heap_alloc_block (sizeof (ecma_weak_ref_t));
+
+  weak_ref_p->object_p = obj_p;
+  weak_ref_p->callback_p = callback_p;
+  weak_ref_p->user_p = user_p;
+
+  weak_ref_p->prev_p = NULL;
+  weak_ref_p->next_p = JERRY_CONTEXT (weak_refs_p);
+
+  if (weak_ref_p->next_p != NULL)
+  {
+    weak_ref_p->next_p->prev_p = weak_ref_p;
+  }
+
+  JERRY_CONTEXT (weak_refs_p) = weak_ref_p;
+  return weak_ref_p;
+} /* ecma_create_weak_ref */
+
+/**
+ * Remove a weak reference from the list of weak references.
+ */
+void
+ecma_unlink_weak_ref (ecma_weak_ref_t *weak_ref_p) /**< weak reference */
+{
+  if (weak_ref_p->prev_p != NULL)
+  {
+    weak_ref_p->prev_p->next_p = weak_ref_p->next_p;
+  }
+  else
+  {
+    JERRY_ASSERT (JERRY_CONTEXT (weak_refs_p) == weak_ref_p);
+    JERRY_CONTEXT (weak_refs_p) = weak_ref_p->next_p;
+  }
+
+  if (weak_ref_p->next_p != NULL)
+  {
+    weak_ref_p->next_p->prev_p = weak_ref_p->prev_p;
+  }
+} /* ecma_unlink_weak_ref */
+
+/**
+ * Free a weak reference.
+ */
+void
+ecma_free_weak_ref (ecma_weak_ref_t *weak_ref_p) /**< weak reference */
+{
+  ecma_unlink_weak_ref (weak_ref_p);
+  jmem_heap_free_block (weak_ref_p, sizeof (ecma_weak_ref_t));
+} /* ecma_free_weak_ref */
+
+/**
+ * Free all weak references. Their objects must be freed already.
+ */
+void
+ecma_finalize_weak_refs (void)
+{
+  ecma_weak_ref_t *weak_ref_p = JERRY_CONTEXT (weak_refs_p);
+
+  while (weak_ref_p != NULL)
+  {
+    ecma_weak_ref_t *next_p = weak_ref_p->next_p;
+
+    JERRY_ASSERT (weak_ref_p->object_p == NULL);
+    jmem_heap_free_block (weak_ref_p, sizeof (ecma_weak_ref_t));
+
+    weak_ref_p = next_p;
+  }
+
+  JERRY_CONTEXT (weak_refs_p) = NULL;
+} /* ecma_finalize_weak_refs */
+
 /**
  * @}
  * @}
@@ -39,6 +39,12 @@ JERRY_STATIC_ASSERT (ECMA_STRING_CONTAINER_MASK >= ECMA_STRING_CONTAINER__MAX,
 JERRY_STATIC_ASSERT ((ECMA_STRING_MAX_REF | ECMA_STRING_CONTAINER_MASK) == UINT16_MAX,
                      ecma_string_ref_and_container_fields_should_fill_the_16_bit_field);
 
+JERRY_STATIC_ASSERT (ECMA_STRING_MAX_REF - ((ECMA_STRING_SPILL_REFS - 1) * ECMA_STRING_REF_ONE)
+                     >= ECMA_STRING_REFILL_LIMIT
+                     && ECMA_STRING_REFILL_LIMIT + (ECMA_STRING_SPILL_REFS * ECMA_STRING_REF_ONE)
+                        <= ECMA_STRING_MAX_REF,
+                     ecma_string_spilled_references_must_fit_between_the_refill_limit_and_max_ref);
+
 JERRY_STATIC_ASSERT (ECMA_STRING_NOT_ARRAY_INDEX == UINT32_MAX,
                      ecma_string_not_array_index_must_be_equal_to_uint32_max);
 
@@ -48,6 +54,9 @@ JERRY_STATIC_ASSERT ((ECMA_TYPE_DIRECT_STRING & 0x1) != 0,
 JERRY_STATIC_ASSERT (LIT_MAGIC_STRING__COUNT <= ECMA_DIRECT_STRING_MAX_IMM,
                      all_magic_strings_must_be_encoded_as_direct_string);
 
+JERRY_STATIC_ASSERT (LIT_MAGIC_STRING_EX_CHAR_START + LIT_MAGIC_STRING_EX_CHAR_MAX <= ECMA_DIRECT_STRING_MAX_IMM,
+                     all_single_character_strings_must_be_encoded_as_direct_string);
+
 JERRY_STATIC_ASSERT ((int) ECMA_DIRECT_STRING_UINT == (int) ECMA_STRING_CONTAINER_UINT32_IN_DESC
                      && (int) ECMA_DIRECT_STRING_MAGIC_EX == (int) ECMA_STRING_CONTAINER_MAGIC_STRING_EX,
                      ecma_direct_and_container_types_must_match);
@@ -216,6 +225,17 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     }
   }
 
+  if (string_size <= 2)
+  {
+    ecma_char_t code_unit;
+
+    if (lit_read_code_unit_from_utf8 (string_p, &code_unit) == string_size
+        && code_unit <= LIT_MAGIC_STRING_EX_CHAR_MAX)
+    {
+      return ecma_get_char_string (code_unit);
+    }
+  }
+
   ecma_string_t *string_desc_p;
   lit_utf8_byte_t *data_p;
 
@@ -373,6 +393,27 @@ ecma_new_ecma_string_from_utf8_converted_to_cesu8 (const lit_utf8_byte_t *string
 ecma_string_t *
 ecma_new_ecma_string_from_code_unit (ecma_char_t code_unit) /**< code unit */
 {
+  if (code_unit <= LIT_MAGIC_STRING_EX_CHAR_MAX && lit_get_magic_string_ex_count () == 0)
+  {
+    if (code_unit >= LIT_CHAR_0 && code_unit <= LIT_CHAR_9)
+    {
+      return ecma_new_ecma_string_from_uint32 ((uint32_t) (code_unit - LIT_CHAR_0));
+    }
+
+    if (code_unit <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+    {
+      lit_utf8_byte_t byte = (lit_utf8_byte_t) code_unit;
+      lit_magic_string_id_t magic_string_id = lit_is_utf8_string_magic (&byte, 1);
+
+      if (magic_string_id != LIT_MAGIC_STRING__COUNT)
+      {
+        return ecma_get_magic_string (magic_string_id);
+      }
+    }
+
+    return ecma_get_char_string (code_unit);
+  }
+
   lit_utf8_byte_t lit_utf8_bytes[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
   lit_utf8_size_t bytes_size = lit_code_unit_to_utf8 (code_unit, lit_utf8_bytes);
 
@@ -480,6 +521,25 @@ ecma_get_magic_string (lit_magic_string_id_t id) /**< identifier of magic string
   return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_MAGIC, (uintptr_t) id);
 } /* ecma_get_magic_string */
 
+/**
+ * Returns the constant assigned to a single character string, whose
+ * character is not a decimal digit and the string is not a magic string.
+ *
+ * Note:
+ *   Calling ecma_deref_ecma_string on the returned pointer is optional.
+ *
+ * @return pointer to ecma-string descriptor
+ */
+inline ecma_string_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_get_char_string (ecma_char_t code_unit) /**< code unit */
+{
+  JERRY_ASSERT (code_unit <= LIT_MAGIC_STRING_EX_CHAR_MAX);
+  JERRY_ASSERT (code_unit < LIT_CHAR_0 || code_unit > LIT_CHAR_9);
+
+  uintptr_t id = (uintptr_t) (LIT_MAGIC_STRING_EX_CHAR_START + code_unit);
+  return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_MAGIC_EX, id);
+} /* ecma_get_char_string */
+
 /**
  * Allocate new ecma-string and fill it with reference to ECMA magic string
  *
@@ -868,15 +928,15 @@ ecma_ref_ecma_string (ecma_string_t *string_p) /**< string descriptor */
 
   JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
-  if (JERRY_LIKELY (string_p->refs_and_container < ECMA_STRING_MAX_REF))
+  if (JERRY_UNLIKELY (string_p->refs_and_container >= ECMA_STRING_MAX_REF))
   {
-    /* Increase reference counter. */
-    string_p->refs_and_container = (uint16_t) (string_p->refs_and_container + ECMA_STRING_REF_ONE);
-  }
-  else
-  {
-    jerry_fatal (ERR_REF_COUNT_LIMIT);
+    ecma_ref_overflow_spill (string_p, ECMA_STRING_SPILL_REFS);
+    string_p->refs_and_container = (uint16_t) (string_p->refs_and_container
+                                               - (ECMA_STRING_SPILL_REFS * ECMA_STRING_REF_ONE));
   }
+
+  /* Increase reference counter. */
+  string_p->refs_and_container = (uint16_t) (string_p->refs_and_container + ECMA_STRING_REF_ONE);
 } /* ecma_ref_ecma_string */
 
 /**
@@ -895,6 +955,14 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
   JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
+  /* The references of the string may have been spilled only if the counter is above the refill limit. */
+  if (JERRY_UNLIKELY ((uint32_t) (string_p->refs_and_container - ECMA_STRING_REFILL_LIMIT) < ECMA_STRING_REF_ONE)
+      && ecma_ref_overflow_refill (string_p, ECMA_STRING_SPILL_REFS))
+  {
+    string_p->refs_and_container = (uint16_t) (string_p->refs_and_container
+                                               + (ECMA_STRING_SPILL_REFS * ECMA_STRING_REF_ONE));
+  }
+
   /* Decrease reference counter. */
   string_p->refs_and_container = (uint16_t) (string_p->refs_and_container - ECMA_STRING_REF_ONE);
 
@@ -1344,6 +1412,99 @@ ecma_substring_copy_to_utf8_buffer (const ecma_string_t *string_desc_p, /**< ecm
   return size;
 } /* ecma_substring_copy_to_utf8_buffer */
 
+/**
+ * Copy the next chunk of ecma-string's contents into the buffer, starting from a byte offset of the
+ * cesu-8 representation of the string, and advance the offset past the copied characters.
+ *
+ * Note:
+ *      characters (and surrogate pairs when converting to utf-8) are never split between chunks,
+ *      so the buffer must be at least LIT_UTF8_MAX_BYTES_IN_CODE_POINT bytes long
+ *
+ * @return number of bytes, actually copied to the buffer,
+ *         0 - if the end of the string is reached
+ */
+lit_utf8_size_t
+ecma_string_copy_chunk_to_buffer (const ecma_string_t *string_desc_p, /**< ecma-string descriptor */
+                                  lit_utf8_size_t *offset_p, /**< [in, out] byte offset in the cesu-8 string */
+                                  lit_utf8_byte_t *buffer_p, /**< destination buffer pointer */
+                                  lit_utf8_size_t buffer_size, /**< size of buffer */
+                                  bool is_utf8) /**< true - convert the chunk to utf-8,
+                                                 *   false - copy the cesu-8 chunk */
+{
+  JERRY_ASSERT (string_desc_p != NULL);
+  JERRY_ASSERT (buffer_p != NULL || buffer_size == 0);
+
+  ECMA_STRING_TO_UTF8_STRING (string_desc_p, cesu8_str_p, cesu8_str_size);
+
+  lit_utf8_size_t offset = *offset_p;
+  lit_utf8_size_t size = 0;
+
+  if (offset < cesu8_str_size)
+  {
+    const lit_utf8_byte_t *cesu8_pos = cesu8_str_p + offset;
+    const lit_utf8_byte_t *cesu8_end_pos = cesu8_str_p + cesu8_str_size;
+
+    if (!is_utf8)
+    {
+      size = JERRY_MIN (buffer_size, cesu8_str_size - offset);
+
+      /* Do not split the last character. */
+      while (size > 0
+             && cesu8_pos + size < cesu8_end_pos
+             && (cesu8_pos[size] & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER)
+      {
+        size--;
+      }
+
+      memcpy (buffer_p, cesu8_pos, size);
+      offset += size;
+    }
+    else
+    {
+      while (cesu8_pos < cesu8_end_pos)
+      {
+        ecma_char_t ch;
+        lit_utf8_size_t code_unit_size = lit_read_code_unit_from_utf8 (cesu8_pos, &ch);
+
+        if (cesu8_pos + code_unit_size < cesu8_end_pos && lit_is_code_point_utf16_high_surrogate (ch))
+        {
+          ecma_char_t next_ch;
+          lit_utf8_size_t next_ch_size = lit_read_code_unit_from_utf8 (cesu8_pos + code_unit_size, &next_ch);
+
+          if (lit_is_code_point_utf16_low_surrogate (next_ch))
+          {
+            if (size + LIT_UTF8_MAX_BYTES_IN_CODE_POINT > buffer_size)
+            {
+              break;
+            }
+
+            lit_code_point_t code_point = lit_convert_surrogate_pair_to_code_point (ch, next_ch);
+            size += lit_code_point_to_utf8 (code_point, buffer_p + size);
+            cesu8_pos += code_unit_size + next_ch_size;
+            continue;
+          }
+        }
+
+        if (size + code_unit_size > buffer_size)
+        {
+          break;
+        }
+
+        memcpy (buffer_p + size, cesu8_pos, code_unit_size);
+        size += code_unit_size;
+        cesu8_pos += code_unit_size;
+      }
+
+      offset = (lit_utf8_size_t) (cesu8_pos - cesu8_str_p);
+    }
+  }
+
+  ECMA_FINALIZE_UTF8_STRING (cesu8_str_p, cesu8_str_size);
+
+  *offset_p = offset;
+  return size;
+} /* ecma_string_copy_chunk_to_buffer */
+
 /**
  * Convert ecma-string's contents to a cesu-8 string and put it to the buffer.
  * It is the caller's responsibility to make sure that the string fits in the buffer.
@@ -1538,6 +1699,36 @@ ecma_compare_ecma_string_to_magic_id (const ecma_string_t *string_p, /**< proper
   return (string_p == ecma_get_magic_string (id));
 } /* ecma_compare_ecma_string_to_magic_id */
 
+/**
+ * Checks whether the string equals to an utf-8 byte sequence.
+ *
+ * @return true - if the string equals to the byte sequence
+ *         false - otherwise
+ */
+bool
+ecma_compare_ecma_string_to_utf8 (const ecma_string_t *string_p, /**< ecma-string */
+                                  const lit_utf8_byte_t *chars_p, /**< utf-8 string */
+                                  lit_utf8_size_t size) /**< size of the utf-8 string */
+{
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    if (ECMA_GET_DIRECT_STRING_TYPE (string_p) == ECMA_DIRECT_STRING_UINT)
+    {
+      return false;
+    }
+  }
+  else if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
+           || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_LITERAL_NUMBER)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t string_size;
+  const lit_utf8_byte_t *string_chars_p = ecma_string_get_chars_fast (string_p, &string_size);
+
+  return (string_size == size && memcmp (string_chars_p, chars_p, size) == 0);
+} /* ecma_compare_ecma_string_to_utf8 */
+
 /**
  * Checks whether ecma string is empty or not
  *
@@ -14,6 +14,7 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-element-store.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -29,6 +30,10 @@
 #include "debugger.h"
 #endif /* JERRY_DEBUGGER */
 
+#ifdef JERRY_JIT
+#include "vm-jit.h"
+#endif /* JERRY_JIT */
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -57,12 +62,25 @@ JERRY_STATIC_ASSERT (ECMA_OBJECT_REF_ONE == (ECMA_OBJECT_FLAG_EXTENSIBLE << 1),
 JERRY_STATIC_ASSERT ((ECMA_OBJECT_MAX_REF | (ECMA_OBJECT_REF_ONE - 1)) == UINT16_MAX,
                      ecma_object_max_ref_does_not_fill_the_remaining_bits);
 
+JERRY_STATIC_ASSERT (ECMA_OBJECT_MAX_REF - ((ECMA_OBJECT_SPILL_REFS - 1) * ECMA_OBJECT_REF_ONE)
+                     >= ECMA_OBJECT_REFILL_LIMIT
+                     && ECMA_OBJECT_REFILL_LIMIT + (ECMA_OBJECT_SPILL_REFS * ECMA_OBJECT_REF_ONE)
+                        <= ECMA_OBJECT_MAX_REF,
+                     ecma_object_spilled_references_must_fit_between_the_refill_limit_and_max_ref);
+
+JERRY_STATIC_ASSERT (UINT16_MAX - (ECMA_BYTECODE_SPILL_REFS - 1) >= ECMA_BYTECODE_REFILL_LIMIT
+                     && ECMA_BYTECODE_REFILL_LIMIT + ECMA_BYTECODE_SPILL_REFS <= UINT16_MAX,
+                     ecma_bytecode_spilled_references_must_fit_between_the_refill_limit_and_max_ref);
+
 JERRY_STATIC_ASSERT (ECMA_PROPERTY_TYPE_DELETED == (ECMA_DIRECT_STRING_MAGIC << ECMA_PROPERTY_NAME_TYPE_SHIFT),
                      ecma_property_type_deleted_must_have_magic_string_name_type);
 
 JERRY_STATIC_ASSERT (ECMA_PROPERTY_DELETED_NAME >= LIT_MAGIC_STRING__COUNT,
                      ecma_property_deleted_name_must_not_be_valid_maigc_string_id);
 
+JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) < JMEM_ALIGNMENT,
+                     size_of_ecma_property_value_t_must_be_less_than_jmem_alignment);
+
 /**
  * Create an object with specified prototype object
  * (or NULL prototype if there is not prototype for the object)
@@ -342,6 +360,9 @@ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p) /**< lexical en
 /**
  * Get object's/lexical environment's property list.
  *
+ * Note:
+ *      the element store of the object is not part of the returned list
+ *
  * See also:
  *          ecma_op_object_get_property_names
  *
@@ -354,10 +375,48 @@ ecma_get_property_list (const ecma_object_t *object_p) /**< object or lexical en
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p)
                 || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
 
-  return ECMA_GET_POINTER (ecma_property_header_t,
-                           object_p->property_list_or_bound_object_cp);
+  ecma_property_header_t *property_list_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                                              object_p->property_list_or_bound_object_cp);
+
+  if (property_list_p != NULL && property_list_p->types[0] == ECMA_PROPERTY_TYPE_ELEMENTS)
+  {
+    property_list_p = ECMA_GET_POINTER (ecma_property_header_t, property_list_p->next_property_cp);
+  }
+
+  return property_list_p;
 } /* ecma_get_property_list */
 
+/**
+ * Get the compressed pointer which refers to the head of the property list.
+ *
+ * Note:
+ *      the element store of an object precedes its property list
+ *
+ * @return pointer to the compressed pointer of the property list head
+ */
+jmem_cpointer_t *
+ecma_get_property_list_head_cp (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p)
+                || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+
+  jmem_cpointer_t *property_list_cp_p = &object_p->property_list_or_bound_object_cp;
+
+  if (*property_list_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                          *property_list_cp_p);
+
+    if (first_property_p->types[0] == ECMA_PROPERTY_TYPE_ELEMENTS)
+    {
+      property_list_cp_p = &first_property_p->next_property_cp;
+    }
+  }
+
+  return property_list_cp_p;
+} /* ecma_get_property_list_head_cp */
+
 /**
  * Get lexical environment's 'provideThis' property
  *
@@ -408,53 +467,96 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
 {
   JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
 
-  jmem_cpointer_t *property_list_head_p = &object_p->property_list_or_bound_object_cp;
+  jmem_cpointer_t *property_list_head_p = ecma_get_property_list_head_cp (object_p);
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
   {
-    /* If the first entry is free (deleted), it is reused. */
     ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
                                                                           *property_list_head_p);
+    ecma_property_pair_t *free_property_pair_p = NULL;
+    int index = 0;
     bool has_hashmap = false;
 
     if (first_property_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
     {
-      property_list_head_p = &first_property_p->next_property_cp;
-      first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
-                                                    *property_list_head_p);
+      /* The entries reserved by ecma_property_hashmap_create_reserved are used first. */
+      free_property_pair_p = ecma_property_hashmap_take_free_slot (object_p, &index);
       has_hashmap = true;
+
+      if (free_property_pair_p == NULL)
+      {
+        property_list_head_p = &first_property_p->next_property_cp;
+        first_property_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                             first_property_p->next_property_cp);
+      }
     }
 
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (first_property_p));
+    if (free_property_pair_p == NULL && first_property_p != NULL)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (first_property_p));
+
+      ecma_property_header_t *next_property_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                                                  first_property_p->next_property_cp);
+
+      /* The empty pairs at the start of the list (left by deleting the newest
+       * properties) are unlinked except the last one. Each pair is unlinked
+       * once, so this takes constant time on average. */
+      while (first_property_p->types[1] == ECMA_PROPERTY_TYPE_DELETED
+             && first_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
+             && next_property_p != NULL
+             && next_property_p->types[1] == ECMA_PROPERTY_TYPE_DELETED
+             && next_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED)
+      {
+        *property_list_head_p = first_property_p->next_property_cp;
+        ecma_dealloc_property_pair ((ecma_property_pair_t *) first_property_p);
+
+        first_property_p = next_property_p;
+        next_property_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                            first_property_p->next_property_cp);
+      }
+
+      /* If the first entry is free (deleted), it is reused. Other deleted entries
+       * are not reused, because that would change the enumeration order. An empty
+       * first pair is used in the same way as a newly created one. */
+      if (first_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED)
+      {
+        free_property_pair_p = (ecma_property_pair_t *) first_property_p;
 
-    if (first_property_p->types[0] == ECMA_PROPERTY_TYPE_DELETED)
+        if (first_property_p->types[1] == ECMA_PROPERTY_TYPE_DELETED)
+        {
+          index = 1;
+        }
+      }
+    }
+
+    if (free_property_pair_p != NULL)
     {
-      ecma_property_pair_t *first_property_pair_p = (ecma_property_pair_t *) first_property_p;
+      JERRY_ASSERT (free_property_pair_p->header.types[index] == ECMA_PROPERTY_TYPE_DELETED);
 
       if (name_p == NULL)
       {
-        first_property_pair_p->names_cp[0] = ECMA_NULL_POINTER;
+        free_property_pair_p->names_cp[index] = ECMA_NULL_POINTER;
       }
       else
       {
         ecma_property_t name_type;
-        first_property_pair_p->names_cp[0] = ecma_string_to_property_name (name_p,
-                                                                           &name_type);
+        free_property_pair_p->names_cp[index] = ecma_string_to_property_name (name_p,
+                                                                              &name_type);
         type_and_flags = (ecma_property_t) (type_and_flags | name_type);
       }
 
-      first_property_p->types[0] = type_and_flags;
+      free_property_pair_p->header.types[index] = type_and_flags;
 
-      ecma_property_t *property_p = first_property_p->types + 0;
+      ecma_property_t *property_p = free_property_pair_p->header.types + index;
 
-      JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == first_property_pair_p->values + 0);
+      JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == free_property_pair_p->values + index);
 
       if (out_prop_p != NULL)
       {
         *out_prop_p = property_p;
       }
 
-      first_property_pair_p->values[0] = value;
+      free_property_pair_p->values[index] = value;
 
       /* The property must be fully initialized before ecma_property_hashmap_insert
        * is called, because the insert operation may reallocate the hashmap, and
@@ -465,11 +567,11 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
       {
         ecma_property_hashmap_insert (object_p,
                                       name_p,
-                                      first_property_pair_p,
-                                      0);
+                                      free_property_pair_p,
+                                      index);
       }
 
-      return first_property_pair_p->values + 0;
+      return free_property_pair_p->values + index;
     }
   }
 
@@ -478,7 +580,7 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
 
   /* Need to query property_list_head_p again and recheck the existennce
    * of property hasmap, because ecma_alloc_property_pair may delete them. */
-  property_list_head_p = &object_p->property_list_or_bound_object_cp;
+  property_list_head_p = ecma_get_property_list_head_cp (object_p);
   bool has_hashmap = false;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -822,81 +924,65 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
-  ecma_property_header_t *cur_prop_p = ecma_get_property_list (object_p);
-  ecma_property_header_t *prev_prop_p = NULL;
-  ecma_property_hashmap_delete_status hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP;
-
-  if (cur_prop_p != NULL && cur_prop_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
-  {
-    prev_prop_p = cur_prop_p;
-    cur_prop_p = ECMA_GET_POINTER (ecma_property_header_t,
-                                   cur_prop_p->next_property_cp);
-    hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
-  }
-
-  while (true)
-  {
-    JERRY_ASSERT (cur_prop_p != NULL);
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (cur_prop_p));
+  ecma_property_pair_t *prop_pair_p = ECMA_PROPERTY_VALUE_GET_PAIR (prop_value_p);
+  int index = (int) (prop_value_p - prop_pair_p->values);
 
-    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) cur_prop_p;
+  JERRY_ASSERT (index >= 0 && index < ECMA_PROPERTY_PAIR_ITEM_COUNT);
+  JERRY_ASSERT (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_pair_p->header.types[index]));
 
-    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
-    {
-      if ((prop_pair_p->values + i) == prop_value_p)
-      {
-        JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (cur_prop_p->types[i]) != ECMA_PROPERTY_TYPE_SPECIAL);
+  ecma_property_header_t *cur_prop_p = ecma_get_property_list (object_p);
 
-        if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP)
-        {
-          hashmap_status = ecma_property_hashmap_delete (object_p,
-                                                         prop_pair_p->names_cp[i],
-                                                         cur_prop_p->types + i);
-        }
+  JERRY_ASSERT (cur_prop_p != NULL);
 
-        ecma_free_property (object_p, prop_pair_p->names_cp[i], cur_prop_p->types + i);
-        cur_prop_p->types[i] = ECMA_PROPERTY_TYPE_DELETED;
-        prop_pair_p->names_cp[i] = ECMA_PROPERTY_DELETED_NAME;
+  if (cur_prop_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    /* Empty property pairs are kept in the list, they are released when the
+     * hashmap is rehashed or when they are at the start of the list and
+     * ecma_create_property is called. */
+    ecma_property_hashmap_delete (object_p,
+                                  prop_pair_p->names_cp[index],
+                                  prop_pair_p->header.types + index);
+
+    ecma_free_property (object_p, prop_pair_p->names_cp[index], prop_pair_p->header.types + index);
+    prop_pair_p->header.types[index] = ECMA_PROPERTY_TYPE_DELETED;
+    prop_pair_p->names_cp[index] = ECMA_PROPERTY_DELETED_NAME;
+    return;
+  }
 
-        JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+  ecma_free_property (object_p, prop_pair_p->names_cp[index], prop_pair_p->header.types + index);
+  prop_pair_p->header.types[index] = ECMA_PROPERTY_TYPE_DELETED;
+  prop_pair_p->names_cp[index] = ECMA_PROPERTY_DELETED_NAME;
 
-        if (cur_prop_p->types[1 - i] != ECMA_PROPERTY_TYPE_DELETED)
-        {
-          /* The other property is still valid. */
-          if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
-          {
-            ecma_property_hashmap_free (object_p);
-            ecma_property_hashmap_create (object_p);
-          }
-          return;
-        }
-
-        JERRY_ASSERT (cur_prop_p->types[i] == ECMA_PROPERTY_TYPE_DELETED);
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
 
-        if (prev_prop_p == NULL)
-        {
-          object_p->property_list_or_bound_object_cp = cur_prop_p->next_property_cp;
-        }
-        else
-        {
-          prev_prop_p->next_property_cp = cur_prop_p->next_property_cp;
-        }
+  if (prop_pair_p->header.types[1 - index] != ECMA_PROPERTY_TYPE_DELETED)
+  {
+    /* The other property is still valid. */
+    return;
+  }
 
-        ecma_dealloc_property_pair ((ecma_property_pair_t *) cur_prop_p);
+  ecma_property_header_t *prev_prop_p = NULL;
 
-        if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
-        {
-          ecma_property_hashmap_free (object_p);
-          ecma_property_hashmap_create (object_p);
-        }
-        return;
-      }
-    }
+  while (cur_prop_p != &prop_pair_p->header)
+  {
+    JERRY_ASSERT (cur_prop_p != NULL);
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (cur_prop_p));
 
     prev_prop_p = cur_prop_p;
     cur_prop_p = ECMA_GET_POINTER (ecma_property_header_t,
                                    cur_prop_p->next_property_cp);
   }
+
+  if (prev_prop_p == NULL)
+  {
+    *ecma_get_property_list_head_cp (object_p) = cur_prop_p->next_property_cp;
+  }
+  else
+  {
+    prev_prop_p->next_property_cp = cur_prop_p->next_property_cp;
+  }
+
+  ecma_dealloc_property_pair (prop_pair_p);
 } /* ecma_delete_property */
 
 /**
@@ -963,14 +1049,14 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
   /* Second all properties between new_length and old_length are deleted. */
   current_prop_p = ecma_get_property_list (object_p);
   ecma_property_header_t *prev_prop_p = NULL;
-  ecma_property_hashmap_delete_status hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP;
+  bool has_hashmap = false;
 
   if (current_prop_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prev_prop_p = current_prop_p;
     current_prop_p = ECMA_GET_POINTER (ecma_property_header_t,
                                        current_prop_p->next_property_cp);
-    hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
+    has_hashmap = true;
   }
 
   while (current_prop_p != NULL)
@@ -989,11 +1075,11 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
         {
           JERRY_ASSERT (index != ECMA_STRING_NOT_ARRAY_INDEX);
 
-          if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP)
+          if (has_hashmap)
           {
-            hashmap_status = ecma_property_hashmap_delete (object_p,
-                                                           prop_pair_p->names_cp[i],
-                                                           current_prop_p->types + i);
+            ecma_property_hashmap_delete (object_p,
+                                          prop_pair_p->names_cp[i],
+                                          current_prop_p->types + i);
           }
 
           ecma_free_property (object_p, prop_pair_p->names_cp[i], current_prop_p->types + i);
@@ -1003,12 +1089,13 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
       }
     }
 
-    if (current_prop_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
+    if (!has_hashmap
+        && current_prop_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
         && current_prop_p->types[1] == ECMA_PROPERTY_TYPE_DELETED)
     {
       if (prev_prop_p == NULL)
       {
-        object_p->property_list_or_bound_object_cp = current_prop_p->next_property_cp;
+        *ecma_get_property_list_head_cp (object_p) = current_prop_p->next_property_cp;
       }
       else
       {
@@ -1028,12 +1115,6 @@ ecma_delete_array_properties (ecma_object_t *object_p, /**< object */
     }
   }
 
-  if (hashmap_status == ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP)
-  {
-    ecma_property_hashmap_free (object_p);
-    ecma_property_hashmap_create (object_p);
-  }
-
   return new_length;
 } /* ecma_delete_array_properties */
 
@@ -1046,6 +1127,22 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
                                           ecma_property_types_t type) /**< expected property type */
 {
 #ifndef JERRY_NDEBUG
+  if (!ecma_is_lexical_environment (object_p))
+  {
+    ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+    if (store_p != NULL)
+    {
+      const ecma_value_t *values_p = ECMA_ELEMENT_STORE_VALUES (store_p);
+
+      if (&prop_value_p->value >= values_p && &prop_value_p->value < values_p + store_p->size)
+      {
+        JERRY_ASSERT (type == ECMA_PROPERTY_TYPE_NAMEDDATA);
+        return;
+      }
+    }
+  }
+
   ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
   JERRY_ASSERT (prop_iter_p != NULL);
@@ -1490,6 +1587,138 @@ ecma_clear_error_reference (ecma_value_t value, /**< error reference */
   return referenced_value;
 } /* ecma_clear_error_reference */
 
+/**
+ * Get the size of a compiled code.
+ *
+ * @return size of the compiled code in bytes
+ */
+size_t
+ecma_compiled_code_get_size (const ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
+{
+  size_t size = bytecode_p->size;
+
+  if ((bytecode_p->status_flags & (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_UINT16_ARGUMENTS))
+      == (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_UINT16_ARGUMENTS))
+  {
+    size |= ((size_t) ((const cbc_uint16_arguments_t *) bytecode_p)->size_high) << 16;
+  }
+
+  return size << JMEM_ALIGNMENT_LOG;
+} /* ecma_compiled_code_get_size */
+
+/**
+ * Set the size of a compiled code.
+ *
+ * Note:
+ *      the status flags must be initialized before, since only functions
+ *      with cbc_uint16_arguments_t can be larger than ECMA_COMPILED_CODE_COMPACT_SIZE_LIMIT
+ */
+void
+ecma_compiled_code_set_size (ecma_compiled_code_t *bytecode_p, /**< byte code pointer */
+                             size_t size) /**< size of the compiled code in bytes */
+{
+  JERRY_ASSERT ((size & (JMEM_ALIGNMENT - 1)) == 0);
+
+  size >>= JMEM_ALIGNMENT_LOG;
+  bytecode_p->size = (uint16_t) size;
+
+  if ((bytecode_p->status_flags & (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_UINT16_ARGUMENTS))
+      == (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_UINT16_ARGUMENTS))
+  {
+    JERRY_ASSERT ((size >> 16) <= UINT16_MAX);
+    ((cbc_uint16_arguments_t *) bytecode_p)->size_high = (uint16_t) (size >> 16);
+  }
+  else
+  {
+    JERRY_ASSERT (size <= UINT16_MAX);
+  }
+} /* ecma_compiled_code_set_size */
+
+/**
+ * Move references of an object, string or byte code whose
+ * reference counter is saturated into the reference overflow table.
+ */
+void
+ecma_ref_overflow_spill (const void *target_p, /**< object, string or byte code */
+                         uint32_t refs) /**< number of references */
+{
+  ecma_ref_overflow_t *item_p = JERRY_CONTEXT (ref_overflow_p);
+
+  while (item_p != NULL)
+  {
+    if (item_p->target_p == target_p)
+    {
+      /* Abort program if the table counter overflows as well. */
+      if (item_p->refs > UINT32_MAX - refs)
+      {
+        jerry_fatal (ERR_REF_COUNT_LIMIT);
+      }
+
+      item_p->refs += refs;
+      return;
+    }
+
+    item_p = item_p->next_p;
+  }
+
+  /* Reference counting must not trigger a garbage collection. */
+  item_p = (ecma_ref_overflow_t *) jmem_heap_alloc_block_no_gc (sizeof (ecma_ref_overflow_t));
+
+  if (item_p == NULL)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  item_p->next_p = JERRY_CONTEXT (ref_overflow_p);
+  item_p->target_p = target_p;
+  item_p->refs = refs;
+  JERRY_CONTEXT (ref_overflow_p) = item_p;
+} /* ecma_ref_overflow_spill */
+
+/**
+ * Move references back from the reference overflow table.
+ *
+ * @return true - if the references are moved back
+ *         false - if the target has no references in the table
+ */
+bool
+ecma_ref_overflow_refill (const void *target_p, /**< object, string or byte code */
+                          uint32_t refs) /**< number of references */
+{
+  ecma_ref_overflow_t *prev_p = NULL;
+  ecma_ref_overflow_t *item_p = JERRY_CONTEXT (ref_overflow_p);
+
+  while (item_p != NULL)
+  {
+    if (item_p->target_p == target_p)
+    {
+      JERRY_ASSERT (item_p->refs >= refs);
+      item_p->refs -= refs;
+
+      if (item_p->refs == 0)
+      {
+        if (prev_p != NULL)
+        {
+          prev_p->next_p = item_p->next_p;
+        }
+        else
+        {
+          JERRY_CONTEXT (ref_overflow_p) = item_p->next_p;
+        }
+
+        jmem_heap_free_block (item_p, sizeof (ecma_ref_overflow_t));
+      }
+
+      return true;
+    }
+
+    prev_p = item_p;
+    item_p = item_p->next_p;
+  }
+
+  return false;
+} /* ecma_ref_overflow_refill */
+
 /**
  * Increase reference counter of Compact
  * Byte Code or regexp byte code.
@@ -1497,10 +1726,10 @@ ecma_clear_error_reference (ecma_value_t value, /**< error reference */
 void
 ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 {
-  /* Abort program if maximum reference number is reached. */
-  if (bytecode_p->refs >= UINT16_MAX)
+  if (JERRY_UNLIKELY (bytecode_p->refs >= UINT16_MAX))
   {
-    jerry_fatal (ERR_REF_COUNT_LIMIT);
+    ecma_ref_overflow_spill (bytecode_p, ECMA_BYTECODE_SPILL_REFS);
+    bytecode_p->refs = (uint16_t) (bytecode_p->refs - ECMA_BYTECODE_SPILL_REFS);
   }
 
   bytecode_p->refs++;
@@ -1516,6 +1745,12 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
   JERRY_ASSERT (bytecode_p->refs > 0);
   JERRY_ASSERT (!(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION));
 
+  if (JERRY_UNLIKELY (bytecode_p->refs == ECMA_BYTECODE_REFILL_LIMIT)
+      && ecma_ref_overflow_refill (bytecode_p, ECMA_BYTECODE_SPILL_REFS))
+  {
+    bytecode_p->refs = (uint16_t) (bytecode_p->refs + ECMA_BYTECODE_SPILL_REFS);
+  }
+
   bytecode_p->refs--;
 
   if (bytecode_p->refs > 0)
@@ -1561,6 +1796,10 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       }
     }
 
+#ifdef JERRY_JIT
+    vm_jit_free_function (bytecode_p);
+#endif /* JERRY_JIT */
+
 #ifdef JERRY_DEBUGGER
     if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_DEBUGGER_IGNORE)
@@ -1569,9 +1808,11 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       /* Delay the byte code free until the debugger client is notified.
        * If the connection is aborted the pointer is still freed by
        * jerry_debugger_close_connection(). */
+      uint32_t size = (uint32_t) (ecma_compiled_code_get_size (bytecode_p) >> JMEM_ALIGNMENT_LOG);
       jerry_debugger_byte_code_free_t *byte_code_free_p = (jerry_debugger_byte_code_free_t *) bytecode_p;
       jmem_cpointer_t byte_code_free_head = JERRY_CONTEXT (debugger_byte_code_free_head);
 
+      byte_code_free_p->size = size;
       byte_code_free_p->prev_cp = ECMA_NULL_POINTER;
 
       jmem_cpointer_t byte_code_free_cp;
@@ -1596,7 +1837,7 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 #endif /* JERRY_DEBUGGER */
 
 #ifdef JMEM_STATS
-    jmem_stats_free_byte_code_bytes (((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+    jmem_stats_free_byte_code_bytes (ecma_compiled_code_get_size (bytecode_p));
 #endif /* JMEM_STATS */
   }
   else
@@ -1608,8 +1849,7 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
   }
 
-  jmem_heap_free_block (bytecode_p,
-                        ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+  jmem_heap_free_block (bytecode_p, ecma_compiled_code_get_size (bytecode_p));
 } /* ecma_bytecode_deref */
 
 /**
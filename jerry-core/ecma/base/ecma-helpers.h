@@ -201,6 +201,7 @@ ecma_string_t *ecma_get_ecma_string_from_uint32 (uint32_t uint32_number);
 ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t num);
 ecma_string_t *ecma_get_magic_string (lit_magic_string_id_t id);
 ecma_string_t *ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t id);
+ecma_string_t *ecma_get_char_string (ecma_char_t code_unit);
 ecma_string_t *ecma_append_chars_to_string (ecma_string_t *string1_p,
                                             const lit_utf8_byte_t *cesu8_string2_p,
                                             lit_utf8_size_t cesu8_string2_size,
@@ -232,10 +233,15 @@ ecma_substring_copy_to_utf8_buffer (const ecma_string_t *string_desc_p,
                                     ecma_length_t end_pos,
                                     lit_utf8_byte_t *buffer_p,
                                     lit_utf8_size_t buffer_size);
+lit_utf8_size_t ecma_string_copy_chunk_to_buffer (const ecma_string_t *string_desc_p, lit_utf8_size_t *offset_p,
+                                                  lit_utf8_byte_t *buffer_p, lit_utf8_size_t buffer_size,
+                                                  bool is_utf8);
 void ecma_string_to_utf8_bytes (const ecma_string_t *string_desc_p, lit_utf8_byte_t *buffer_p,
                                 lit_utf8_size_t buffer_size);
 const lit_utf8_byte_t *ecma_string_get_chars (const ecma_string_t *string_p, lit_utf8_size_t *size_p, uint8_t *flags_p);
 bool ecma_compare_ecma_string_to_magic_id (const ecma_string_t *string_p, lit_magic_string_id_t id);
+bool ecma_compare_ecma_string_to_utf8 (const ecma_string_t *string_p, const lit_utf8_byte_t *chars_p,
+                                       lit_utf8_size_t size);
 bool ecma_string_is_empty (const ecma_string_t *string_p);
 bool ecma_string_is_length (const ecma_string_t *string_p);
 
@@ -310,6 +316,7 @@ uint8_t ecma_get_object_builtin_id (ecma_object_t *object_p);
 ecma_lexical_environment_type_t JERRY_ATTR_PURE ecma_get_lex_env_type (const ecma_object_t *object_p);
 ecma_object_t JERRY_ATTR_PURE *ecma_get_lex_env_outer_reference (const ecma_object_t *object_p);
 ecma_property_header_t JERRY_ATTR_PURE *ecma_get_property_list (const ecma_object_t *object_p);
+jmem_cpointer_t *ecma_get_property_list_head_cp (ecma_object_t *object_p);
 ecma_object_t JERRY_ATTR_PURE *ecma_get_lex_env_binding_object (const ecma_object_t *object_p);
 bool JERRY_ATTR_PURE ecma_get_lex_env_provide_this (const ecma_object_t *object_p);
 
@@ -358,6 +365,10 @@ void ecma_ref_error_reference (ecma_error_reference_t *error_ref_p);
 void ecma_deref_error_reference (ecma_error_reference_t *error_ref_p);
 ecma_value_t ecma_clear_error_reference (ecma_value_t value, bool set_abort_flag);
 
+size_t ecma_compiled_code_get_size (const ecma_compiled_code_t *bytecode_p);
+void ecma_compiled_code_set_size (ecma_compiled_code_t *bytecode_p, size_t size);
+void ecma_ref_overflow_spill (const void *target_p, uint32_t refs);
+bool ecma_ref_overflow_refill (const void *target_p, uint32_t refs);
 void ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p);
 void ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p);
 
@@ -365,7 +376,19 @@ void ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p);
 bool ecma_create_native_handle_property (ecma_object_t *obj_p, void *handle_p, void *free_cb);
 bool ecma_create_native_pointer_property (ecma_object_t *obj_p, void *native_p, void *info_p);
 ecma_native_pointer_t *ecma_get_native_pointer_value (ecma_object_t *obj_p, lit_magic_string_id_t id);
+ecma_object_t *ecma_create_native_object (void *native_p, void *info_p);
+ecma_native_pointer_t *ecma_get_native_object_slot (ecma_object_t *obj_p);
+ecma_native_info_registry_t *ecma_find_native_info_registry (void *info_p);
+void ecma_native_info_registry_insert (ecma_native_info_registry_t *registry_p, ecma_object_t *obj_p);
+void ecma_native_info_registry_remove (ecma_native_info_registry_t *registry_p, ecma_object_t *obj_p);
+void ecma_register_native_info (void *info_p);
+void ecma_finalize_native_info_registry (void);
 void ecma_free_native_pointer (ecma_property_t *prop_p);
+ecma_weak_ref_t *ecma_create_weak_ref (ecma_object_t *obj_p, ecma_object_native_free_callback_t callback_p,
+                                       void *user_p);
+void ecma_unlink_weak_ref (ecma_weak_ref_t *weak_ref_p);
+void ecma_free_weak_ref (ecma_weak_ref_t *weak_ref_p);
+void ecma_finalize_weak_refs (void);
 
 /* ecma-helpers-conversion.c */
 ecma_number_t ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, lit_utf8_size_t str_size);
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-builtins.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -46,6 +47,10 @@ ecma_init (void)
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HIGH_SEV_GC;
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+  JERRY_CONTEXT (arraybuffer_port_limit) = CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT;
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
 #ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
   ecma_job_queue_init ();
 #endif /* CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
@@ -57,12 +62,27 @@ ecma_init (void)
 void
 ecma_finalize (void)
 {
+  /* Run the pending finalizers while the engine is still intact, and call
+   * the free callbacks of the remaining objects directly from now on. */
+  ecma_gc_run_finalizers (0, 0);
+  JERRY_CONTEXT (jerry_init_flags) &= (uint32_t) ~ECMA_INIT_DEFERRED_FINALIZERS;
+
   jmem_unregister_free_unused_memory_callback (ecma_free_unused_memory);
 
   ecma_finalize_global_lex_env ();
   ecma_finalize_builtins ();
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+  ecma_finalize_native_info_registry ();
+  ecma_finalize_weak_refs ();
+  ecma_free_recycled_blocks ();
   ecma_finalize_lit_storage ();
+
+  /* All spilled references must be released by now. */
+  JERRY_ASSERT (JERRY_CONTEXT (ref_overflow_p) == NULL);
+
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+  JERRY_ASSERT (JERRY_CONTEXT (arraybuffer_port_allocated_size) == 0);
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
 } /* ecma_finalize */
 
 /**
@@ -17,6 +17,7 @@
 #include "ecma-literal-storage.h"
 #include "ecma-helpers.h"
 #include "jcontext.h"
+#include "re-bytecode.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -322,8 +323,14 @@ ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_
     ecma_compiled_code_t *bytecode_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
                                                                         literal_p[i]);
 
-    if ((bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
-        && bytecode_p != compiled_code_p)
+    if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+    {
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+      /* Regular expressions are saved in compiled form, only their pattern is a literal. */
+      ecma_save_literals_append_value (((re_compiled_code_t *) bytecode_p)->pattern, lit_pool_p);
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+    }
+    else if (bytecode_p != compiled_code_p)
     {
       ecma_save_literals_add_compiled_code (bytecode_p, lit_pool_p);
     }
@@ -332,7 +339,7 @@ ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_
   if (argument_end != 0)
   {
     uint8_t *byte_p = (uint8_t *) compiled_code_p;
-    byte_p += ((size_t) compiled_code_p->size) << JMEM_ALIGNMENT_LOG;
+    byte_p += ecma_compiled_code_get_size (compiled_code_p);
     literal_p = ((ecma_value_t *) byte_p) - argument_end;
 
     for (uint32_t i = 0; i < argument_end; i++)
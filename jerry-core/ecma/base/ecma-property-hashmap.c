@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-property-hashmap.h"
@@ -65,54 +66,14 @@ static const uint8_t ecma_property_hashmap_steps[ECMA_PROPERTY_HASHMAP_NUMBER_OF
 #define ECMA_PROPERTY_HASHMAP_SET_BIT(byte_p, index) \
   ((byte_p)[(index) >> 3] = (uint8_t) ((byte_p)[(index) >> 3] | (1 << ((index) & 0x7))))
 
-#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
-
 /**
- * Create a new property hashmap for the object.
- * The object must not have a property hashmap.
+ * Compute the size of a property hashmap for the given number of named properties.
+ *
+ * @return maximum property count of the hashmap (power of 2)
  */
-void
-ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
+static uint32_t
+ecma_property_hashmap_get_max_property_count (uint32_t named_property_count) /**< number of named properties */
 {
-#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
-  if (JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) != ECMA_PROP_HASHMAP_ALLOC_ON)
-  {
-    return;
-  }
-
-  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
-
-  if (prop_iter_p == NULL)
-  {
-    return;
-  }
-
-  JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
-
-  uint32_t named_property_count = 0;
-
-  while (prop_iter_p != NULL)
-  {
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
-
-    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
-    {
-      ecma_property_types_t type = ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[i]);
-
-      if (type == ECMA_PROPERTY_TYPE_NAMEDDATA || type == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
-      {
-        named_property_count++;
-      }
-    }
-    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
-                                    prop_iter_p->next_property_cp);
-  }
-
-  if (named_property_count < (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2))
-  {
-    return;
-  }
-
   /* The max_property_count must be power of 2. */
   uint32_t max_property_count = ECMA_PROPERTY_HASMAP_MINIMUM_SIZE;
 
@@ -122,27 +83,36 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
     max_property_count <<= 1;
   }
 
+  return max_property_count;
+} /* ecma_property_hashmap_get_max_property_count */
+
+/**
+ * Allocate an empty property hashmap which has enough space
+ * for the given number of named properties.
+ *
+ * @return pointer to the hashmap - if allocation is successful,
+ *         NULL - otherwise
+ */
+static ecma_property_hashmap_t *
+ecma_property_hashmap_alloc (uint32_t named_property_count) /**< expected number of named properties */
+{
+  uint32_t max_property_count = ecma_property_hashmap_get_max_property_count (named_property_count);
   size_t total_size = ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (max_property_count);
 
   ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) jmem_heap_alloc_block_null_on_error (total_size);
 
   if (hashmap_p == NULL)
   {
-    return;
+    return NULL;
   }
 
   memset (hashmap_p, 0, total_size);
 
   hashmap_p->header.types[0] = ECMA_PROPERTY_TYPE_HASHMAP;
-  hashmap_p->header.types[1] = 0;
-  hashmap_p->header.next_property_cp = object_p->property_list_or_bound_object_cp;
   hashmap_p->max_property_count = max_property_count;
-  hashmap_p->null_count = max_property_count - named_property_count;
-  hashmap_p->unused_count = max_property_count - named_property_count;
-
-  jmem_cpointer_t *pair_list_p = (jmem_cpointer_t *) (hashmap_p + 1);
-  uint8_t *bits_p = (uint8_t *) (pair_list_p + max_property_count);
-  uint32_t mask = max_property_count - 1;
+  hashmap_p->null_count = max_property_count;
+  hashmap_p->unused_count = max_property_count;
+  hashmap_p->free_pair_cp = ECMA_NULL_POINTER;
 
   uint8_t shift_counter = 0;
 
@@ -153,22 +123,54 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
   }
 
   hashmap_p->header.types[1] = shift_counter;
+  return hashmap_p;
+} /* ecma_property_hashmap_alloc */
 
-  prop_iter_p = ecma_get_property_list (object_p);
-  ECMA_SET_POINTER (object_p->property_list_or_bound_object_cp, hashmap_p);
+/**
+ * Insert the named properties of the object into its empty hashmap, and
+ * release the property pairs whose entries are all deleted.
+ */
+static void
+ecma_property_hashmap_fill (ecma_object_t *object_p, /**< object */
+                            ecma_property_hashmap_t *hashmap_p) /**< empty hashmap of the object */
+{
+  JERRY_ASSERT (ecma_get_property_list (object_p) == &hashmap_p->header);
+  JERRY_ASSERT (hashmap_p->free_pair_cp == ECMA_NULL_POINTER);
 
-  while (prop_iter_p != NULL)
+  uint32_t max_property_count = hashmap_p->max_property_count;
+  uint32_t named_property_count = 0;
+  jmem_cpointer_t *pair_list_p = (jmem_cpointer_t *) (hashmap_p + 1);
+  uint8_t *bits_p = (uint8_t *) (pair_list_p + max_property_count);
+  uint32_t mask = max_property_count - 1;
+  uint8_t shift_counter = hashmap_p->header.types[1];
+  jmem_cpointer_t *prop_iter_cp_p = &hashmap_p->header.next_property_cp;
+
+  while (*prop_iter_cp_p != ECMA_NULL_POINTER)
   {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *prop_iter_cp_p);
+
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_DELETED
+        && prop_iter_p->types[1] == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      /* Property pairs emptied by deletes are released. */
+      *prop_iter_cp_p = prop_iter_p->next_property_cp;
+      ecma_dealloc_property_pair ((ecma_property_pair_t *) prop_iter_p);
+      continue;
+    }
+
     for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
     {
+      ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
       if (!ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_iter_p->types[i]))
       {
+        JERRY_ASSERT (prop_iter_p->types[i] == ECMA_PROPERTY_TYPE_DELETED);
         continue;
       }
 
-      ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+      named_property_count++;
 
       uint32_t entry_index = ecma_string_get_property_name_hash (prop_iter_p->types[i],
                                                                  property_pair_p->names_cp[i]);
@@ -211,14 +213,134 @@ ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
       }
     }
 
+    prop_iter_cp_p = &prop_iter_p->next_property_cp;
+  }
+
+  JERRY_ASSERT (named_property_count < max_property_count);
+
+  hashmap_p->null_count = max_property_count - named_property_count;
+  hashmap_p->unused_count = max_property_count - named_property_count;
+} /* ecma_property_hashmap_fill */
+
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+/**
+ * Create a new property hashmap for the object.
+ * The object must not have a property hashmap.
+ */
+void
+ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  if (JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) != ECMA_PROP_HASHMAP_ALLOC_ON)
+  {
+    return;
+  }
+
+  uint32_t named_property_count = 0;
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_iter_p->types[i]))
+      {
+        named_property_count++;
+      }
+    }
+
     prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
                                     prop_iter_p->next_property_cp);
   }
+
+  if (named_property_count < (ECMA_PROPERTY_HASMAP_MINIMUM_SIZE / 2))
+  {
+    return;
+  }
+
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_alloc (named_property_count);
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  hashmap_p->header.next_property_cp = *ecma_get_property_list_head_cp (object_p);
+  ECMA_SET_POINTER (*ecma_get_property_list_head_cp (object_p), hashmap_p);
+
+  ecma_property_hashmap_fill (object_p, hashmap_p);
 #else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
   JERRY_UNUSED (object_p);
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 } /* ecma_property_hashmap_create */
 
+/**
+ * Create an empty property hashmap for a newly created object which is expected
+ * to receive the given number of named properties, and reserve property pairs
+ * for these properties.
+ *
+ * Note:
+ *      the reserved pairs are taken by ecma_create_property in an order which
+ *      keeps the enumeration order of the properties
+ */
+void
+ecma_property_hashmap_create_reserved (ecma_object_t *object_p, /**< object */
+                                       uint32_t named_property_count) /**< expected number of
+                                                                       *   named properties */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  JERRY_ASSERT (ecma_get_property_list (object_p) == NULL);
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+  if (JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) != ECMA_PROP_HASHMAP_ALLOC_ON)
+  {
+    return;
+  }
+
+  /* The hashmap is not reachable from the object until every pair is
+   * allocated, so a garbage collection triggered by the allocations
+   * cannot free it. */
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_alloc (named_property_count);
+
+  if (hashmap_p == NULL)
+  {
+    return;
+  }
+
+  jmem_cpointer_t *last_cp_p = &hashmap_p->header.next_property_cp;
+  uint32_t pair_count = (named_property_count + 1) >> 1;
+
+  while (pair_count > 0)
+  {
+    ecma_property_pair_t *property_pair_p = ecma_alloc_property_pair ();
+
+    property_pair_p->header.next_property_cp = ECMA_NULL_POINTER;
+    property_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    property_pair_p->header.types[1] = ECMA_PROPERTY_TYPE_DELETED;
+    property_pair_p->names_cp[0] = ECMA_PROPERTY_DELETED_NAME;
+    property_pair_p->names_cp[1] = ECMA_PROPERTY_DELETED_NAME;
+
+    /* Properties are enumerated in the reverse order of the list, so the
+     * last pair of the list must be the first item of the free list. */
+    property_pair_p->values[0].next_free_pair_cp = hashmap_p->free_pair_cp;
+    property_pair_p->values[1].next_free_pair_cp = hashmap_p->free_pair_cp;
+    ECMA_SET_NON_NULL_POINTER (hashmap_p->free_pair_cp, property_pair_p);
+
+    ECMA_SET_NON_NULL_POINTER (*last_cp_p, property_pair_p);
+    last_cp_p = &property_pair_p->header.next_property_cp;
+    pair_count--;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (*ecma_get_property_list_head_cp (object_p), hashmap_p);
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  JERRY_UNUSED (object_p);
+  JERRY_UNUSED (named_property_count);
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_create_reserved */
+
 /**
  * Free the hashmap of the object.
  * The object must have a property hashmap.
@@ -234,7 +356,7 @@ ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
 
   ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) property_p;
 
-  object_p->property_list_or_bound_object_cp = property_p->next_property_cp;
+  *ecma_get_property_list_head_cp (object_p) = property_p->next_property_cp;
 
   jmem_heap_free_block (hashmap_p,
                         ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count));
@@ -243,6 +365,29 @@ ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 } /* ecma_property_hashmap_free */
 
+/**
+ * Get the size of the property hashmap of an object.
+ *
+ * @return size of the allocated block in bytes
+ */
+size_t
+ecma_property_hashmap_get_size (ecma_object_t *object_p) /**< object */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  /* Property hash must be exists and must be the first property. */
+  ecma_property_header_t *property_p = ecma_get_property_list (object_p);
+
+  JERRY_ASSERT (property_p != NULL && property_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) property_p;
+
+  return ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (hashmap_p->max_property_count);
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  JERRY_UNUSED (object_p);
+  return 0;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_get_size */
+
 /**
  * Insert named property into the hashmap.
  */
@@ -253,16 +398,30 @@ ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
                               int property_index) /**< property index in the pair (0 or 1) */
 {
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
-  ecma_property_hashmap_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t,
-                                                                  object_p->property_list_or_bound_object_cp);
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) ecma_get_property_list (object_p);
 
   JERRY_ASSERT (hashmap_p->header.types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
 
   /* The NULLs are reduced below 1/8 of the hashmap. */
   if (hashmap_p->null_count < (hashmap_p->max_property_count >> 3))
   {
-    ecma_property_hashmap_free (object_p);
-    ecma_property_hashmap_create (object_p);
+    /* The new property is already in the property list. */
+    uint32_t named_property_count = hashmap_p->max_property_count - hashmap_p->unused_count + 1;
+
+    if (ecma_property_hashmap_get_max_property_count (named_property_count) != hashmap_p->max_property_count)
+    {
+      ecma_property_hashmap_free (object_p);
+      ecma_property_hashmap_create (object_p);
+      return;
+    }
+
+    /* Most of the non-NULL entries are deleted entries, so the
+     * hashmap has the right size: it is rehashed in place. */
+    uint32_t max_property_count = hashmap_p->max_property_count;
+    memset (hashmap_p + 1, 0, ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (max_property_count) - sizeof (*hashmap_p));
+    hashmap_p->free_pair_cp = ECMA_NULL_POINTER;
+
+    ecma_property_hashmap_fill (object_p, hashmap_p);
     return;
   }
 
@@ -333,28 +492,23 @@ ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
 /**
  * Delete named property from the hashmap.
  *
- * @return ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP if hashmap should be recreated
- *         ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP otherwise
+ * Note:
+ *      the entry is turned into a deleted entry which is
+ *      reused by ecma_property_hashmap_insert later, so
+ *      the hashmap is never rebuilt by a delete operation
  */
-ecma_property_hashmap_delete_status
+void
 ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
                               jmem_cpointer_t name_cp, /**< property name */
                               ecma_property_t *property_p) /**< property */
 {
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
-  ecma_property_hashmap_t *hashmap_p = ECMA_GET_NON_NULL_POINTER (ecma_property_hashmap_t,
-                                                                  object_p->property_list_or_bound_object_cp);
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) ecma_get_property_list (object_p);
 
   JERRY_ASSERT (hashmap_p->header.types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
 
   hashmap_p->unused_count++;
 
-  /* The NULLs are above 3/4 of the hashmap. */
-  if (hashmap_p->unused_count > ((hashmap_p->max_property_count * 3) >> 2))
-  {
-    return ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP;
-  }
-
   uint32_t entry_index = ecma_string_get_property_name_hash (*property_p, name_cp);
   uint32_t step = ecma_property_hashmap_steps[entry_index & (ECMA_PROPERTY_HASHMAP_NUMBER_OF_STEPS - 1)];
   uint32_t mask = hashmap_p->max_property_count - 1;
@@ -396,7 +550,7 @@ ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
 
         pair_list_p[entry_index] = ECMA_NULL_POINTER;
         ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
-        return ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
+        return;
       }
     }
     else
@@ -416,9 +570,53 @@ ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
   JERRY_UNUSED (name_cp);
   JERRY_UNUSED (property_p);
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
-  return ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP;
 } /* ecma_property_hashmap_delete */
 
+/**
+ * Take an entry reserved by ecma_property_hashmap_create_reserved.
+ * The object must have a property hashmap.
+ *
+ * @return property pair which contains the deleted entry if there is any
+ *         NULL otherwise
+ */
+ecma_property_pair_t *
+ecma_property_hashmap_take_free_slot (ecma_object_t *object_p, /**< object */
+                                      int *property_index_p) /**< [out] index of the deleted entry (0 or 1) */
+{
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  ecma_property_hashmap_t *hashmap_p = (ecma_property_hashmap_t *) ecma_get_property_list (object_p);
+
+  JERRY_ASSERT (hashmap_p->header.types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+
+  if (hashmap_p->free_pair_cp == ECMA_NULL_POINTER)
+  {
+    return NULL;
+  }
+
+  ecma_property_pair_t *property_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t,
+                                                                     hashmap_p->free_pair_cp);
+
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+  /* The second entry precedes the first one in the enumeration order. */
+  int property_index = (property_pair_p->header.types[1] == ECMA_PROPERTY_TYPE_DELETED) ? 1 : 0;
+
+  JERRY_ASSERT (property_pair_p->header.types[property_index] == ECMA_PROPERTY_TYPE_DELETED);
+
+  if (property_pair_p->header.types[1 - property_index] != ECMA_PROPERTY_TYPE_DELETED)
+  {
+    hashmap_p->free_pair_cp = property_pair_p->values[property_index].next_free_pair_cp;
+  }
+
+  *property_index_p = property_index;
+  return property_pair_p;
+#else /* CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+  JERRY_UNUSED (object_p);
+  JERRY_UNUSED (property_index_p);
+  return NULL;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+} /* ecma_property_hashmap_take_free_slot */
+
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 /**
  * Find a named property.
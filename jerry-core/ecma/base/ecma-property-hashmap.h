@@ -37,6 +37,7 @@ typedef struct
   uint32_t max_property_count; /**< maximum property count (power of 2) */
   uint32_t null_count; /**< number of NULLs in the map */
   uint32_t unused_count; /**< number of unused entires in the map */
+  jmem_cpointer_t free_pair_cp; /**< list of property pairs reserved for new properties */
 
   /*
    * The hash is followed by max_property_count ecma_cpointer_t
@@ -50,25 +51,23 @@ typedef struct
    * If the compressed pointer is not equal to ECMA_NULL_POINTER
    *   - flag is cleared if the first entry of a property pair is referenced
    *   - flag is set if the second entry of a property pair is referenced
+   *
+   * The property pairs reserved by ecma_property_hashmap_create_reserved
+   * are linked into the free_pair_cp list. The next_free_pair_cp field
+   * of each reserved entry's value holds the next item of this list.
+   * Other deleted entries are not reused (except the first entry of the
+   * list), because that would change the enumeration order.
    */
 } ecma_property_hashmap_t;
 
-/**
- * Simple ecma values
- */
-typedef enum
-{
-  ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP, /**< object has no hashmap */
-  ECMA_PROPERTY_HASHMAP_DELETE_HAS_HASHMAP, /**< object has hashmap */
-  ECMA_PROPERTY_HASHMAP_DELETE_RECREATE_HASHMAP, /**< hashmap should be recreated */
-} ecma_property_hashmap_delete_status;
-
 void ecma_property_hashmap_create (ecma_object_t *object_p);
+void ecma_property_hashmap_create_reserved (ecma_object_t *object_p, uint32_t named_property_count);
 void ecma_property_hashmap_free (ecma_object_t *object_p);
+size_t ecma_property_hashmap_get_size (ecma_object_t *object_p);
 void ecma_property_hashmap_insert (ecma_object_t *object_p, ecma_string_t *name_p,
                                    ecma_property_pair_t *property_pair_p, int property_index);
-ecma_property_hashmap_delete_status ecma_property_hashmap_delete (ecma_object_t *object_p, jmem_cpointer_t name_cp,
-                                                                  ecma_property_t *property_p);
+void ecma_property_hashmap_delete (ecma_object_t *object_p, jmem_cpointer_t name_cp, ecma_property_t *property_p);
+ecma_property_pair_t *ecma_property_hashmap_take_free_slot (ecma_object_t *object_p, int *property_index_p);
 
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 ecma_property_t *ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, ecma_string_t *name_p,
@@ -21,6 +21,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jmem.h"
 
 #ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
@@ -32,6 +33,85 @@
  * @{
  */
 
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+
+/**
+ * Helper function: create arraybuffer object whose data buffer is allocated by the port
+ *
+ * The object has the same layout as the external arraybuffer objects, but
+ * the buffer is released by ecma_arraybuffer_free_port_memory instead of
+ * a user provided callback.
+ *
+ * @return ecma_object_t * - if the port could allocate the data buffer
+ *         NULL - otherwise
+ */
+static ecma_object_t *
+ecma_arraybuffer_new_object_port_memory (ecma_length_t length) /**< length of the arraybuffer */
+{
+  JERRY_ASSERT (length > 0);
+
+  if (JERRY_CONTEXT (arraybuffer_port_allocated_size) + length >= JERRY_CONTEXT (arraybuffer_port_limit))
+  {
+    /* The size of external data is not visible to the heap limit, so
+     * unreachable buffers are collected here before allocating more. */
+    ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+  }
+
+  void *buffer_p = jerry_port_arraybuffer_alloc (length);
+
+  if (buffer_p == NULL)
+  {
+    return NULL;
+  }
+
+  memset (buffer_p, 0, length);
+
+  ecma_object_t *object_p = ecma_arraybuffer_new_object_external (length, buffer_p, NULL);
+  ((ecma_extended_object_t *) object_p)->u.class_prop.extra_info |= ECMA_ARRAYBUFFER_PORT_MEMORY;
+
+  JERRY_CONTEXT (arraybuffer_port_allocated_size) += length;
+
+  while (JERRY_CONTEXT (arraybuffer_port_allocated_size) >= JERRY_CONTEXT (arraybuffer_port_limit))
+  {
+    JERRY_CONTEXT (arraybuffer_port_limit) += CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT;
+  }
+
+#ifdef JMEM_STATS
+  jmem_stats_allocate_external_bytes (length);
+#endif /* JMEM_STATS */
+
+  return object_p;
+} /* ecma_arraybuffer_new_object_port_memory */
+
+/**
+ * Free the data buffer of an arraybuffer object allocated by the port
+ */
+void
+ecma_arraybuffer_free_port_memory (ecma_object_t *object_p) /**< ArrayBuffer object */
+{
+  JERRY_ASSERT (ECMA_ARRAYBUFFER_HAS_PORT_MEMORY (object_p));
+
+  ecma_arraybuffer_external_info *array_p = (ecma_arraybuffer_external_info *) object_p;
+  ecma_length_t length = array_p->extended_object.u.class_prop.u.length;
+
+  jerry_port_arraybuffer_free (array_p->buffer_p, length);
+
+  JERRY_ASSERT (JERRY_CONTEXT (arraybuffer_port_allocated_size) >= length);
+  JERRY_CONTEXT (arraybuffer_port_allocated_size) -= length;
+
+  while (JERRY_CONTEXT (arraybuffer_port_allocated_size) + CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT
+         <= JERRY_CONTEXT (arraybuffer_port_limit))
+  {
+    JERRY_CONTEXT (arraybuffer_port_limit) -= CONFIG_ECMA_ARRAYBUFFER_PORT_DESIRED_LIMIT;
+  }
+
+#ifdef JMEM_STATS
+  jmem_stats_free_external_bytes (length);
+#endif /* JMEM_STATS */
+} /* ecma_arraybuffer_free_port_memory */
+
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
 /**
  * Helper function: create arraybuffer object based on the array length
  *
@@ -40,11 +120,28 @@
  *   extend_part
  *   data buffer
  *
+ * Note:
+ *      if JERRY_ARRAYBUFFER_PORT_ALLOCATOR is defined, the data buffer of large
+ *      arraybuffers is allocated by the port, and the object is an external
+ *      arraybuffer object (see also: ecma_arraybuffer_new_object_external)
+ *
  * @return ecma_object_t *
  */
 ecma_object_t *
 ecma_arraybuffer_new_object (ecma_length_t length) /**< length of the arraybuffer */
 {
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+  if (length >= CONFIG_ECMA_ARRAYBUFFER_PORT_ALLOC_THRESHOLD)
+  {
+    ecma_object_t *object_p = ecma_arraybuffer_new_object_port_memory (length);
+
+    if (object_p != NULL)
+    {
+      return object_p;
+    }
+  }
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE);
   ecma_object_t *object_p = ecma_create_object (prototype_obj_p,
                                                 sizeof (ecma_extended_object_t) + length,
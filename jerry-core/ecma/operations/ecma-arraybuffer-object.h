@@ -44,6 +44,10 @@ ecma_length_t JERRY_ATTR_PURE
 ecma_arraybuffer_get_length (ecma_object_t *obj_p);
 bool
 ecma_is_arraybuffer (ecma_value_t val);
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+void
+ecma_arraybuffer_free_port_memory (ecma_object_t *obj_p);
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
 
 /**
  * @}
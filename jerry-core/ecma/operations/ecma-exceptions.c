@@ -23,6 +23,7 @@
 #include "ecma-objects.h"
 #include "jcontext.h"
 #include "jrt.h"
+#include "jrt-tracepoints.h"
 
 #ifdef JERRY_ENABLE_LINE_INFO
 #include "vm.h"
@@ -146,25 +147,105 @@ ecma_new_standard_error (ecma_standard_error_t error_type) /**< native error typ
   ((ecma_extended_object_t *) new_error_obj_p)->u.class_prop.class_id = LIT_MAGIC_STRING_ERROR_UL;
 
 #ifdef JERRY_ENABLE_LINE_INFO
-  /* The "stack" identifier is not a magic string. */
-  const char *stack_id_p = "stack";
+  /* The "stack" property is instantiated from the backtrace when it is first accessed. */
+  ecma_backtrace_t *backtrace_p = vm_capture_backtrace (CONFIG_ECMA_ERROR_BACKTRACE_DEPTH);
 
-  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) stack_id_p, 5);
+  ECMA_SET_INTERNAL_VALUE_POINTER (((ecma_extended_object_t *) new_error_obj_p)->u.class_prop.u.value,
+                                   backtrace_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
-  ecma_property_value_t *prop_value_p = ecma_create_named_data_property (new_error_obj_p,
-                                                                         stack_str_p,
-                                                                         ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
-                                                                         NULL);
-  ecma_deref_ecma_string (stack_str_p);
+  return new_error_obj_p;
+} /* ecma_new_standard_error */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * The "stack" identifier is not a magic string.
+ */
+static const char ecma_error_stack_id[] = "stack";
+
+/**
+ * Create the "stack" property of an error object from its captured backtrace.
+ *
+ * @return pointer to the property, if it was instantiated,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_op_error_try_to_lazy_instantiate_property (ecma_object_t *object_p, /**< error object */
+                                                ecma_string_t *property_name_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ERROR_UL));
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+  ecma_backtrace_t *backtrace_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_backtrace_t,
+                                                                       ext_object_p->u.class_prop.u.value);
+
+  if (backtrace_p == NULL
+      || !ecma_compare_ecma_string_to_utf8 (property_name_p,
+                                            (const lit_utf8_byte_t *) ecma_error_stack_id,
+                                            sizeof (ecma_error_stack_id) - 1))
+  {
+    return NULL;
+  }
+
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (ext_object_p->u.class_prop.u.value, NULL);
 
-  ecma_value_t backtrace_value = vm_get_backtrace (0);
+  ecma_value_t backtrace_value = vm_backtrace_to_array (backtrace_p);
+  vm_free_backtrace (backtrace_p);
 
+  ecma_property_t *stack_prop_p;
+  ecma_property_value_t *prop_value_p = ecma_create_named_data_property (object_p,
+                                                                         property_name_p,
+                                                                         ECMA_PROPERTY_CONFIGURABLE_WRITABLE,
+                                                                         &stack_prop_p);
   prop_value_p->value = backtrace_value;
   ecma_deref_object (ecma_get_object_from_value (backtrace_value));
-#endif /* JERRY_ENABLE_LINE_INFO */
 
-  return new_error_obj_p;
-} /* ecma_new_standard_error */
+  return stack_prop_p;
+} /* ecma_op_error_try_to_lazy_instantiate_property */
+
+/**
+ * List names of an error object's lazy instantiated properties,
+ * adding them to corresponding string collections
+ *
+ * See also:
+ *          ecma_op_error_try_to_lazy_instantiate_property
+ */
+void
+ecma_op_error_list_lazy_property_names (ecma_object_t *object_p, /**< error object */
+                                        bool separate_enumerable, /**< true - list enumerable properties into
+                                                                   *          main collection and non-enumerable
+                                                                   *          to collection of 'skipped
+                                                                   *          non-enumerable' properties,
+                                                                   *   false - list all properties into main
+                                                                   *           collection.
+                                                                   */
+                                        ecma_collection_header_t *main_collection_p, /**< 'main' collection */
+                                        ecma_collection_header_t *non_enum_collection_p) /**< skipped
+                                                                                          *   'non-enumerable'
+                                                                                          *   collection */
+{
+  JERRY_ASSERT (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ERROR_UL));
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  if (ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_backtrace_t, ext_object_p->u.class_prop.u.value) == NULL)
+  {
+    return;
+  }
+
+  ecma_collection_header_t *for_non_enumerable_p = separate_enumerable ? non_enum_collection_p : main_collection_p;
+
+  /* The 'stack' property is non-enumerable. */
+  ecma_string_t *stack_str_p = ecma_new_ecma_string_from_utf8 ((const lit_utf8_byte_t *) ecma_error_stack_id,
+                                                               sizeof (ecma_error_stack_id) - 1);
+
+  ecma_append_to_values_collection (for_non_enumerable_p,
+                                    ecma_make_string_value (stack_str_p),
+                                    ECMA_COLLECTION_NO_COPY);
+} /* ecma_op_error_list_lazy_property_names */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 /**
  * Return the error type for an Error object.
@@ -242,6 +323,7 @@ ecma_raise_standard_error (ecma_standard_error_t error_type, /**< error type */
 
   JERRY_CONTEXT (error_value) = ecma_make_object_value (error_obj_p);
   JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
+  JERRY_TRACEPOINT2 (exception__raise, JERRY_CONTEXT (error_value), error_type);
   return ECMA_VALUE_ERROR;
 } /* ecma_raise_standard_error */
 
@@ -330,6 +412,7 @@ ecma_raise_standard_error_with_format (ecma_standard_error_t error_type, /**< er
 
   JERRY_CONTEXT (error_value) = ecma_make_object_value (error_obj_p);
   JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
+  JERRY_TRACEPOINT2 (exception__raise, JERRY_CONTEXT (error_value), error_type);
   return ECMA_VALUE_ERROR;
 } /* ecma_raise_standard_error_with_format */
 
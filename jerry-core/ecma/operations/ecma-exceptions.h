@@ -65,6 +65,14 @@ ecma_value_t ecma_raise_syntax_error (const char *msg_p);
 ecma_value_t ecma_raise_type_error (const char *msg_p);
 ecma_value_t ecma_raise_uri_error (const char *msg_p);
 
+#ifdef JERRY_ENABLE_LINE_INFO
+ecma_property_t *ecma_op_error_try_to_lazy_instantiate_property (ecma_object_t *object_p,
+                                                                 ecma_string_t *property_name_p);
+void ecma_op_error_list_lazy_property_names (ecma_object_t *object_p, bool separate_enumerable,
+                                             ecma_collection_header_t *main_collection_p,
+                                             ecma_collection_header_t *non_enum_collection_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * @}
  * @}
@@ -24,8 +24,10 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
+#include "ecma-property-hashmap.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "jrt-libc-includes.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -638,6 +640,103 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
   return ret_value;
 } /* ecma_op_function_call */
 
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+
+/**
+ * Get the construct cache entry which belongs to a function object.
+ *
+ * @return pointer to the entry
+ */
+static inline ecma_construct_cache_entry_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_op_function_get_construct_cache_entry (ecma_object_t *func_obj_p) /**< function object */
+{
+  uintptr_t index = ((uintptr_t) func_obj_p) >> JMEM_ALIGNMENT_LOG;
+
+  return JERRY_CONTEXT (ecma_construct_cache) + (index & (ECMA_CONSTRUCT_CACHE_SIZE - 1));
+} /* ecma_op_function_get_construct_cache_entry */
+
+/**
+ * Store the 'prototype' property of a function object in the construct cache.
+ *
+ * Note:
+ *      only non-configurable data properties are cached, because these
+ *      cannot be deleted or redefined, so the cached pointer stays valid
+ *      until the function is freed, and reading the value through it
+ *      always returns the current value of the property
+ *
+ * @return pointer to the cache entry - if the property is cached,
+ *         NULL - otherwise
+ */
+static ecma_construct_cache_entry_t *
+ecma_op_function_construct_cache_insert (ecma_object_t *func_obj_p) /**< function object */
+{
+  ecma_property_t *property_p = ecma_find_named_property (func_obj_p,
+                                                          ecma_get_magic_string (LIT_MAGIC_STRING_PROTOTYPE));
+
+  if (property_p == NULL
+      || ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+      || ecma_is_property_configurable (*property_p))
+  {
+    return NULL;
+  }
+
+  ecma_construct_cache_entry_t *entry_p = ecma_op_function_get_construct_cache_entry (func_obj_p);
+
+  entry_p->function_p = func_obj_p;
+  entry_p->prototype_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+  entry_p->property_count = 0;
+  return entry_p;
+} /* ecma_op_function_construct_cache_insert */
+
+/**
+ * Count the named properties of a newly constructed object.
+ *
+ * @return number of named properties
+ */
+static uint32_t
+ecma_op_function_count_instance_properties (ecma_object_t *obj_p) /**< object */
+{
+  uint32_t property_count = 0;
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_IS_NAMED_PROPERTY (prop_iter_p->types[i]))
+      {
+        property_count++;
+      }
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return property_count;
+} /* ecma_op_function_count_instance_properties */
+
+/**
+ * Clear the construct cache.
+ *
+ * Note:
+ *      the cache does not hold references to the functions,
+ *      so it must be cleared when objects are freed
+ */
+void
+ecma_op_function_construct_cache_clear (void)
+{
+  memset (JERRY_CONTEXT (ecma_construct_cache), 0, sizeof (JERRY_CONTEXT (ecma_construct_cache)));
+} /* ecma_op_function_construct_cache_clear */
+
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+
 /**
  * [[Construct]] implementation for Function objects (13.2.2),
  * created through 13.2 (ECMA_OBJECT_TYPE_FUNCTION) and
@@ -655,12 +754,32 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
                 || ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION);
 
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+  ecma_value_t func_obj_prototype_prop_value;
+  uint32_t instance_property_count = 0;
 
-  /* 5. */
-  ECMA_TRY_CATCH (func_obj_prototype_prop_value,
-                  ecma_op_object_get_by_magic_id (func_obj_p,
-                                                  LIT_MAGIC_STRING_PROTOTYPE),
-                  ret_value);
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+  ecma_construct_cache_entry_t *cache_entry_p = ecma_op_function_get_construct_cache_entry (func_obj_p);
+
+  if (cache_entry_p->function_p == func_obj_p)
+  {
+    func_obj_prototype_prop_value = ecma_copy_value (cache_entry_p->prototype_value_p->value);
+    instance_property_count = cache_entry_p->property_count;
+  }
+  else
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+  {
+    /* 5. */
+    func_obj_prototype_prop_value = ecma_op_object_get_by_magic_id (func_obj_p, LIT_MAGIC_STRING_PROTOTYPE);
+
+    if (ECMA_IS_VALUE_ERROR (func_obj_prototype_prop_value))
+    {
+      return func_obj_prototype_prop_value;
+    }
+
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+    ecma_op_function_construct_cache_insert (func_obj_p);
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+  }
 
   /* 1., 2., 4. */
   ecma_object_t *obj_p;
@@ -681,6 +800,15 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
     ecma_deref_object (prototype_p);
   }
 
+  ecma_free_value (func_obj_prototype_prop_value);
+
+  if (instance_property_count >= ECMA_PROPERTY_HASMAP_MINIMUM_SIZE)
+  {
+    /* Large instances would get a hashmap after a few property
+     * insertions anyway, so it is created before the call. */
+    ecma_property_hashmap_create_reserved (obj_p, instance_property_count);
+  }
+
   /* 3. */
   /*
    * [[Class]] property of ECMA_OBJECT_TYPE_GENERAL type objects
@@ -708,14 +836,21 @@ ecma_op_function_construct_simple_or_external (ecma_object_t *func_obj_p, /**< F
     /* 10. */
     ecma_ref_object (obj_p);
     ret_value = ecma_make_object_value (obj_p);
+
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+    /* The call may run a garbage collection or construct other
+     * objects, so the entry must be checked again. */
+    if (cache_entry_p->function_p == func_obj_p)
+    {
+      cache_entry_p->property_count = ecma_op_function_count_instance_properties (obj_p);
+    }
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
   }
 
   ECMA_FINALIZE (call_completion);
 
   ecma_deref_object (obj_p);
 
-  ECMA_FINALIZE (func_obj_prototype_prop_value);
-
   return ret_value;
 } /* ecma_op_function_construct_simple_or_external */
 
@@ -62,6 +62,10 @@ ecma_value_t
 ecma_op_function_construct (ecma_object_t *func_obj_p, const ecma_value_t *arguments_list_p,
                             ecma_length_t arguments_list_len);
 
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+void ecma_op_function_construct_cache_clear (void);
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+
 ecma_property_t *
 ecma_op_function_try_to_lazy_instantiate_property (ecma_object_t *object_p, ecma_string_t *property_name_p);
 
@@ -14,6 +14,7 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-element-store.h"
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
@@ -146,6 +147,16 @@ ecma_op_general_object_delete (ecma_object_t *obj_p, /**< the object */
                 && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (property_name_p != NULL);
 
+  ecma_value_t *element_value_p = ecma_element_store_find_by_name (obj_p, property_name_p);
+
+  if (element_value_p != NULL)
+  {
+    /* Elements are always configurable. */
+    ecma_free_value_if_not_object (*element_value_p);
+    ecma_element_store_delete (obj_p, element_value_p);
+    return ECMA_VALUE_TRUE;
+  }
+
   /* 1. */
   ecma_property_ref_t property_ref;
 
@@ -308,6 +319,35 @@ ecma_op_general_object_define_own_property (ecma_object_t *object_p, /**< the ob
   JERRY_ASSERT (property_desc_p->is_enumerable_defined || !property_desc_p->is_enumerable);
   JERRY_ASSERT (property_desc_p->is_writable_defined || !property_desc_p->is_writable);
 
+  ecma_value_t *element_value_p = ecma_element_store_find_by_name (object_p, property_name_p);
+
+  if (element_value_p != NULL)
+  {
+    /* Elements are configurable, enumerable and writable data properties. */
+    if (property_desc_type != ECMA_PROPERTY_TYPE_NAMEDACCESSOR
+        && (property_desc_p->is_configurable || !property_desc_p->is_configurable_defined)
+        && (property_desc_p->is_enumerable || !property_desc_p->is_enumerable_defined)
+        && (property_desc_p->is_writable || !property_desc_p->is_writable_defined))
+    {
+      if (property_desc_p->is_value_defined)
+      {
+        ecma_value_assign_value (element_value_p, property_desc_p->value);
+      }
+
+      return ECMA_VALUE_TRUE;
+    }
+
+    /* Otherwise the element is moved into the property list. The property is
+     * created first, so the value is always referenced by the object. */
+    ecma_property_value_t *prop_value_p;
+    prop_value_p = ecma_create_named_data_property (object_p,
+                                                    property_name_p,
+                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                    NULL);
+    prop_value_p->value = *element_value_p;
+    ecma_element_store_delete (object_p, element_value_p);
+  }
+
   /* 1. */
   ecma_extended_property_ref_t ext_property_ref = { .property_ref.value_p = NULL, .property_p = NULL };
   ecma_property_t current_prop;
@@ -350,14 +390,25 @@ ecma_op_general_object_define_own_property (ecma_object_t *object_p, /**< the ob
         prop_attributes = (uint8_t) (prop_attributes | ECMA_PROPERTY_FLAG_WRITABLE);
       }
 
+      JERRY_ASSERT (property_desc_p->is_value_defined
+                    || ecma_is_value_undefined (property_desc_p->value));
+
+      if (prop_attributes == ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE)
+      {
+        uint32_t index = ecma_string_get_array_index (property_name_p);
+
+        if (index != ECMA_STRING_NOT_ARRAY_INDEX
+            && ecma_element_store_insert (object_p, index, property_desc_p->value))
+        {
+          return ECMA_VALUE_TRUE;
+        }
+      }
+
       ecma_property_value_t *new_prop_value_p = ecma_create_named_data_property (object_p,
                                                                                  property_name_p,
                                                                                  prop_attributes,
                                                                                  NULL);
 
-      JERRY_ASSERT (property_desc_p->is_value_defined
-                    || ecma_is_value_undefined (property_desc_p->value));
-
       new_prop_value_p->value = ecma_copy_value_if_not_object (property_desc_p->value);
     }
     else
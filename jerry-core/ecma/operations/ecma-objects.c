@@ -16,6 +16,7 @@
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-builtin-helpers.h"
+#include "ecma-element-store.h"
 #include "ecma-exceptions.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -79,6 +80,21 @@ ecma_op_object_get_own_property (ecma_object_t *object_p, /**< the object */
 
   switch (type)
   {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      ecma_value_t *element_value_p = ecma_element_store_find_by_name (object_p, property_name_p);
+
+      if (element_value_p != NULL)
+      {
+        if (options & ECMA_PROPERTY_GET_VALUE)
+        {
+          property_ref_p->virtual_value = ecma_fast_copy_value (*element_value_p);
+        }
+
+        return ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE | ECMA_PROPERTY_TYPE_VIRTUAL;
+      }
+      break;
+    }
     case ECMA_OBJECT_TYPE_CLASS:
     {
       ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
@@ -249,6 +265,12 @@ ecma_op_object_get_own_property (ecma_object_t *object_p, /**< the object */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#ifdef JERRY_ENABLE_LINE_INFO
+    else if (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ERROR_UL))
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
 
     if (property_p == NULL)
     {
@@ -404,6 +426,16 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
 
   switch (type)
   {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      ecma_value_t *element_value_p = ecma_element_store_find_by_name (object_p, property_name_p);
+
+      if (element_value_p != NULL)
+      {
+        return ecma_fast_copy_value (*element_value_p);
+      }
+      break;
+    }
     case ECMA_OBJECT_TYPE_CLASS:
     {
       ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
@@ -567,6 +599,12 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#ifdef JERRY_ENABLE_LINE_INFO
+    else if (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ERROR_UL))
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
 
     if (property_p == NULL)
     {
@@ -758,6 +796,18 @@ ecma_op_object_put (ecma_object_t *object_p, /**< the object */
 
   switch (type)
   {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      ecma_value_t *element_value_p = ecma_element_store_find_by_name (object_p, property_name_p);
+
+      if (element_value_p != NULL)
+      {
+        /* Elements are always writable. */
+        ecma_value_assign_value (element_value_p, value);
+        return ECMA_VALUE_TRUE;
+      }
+      break;
+    }
     case ECMA_OBJECT_TYPE_ARRAY:
     {
       if (ecma_string_is_length (property_name_p))
@@ -889,6 +939,12 @@ ecma_op_object_put (ecma_object_t *object_p, /**< the object */
     {
       property_p = ecma_op_bound_function_try_to_lazy_instantiate_property (object_p, property_name_p);
     }
+#ifdef JERRY_ENABLE_LINE_INFO
+    else if (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ERROR_UL))
+    {
+      property_p = ecma_op_error_try_to_lazy_instantiate_property (object_p, property_name_p);
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
   }
 
   if (property_p != NULL)
@@ -980,6 +1036,12 @@ ecma_op_object_put (ecma_object_t *object_p, /**< the object */
         }
       }
 
+      if (index != ECMA_STRING_NOT_ARRAY_INDEX
+          && ecma_element_store_insert (object_p, index, value))
+      {
+        return ECMA_VALUE_TRUE;
+      }
+
       ecma_property_value_t *new_prop_value_p;
       new_prop_value_p = ecma_create_named_data_property (object_p,
                                                           property_name_p,
@@ -1441,6 +1503,15 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                                      prop_names_p,
                                                      skipped_non_enumerable_p);
           }
+#ifdef JERRY_ENABLE_LINE_INFO
+          else if (ext_object_p->u.class_prop.class_id == LIT_MAGIC_STRING_ERROR_UL)
+          {
+            ecma_op_error_list_lazy_property_names (obj_p,
+                                                    is_enumerable_only,
+                                                    prop_names_p,
+                                                    skipped_non_enumerable_p);
+          }
+#endif /* JERRY_ENABLE_LINE_INFO */
 
           break;
         }
@@ -1460,6 +1531,9 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
+    /* Elements are not part of the property list. */
+    ecma_element_store_list_names (prototype_chain_iter_p, prop_names_p);
+
     ecma_value_t *ecma_value_p = ecma_collection_iterator_init (prop_names_p);
 
     const size_t own_names_hashes_bitmap_size = ECMA_OBJECT_HASH_BITMAP_SIZE / bitmap_row_size;
@@ -40,6 +40,7 @@ extern "C"
 #define JERRY_ATTR_NORETURN __attribute__((noreturn))
 #define JERRY_ATTR_PURE __attribute__((pure))
 #define JERRY_ATTR_SECTION(SECTION) __attribute__((section(SECTION)))
+#define JERRY_ATTR_THREAD_LOCAL __thread
 #define JERRY_ATTR_WARN_UNUSED_RESULT __attribute__((warn_unused_result))
 
 #define JERRY_LIKELY(x) __builtin_expect(!!(x), 1)
@@ -55,6 +56,7 @@ extern "C"
 #define JERRY_ATTR_DEPRECATED __declspec(deprecated)
 #define JERRY_ATTR_NOINLINE __declspec(noinline)
 #define JERRY_ATTR_NORETURN __declspec(noreturn)
+#define JERRY_ATTR_THREAD_LOCAL __declspec(thread)
 
 /*
  * Microsoft Visual C/C++ Compiler doesn't support for VLA, using _alloca
@@ -113,6 +115,10 @@ void * __cdecl _alloca (size_t _Size);
 #define JERRY_ATTR_SECTION(SECTION)
 #endif /* !JERRY_ATTR_SECTION */
 
+#ifndef JERRY_ATTR_THREAD_LOCAL
+#define JERRY_ATTR_THREAD_LOCAL
+#endif /* !JERRY_ATTR_THREAD_LOCAL */
+
 #ifndef JERRY_ATTR_WARN_UNUSED_RESULT
 #define JERRY_ATTR_WARN_UNUSED_RESULT
 #endif /* !JERRY_ATTR_WARN_UNUSED_RESULT */
@@ -52,6 +52,8 @@ typedef enum
   JERRY_INIT_MEM_STATS           = (1u << 2), /**< dump memory statistics */
   JERRY_INIT_MEM_STATS_SEPARATE  = (1u << 3), /**< deprecated, an unused placeholder now */
   JERRY_INIT_DEBUGGER            = (1u << 4), /**< deprecated, an unused placeholder now */
+  JERRY_INIT_DEFERRED_FINALIZERS = (1u << 5), /**< queue native free callbacks instead of calling them during
+                                               *   garbage collection (see jerry_run_deferred_finalizers) */
 } jerry_init_flag_t;
 
 /**
@@ -91,6 +93,9 @@ typedef enum
   JERRY_FEATURE_DATE, /**< Date support */
   JERRY_FEATURE_REGEXP, /**< Regexp support */
   JERRY_FEATURE_LINE_INFO, /**< line info available */
+  JERRY_FEATURE_QUOTAS, /**< execution and memory quotas */
+  JERRY_FEATURE_TRACEPOINTS, /**< static tracepoints */
+  JERRY_FEATURE_JIT, /**< baseline JIT compiler */
   JERRY_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jerry_feature_t;
 
@@ -180,9 +185,20 @@ typedef struct
   size_t size; /**< heap total size */
   size_t allocated_bytes; /**< currently allocated bytes */
   size_t peak_allocated_bytes; /**< peak allocated bytes */
-  size_t reserved[4]; /**< padding for future extensions */
+  size_t external_bytes; /**< currently allocated bytes outside of the heap */
+  size_t peak_external_bytes; /**< peak allocated bytes outside of the heap */
+  size_t reserved[2]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Cursor for exporting the contents of a string in successive chunks.
+ */
+typedef struct
+{
+  jerry_value_t value; /**< string value (the cursor does not hold a reference to it) */
+  jerry_size_t offset; /**< byte offset of the next chunk in the cesu-8 representation of the string */
+} jerry_string_cursor_t;
+
 /**
  * Type of an external function handler.
  */
@@ -296,6 +312,26 @@ typedef struct
  */
 typedef struct jerry_instance_t jerry_instance_t;
 
+/**
+ * Execution and memory quotas of an engine instance. Zero means no limit.
+ */
+typedef struct
+{
+  uint32_t heap_limit; /**< maximum heap usage in bytes */
+  uint32_t branch_limit; /**< maximum number of backward jumps and function calls */
+  uint32_t call_depth_limit; /**< maximum number of nested function calls */
+} jerry_quotas_t;
+
+/**
+ * A forward declaration of the weak reference structure.
+ */
+typedef struct jerry_weak_ref_t jerry_weak_ref_t;
+
+/**
+ * Callback which is called when the target object of a weak reference is freed.
+ */
+typedef void (*jerry_weak_ref_callback_t) (void *user_p);
+
 /**
  * General engine functions.
  */
@@ -304,9 +340,11 @@ void jerry_cleanup (void);
 void jerry_register_magic_strings (const jerry_char_ptr_t *ex_str_items_p, uint32_t count,
                                    const jerry_length_t *str_lengths_p);
 void jerry_gc (void);
+uint32_t jerry_run_deferred_finalizers (uint32_t count_limit, uint32_t time_limit_ms);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+size_t jerry_get_retained_size (const jerry_value_t *values_p, size_t values_count);
 
 /**
  * Parser and executor functions.
@@ -405,6 +443,13 @@ jerry_size_t jerry_substring_to_utf8_char_buffer (const jerry_value_t value,
                                                   jerry_length_t end_pos,
                                                   jerry_char_t *buffer_p,
                                                   jerry_size_t buffer_size);
+void jerry_string_cursor_init (jerry_string_cursor_t *cursor_p, const jerry_value_t value);
+jerry_size_t jerry_string_cursor_next (jerry_string_cursor_t *cursor_p,
+                                       jerry_char_t *buffer_p,
+                                       jerry_size_t buffer_size);
+jerry_size_t jerry_string_cursor_next_utf8 (jerry_string_cursor_t *cursor_p,
+                                            jerry_char_t *buffer_p,
+                                            jerry_size_t buffer_size);
 
 /**
  * Functions for array object values.
@@ -444,6 +489,7 @@ jerry_value_t jerry_create_number_infinity (bool sign);
 jerry_value_t jerry_create_number_nan (void);
 jerry_value_t jerry_create_null (void);
 jerry_value_t jerry_create_object (void);
+jerry_value_t jerry_create_native_object (void *native_pointer_p, const jerry_object_native_info_t *native_info_p);
 jerry_value_t jerry_create_promise (void);
 jerry_value_t jerry_create_string_from_utf8 (const jerry_char_t *str_p);
 jerry_value_t jerry_create_string_sz_from_utf8 (const jerry_char_t *str_p, jerry_size_t str_size);
@@ -502,6 +548,12 @@ bool jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *nat
 void jerry_set_object_native_pointer (const jerry_value_t obj_val,
                                       void *native_pointer_p,
                                       const jerry_object_native_info_t *native_info_p);
+void jerry_register_object_native_info (const jerry_object_native_info_t *native_info_p);
+
+jerry_weak_ref_t *jerry_create_weak_ref (const jerry_value_t obj_val, jerry_weak_ref_callback_t callback_p,
+                                         void *user_p);
+jerry_value_t jerry_get_weak_ref_value (const jerry_weak_ref_t *weak_ref_p);
+void jerry_free_weak_ref (jerry_weak_ref_t *weak_ref_p);
 
 bool jerry_foreach_object_property (const jerry_value_t obj_val, jerry_object_property_foreach_t foreach_p,
                                     void *user_data_p);
@@ -526,6 +578,7 @@ jerry_instance_t *jerry_create_instance (uint32_t heap_size, jerry_instance_allo
  * Miscellaneous functions.
  */
 void jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, void *user_p, uint32_t frequency);
+void jerry_set_quotas (const jerry_quotas_t *quotas_p);
 jerry_value_t jerry_get_backtrace (uint32_t max_depth);
 
 /**
@@ -146,12 +146,102 @@ double jerry_port_get_current_time (void);
  *
  * Note:
  *      This port function is called by jerry-core when
- *      JERRY_ENABLE_EXTERNAL_CONTEXT is defined. Otherwise this function is not
- *      used.
+ *      JERRY_ENABLE_EXTERNAL_CONTEXT is defined and
+ *      JERRY_ENABLE_EXTERNAL_CONTEXT_TLS is not defined. Otherwise this
+ *      function is not used.
  *
  * @return the pointer to the jerry instance.
  */
-struct jerry_instance_t *jerry_port_get_current_instance (void);
+struct jerry_instance_t * JERRY_ATTR_PURE jerry_port_get_current_instance (void);
+
+#ifdef JERRY_ENABLE_EXTERNAL_CONTEXT_TLS
+/**
+ * Pointer to the current instance of the calling thread. Ports which enable
+ * JERRY_ENABLE_EXTERNAL_CONTEXT_TLS must define this variable instead of
+ * jerry_port_get_current_instance.
+ *
+ * Note:
+ *      jerry-core reads this variable directly, so accessing the current
+ *      instance does not need a function call.
+ */
+extern JERRY_ATTR_THREAD_LOCAL struct jerry_instance_t *jerry_port_current_instance_p;
+#endif /* JERRY_ENABLE_EXTERNAL_CONTEXT_TLS */
+
+/*
+ * ArrayBuffer Port API
+ */
+
+/**
+ * Allocate the data block of a large ArrayBuffer outside of the engine's heap.
+ *
+ * Note:
+ *      This port function is called by jerry-core when
+ *      JERRY_ARRAYBUFFER_PORT_ALLOCATOR is defined, for ArrayBuffers which
+ *      are at least CONFIG_ECMA_ARRAYBUFFER_PORT_ALLOC_THRESHOLD bytes long.
+ *      Otherwise this function is not used.
+ *
+ * @param size size of the requested block in bytes (never zero).
+ * @return pointer to the allocated block - if success,
+ *         NULL - otherwise (the data is allocated on the engine's heap instead)
+ */
+void *jerry_port_arraybuffer_alloc (size_t size);
+
+/**
+ * Free a data block allocated by jerry_port_arraybuffer_alloc.
+ *
+ * Note:
+ *      This port function is called by jerry-core when the ArrayBuffer which
+ *      owns the block is garbage collected.
+ *
+ * @param buffer_p pointer returned by jerry_port_arraybuffer_alloc.
+ * @param size size of the block, the same value passed to jerry_port_arraybuffer_alloc.
+ */
+void jerry_port_arraybuffer_free (void *buffer_p, size_t size);
+
+/*
+ * JIT Port API
+ */
+
+/**
+ * Allocate a writable memory block for the native code of a function.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JERRY_JIT is defined.
+ *      Otherwise this function is not used. The block must be page aligned,
+ *      and it must not be executable until jerry_port_jit_protect is called.
+ *
+ * @param size size of the requested block in bytes (never zero).
+ * @return pointer to the allocated block - if success,
+ *         NULL - otherwise (the function is not compiled)
+ */
+void *jerry_port_jit_alloc (size_t size);
+
+/**
+ * Make a block allocated by jerry_port_jit_alloc executable and read-only.
+ *
+ * Note:
+ *      This port function is called by jerry-core after the native code is
+ *      written into the block. The block is never written after this call,
+ *      so the memory is never writable and executable at the same time.
+ *
+ * @param code_p pointer returned by jerry_port_jit_alloc.
+ * @param size size of the block, the same value passed to jerry_port_jit_alloc.
+ * @return true - if the block is executable,
+ *         false - otherwise (the block is freed and the function is not compiled)
+ */
+bool jerry_port_jit_protect (void *code_p, size_t size);
+
+/**
+ * Free a block allocated by jerry_port_jit_alloc.
+ *
+ * Note:
+ *      This port function is called by jerry-core when the byte code of the
+ *      compiled function is freed.
+ *
+ * @param code_p pointer returned by jerry_port_jit_alloc.
+ * @param size size of the block, the same value passed to jerry_port_jit_alloc.
+ */
+void jerry_port_jit_free (void *code_p, size_t size);
 
 /**
  * Makes the process sleep for a given time.
@@ -56,6 +56,8 @@ jerry_value_t jerry_generate_function_snapshot (const jerry_char_t *resource_nam
                                                 const jerry_char_t *args_p, size_t args_size,
                                                 uint32_t generate_snapshot_opts, uint32_t *buffer_p,
                                                 size_t buffer_size);
+jerry_error_t jerry_compile_snapshot (const jerry_char_t *source_p, size_t source_size, uint32_t generate_snapshot_opts,
+                                      uint32_t *buffer_p, size_t buffer_size, size_t *snapshot_size_p);
 
 jerry_value_t jerry_exec_snapshot (const uint32_t *snapshot_p, size_t snapshot_size,
                                    size_t func_index, uint32_t exec_snapshot_opts);
@@ -65,6 +67,10 @@ jerry_value_t jerry_load_function_snapshot (const uint32_t *function_snapshot_p,
 
 size_t jerry_merge_snapshots (const uint32_t **inp_buffers_p, size_t *inp_buffer_sizes_p, size_t number_of_snapshots,
                               uint32_t *out_buffer_p, size_t out_buffer_size, const char **error_p);
+size_t jerry_optimize_snapshots (const uint32_t **inp_buffers_p, size_t *inp_buffer_sizes_p, size_t number_of_snapshots,
+                                 const uint32_t *entry_funcs_p, size_t number_of_entry_funcs,
+                                 const uint32_t *profile_p, size_t profile_size,
+                                 uint32_t *out_buffer_p, size_t out_buffer_size, const char **error_p);
 size_t jerry_parse_and_save_literals (const jerry_char_t *source_p, size_t source_size, bool is_strict,
                                       uint32_t *buffer_p, size_t buffer_size, bool is_c_format);
 /**
@@ -68,6 +68,8 @@ typedef struct
 #ifdef JERRY_CPOINTER_32_BIT
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
 #endif /* JERRY_CPOINTER_32_BIT */
+  jmem_pools_chunk_t *ecma_recycled_property_pairs_p; /**< list of freed property pairs kept for reuse */
+  jmem_pools_chunk_t *ecma_recycled_extended_objects_p; /**< list of freed extended objects kept for reuse */
   jmem_free_unused_memory_callback_t jmem_free_unused_memory_callback; /**< Callback for freeing up memory. */
   const lit_utf8_byte_t **lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
@@ -76,16 +78,29 @@ typedef struct
   ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment */
   vm_frame_ctx_t *vm_top_context_p; /**< top (current) interpreter context */
   jerry_context_data_header_t *context_data_p; /**< linked list of user-provided context-specific pointers */
+  ecma_native_info_registry_t *native_info_registry_p; /**< list of registered native type infos */
+  ecma_weak_ref_t *weak_refs_p; /**< list of weak references */
+  ecma_ref_overflow_t *ref_overflow_p; /**< reference overflow table */
+  ecma_finalizer_block_t *finalizer_first_block_p; /**< first block of the deferred finalizer queue */
+  ecma_finalizer_block_t *finalizer_last_block_p; /**< last block of the deferred finalizer queue */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
   ecma_value_t error_value; /**< currently thrown error value */
+  uint32_t ecma_recycled_property_pairs_count; /**< number of property pairs kept for reuse */
+  uint32_t ecma_recycled_extended_objects_count; /**< number of extended objects kept for reuse */
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
+  uint32_t finalizer_count; /**< number of pending deferred finalizers */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
   uint32_t status_flags; /**< run-time flags */
 
+#ifndef CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE
+  ecma_construct_cache_entry_t ecma_construct_cache[ECMA_CONSTRUCT_CACHE_SIZE]; /**< prototypes and instance sizes
+                                                                                  *   of recently used constructors */
+#endif /* !CONFIG_ECMA_CONSTRUCT_CACHE_DISABLE */
+
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
@@ -100,6 +115,12 @@ typedef struct
   ecma_job_queueitem_t *job_queue_tail_p; /**< points to the tail item of the jobqueue*/
 #endif /* CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
 
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+  size_t arraybuffer_port_allocated_size; /**< size of ArrayBuffer data allocated by the port */
+  size_t arraybuffer_port_limit; /**< current limit of port allocated ArrayBuffer data, that is upon
+                                  *   being reached, causes a garbage collection */
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
 #ifdef JERRY_VM_EXEC_STOP
   uint32_t vm_exec_stop_frequency; /**< reset value for vm_exec_stop_counter */
   uint32_t vm_exec_stop_counter; /**< down counter for reducing the calls of vm_exec_stop_cb */
@@ -108,6 +129,22 @@ typedef struct
                                                  *   ECMAScript execution should be stopped */
 #endif /* JERRY_VM_EXEC_STOP */
 
+#ifdef JERRY_QUOTAS
+  size_t quota_heap_limit; /**< maximum heap usage */
+  uint32_t quota_branch_limit; /**< maximum number of backward jumps and calls (0 - no limit) */
+  uint32_t quota_branch_counter; /**< down counter of the remaining backward jumps and calls plus one */
+  uint32_t quota_branch_deferred; /**< remaining backward jumps and calls which are moved out of
+                                   *   quota_branch_counter to make the next quota check slow */
+  uint32_t quota_call_depth_limit; /**< maximum number of nested calls */
+  uint32_t vm_call_depth; /**< current number of nested calls */
+#endif /* JERRY_QUOTAS */
+
+#ifdef JERRY_JIT
+  vm_jit_function_t *vm_jit_functions[VM_JIT_HASH_SIZE]; /**< hash table of the compiled functions */
+  uint32_t vm_jit_counters[VM_JIT_COUNTER_SIZE]; /**< call and backward branch counters of the functions
+                                                  *   which are not compiled yet */
+#endif /* JERRY_JIT */
+
 #ifdef JERRY_DEBUGGER
   uint8_t debugger_send_buffer[JERRY_DEBUGGER_MAX_BUFFER_SIZE]; /**< buffer for sending messages */
   uint8_t debugger_receive_buffer[JERRY_DEBUGGER_MAX_BUFFER_SIZE]; /**< buffer for receiving messages */
@@ -152,11 +189,22 @@ typedef struct
 
 #ifndef JERRY_GET_CURRENT_INSTANCE
 
+#ifdef JERRY_ENABLE_EXTERNAL_CONTEXT_TLS
+
+/**
+ * Read the thread local instance pointer of the port if JERRY_GET_CURRENT_INSTANCE is not defined.
+ */
+#define JERRY_GET_CURRENT_INSTANCE() (jerry_port_current_instance_p)
+
+#else /* !JERRY_ENABLE_EXTERNAL_CONTEXT_TLS */
+
 /**
  * Default function if JERRY_GET_CURRENT_INSTANCE is not defined.
  */
 #define JERRY_GET_CURRENT_INSTANCE() (jerry_port_get_current_instance ())
 
+#endif /* JERRY_ENABLE_EXTERNAL_CONTEXT_TLS */
+
 #endif /* !JERRY_GET_CURRENT_INSTANCE */
 
 /**
@@ -277,4 +277,33 @@ jmem_stats_free_property_bytes (size_t property_size)
   heap_stats->property_bytes -= property_size;
 } /* jmem_stats_free_property_bytes */
 
+/**
+ * Register allocation outside of the heap.
+ */
+void
+jmem_stats_allocate_external_bytes (size_t external_size)
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->external_bytes += external_size;
+
+  if (heap_stats->external_bytes >= heap_stats->peak_external_bytes)
+  {
+    heap_stats->peak_external_bytes = heap_stats->external_bytes;
+  }
+} /* jmem_stats_allocate_external_bytes */
+
+/**
+ * Register free outside of the heap.
+ */
+void
+jmem_stats_free_external_bytes (size_t external_size)
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  JERRY_ASSERT (heap_stats->external_bytes >= external_size);
+
+  heap_stats->external_bytes -= external_size;
+} /* jmem_stats_free_external_bytes */
+
 #endif /* JMEM_STATS */
@@ -21,6 +21,7 @@
 #include "jmem.h"
 #include "jrt-bit-fields.h"
 #include "jrt-libc-includes.h"
+#include "jrt-tracepoints.h"
 
 #define JMEM_ALLOCATOR_INTERNAL
 #include "jmem-allocator-internal.h"
@@ -320,9 +321,15 @@ jmem_heap_alloc_block_internal (const size_t size) /**< size of requested block
     }
   }
 
-  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+  if (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
   {
-    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    do
+    {
+      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    }
+    while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit));
+
+    JERRY_TRACEPOINT2 (heap__limit, JERRY_CONTEXT (jmem_heap_limit), JERRY_CONTEXT (jmem_heap_allocated_size));
   }
 
   VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
@@ -336,6 +343,13 @@ jmem_heap_alloc_block_internal (const size_t size) /**< size of requested block
   VALGRIND_UNDEFINED_SPACE (data_space_p, size);
   JMEM_HEAP_STAT_ALLOC (size);
 
+#ifdef JERRY_QUOTAS
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (jmem_heap_allocated_size) > JERRY_CONTEXT (quota_heap_limit)))
+  {
+    jmem_heap_request_quota_check ();
+  }
+#endif /* JERRY_QUOTAS */
+
   return (void *) data_space_p;
 #else /* JERRY_SYSTEM_ALLOCATOR */
   JMEM_HEAP_STAT_ALLOC (size);
@@ -343,6 +357,28 @@ jmem_heap_alloc_block_internal (const size_t size) /**< size of requested block
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 } /* jmem_heap_alloc_block_internal */
 
+#ifdef JERRY_QUOTAS
+
+/**
+ * Make the next quota check of the VM take its slow path, which checks the heap quota.
+ *
+ * The remaining backward jumps and calls are moved to quota_branch_deferred,
+ * and the slow path moves them back to the counter.
+ */
+void JERRY_ATTR_NOINLINE
+jmem_heap_request_quota_check (void)
+{
+  uint32_t counter = JERRY_CONTEXT (quota_branch_counter);
+
+  if (counter > 1)
+  {
+    JERRY_CONTEXT (quota_branch_deferred) += counter - 1;
+    JERRY_CONTEXT (quota_branch_counter) = 1;
+  }
+} /* jmem_heap_request_quota_check */
+
+#endif /* JERRY_QUOTAS */
+
 /**
  * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
  *
@@ -440,6 +476,36 @@ jmem_heap_alloc_block_null_on_error (const size_t size) /**< required memory siz
   return jmem_heap_gc_and_alloc_block (size, true);
 } /* jmem_heap_alloc_block_null_on_error */
 
+/**
+ * Allocation of memory block without running the 'try to give memory back' callbacks.
+ *
+ * Note:
+ *      used by the garbage collector, which must not be re-entered
+ *
+ * @return NULL, if the required memory size is 0
+ *         also NULL, if there is not enough memory
+ *         pointer to the allocated memory block, otherwise
+ */
+void *
+jmem_heap_alloc_block_no_gc (const size_t size) /**< required memory size */
+{
+  if (JERRY_UNLIKELY (size == 0))
+  {
+    return NULL;
+  }
+
+  VALGRIND_FREYA_CHECK_MEMPOOL_REQUEST;
+
+  void *data_space_p = jmem_heap_alloc_block_internal (size);
+
+  if (JERRY_LIKELY (data_space_p != NULL))
+  {
+    VALGRIND_FREYA_MALLOCLIKE_SPACE (data_space_p, size);
+  }
+
+  return data_space_p;
+} /* jmem_heap_alloc_block_no_gc */
+
 /**
  * Free the memory block.
  */
@@ -537,9 +603,16 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) > 0);
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
-  while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_MEM_HEAP_DESIRED_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
+  if (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_MEM_HEAP_DESIRED_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
   {
-    JERRY_CONTEXT (jmem_heap_limit) -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    do
+    {
+      JERRY_CONTEXT (jmem_heap_limit) -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    }
+    while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_MEM_HEAP_DESIRED_LIMIT
+           <= JERRY_CONTEXT (jmem_heap_limit));
+
+    JERRY_TRACEPOINT2 (heap__limit, JERRY_CONTEXT (jmem_heap_limit), JERRY_CONTEXT (jmem_heap_allocated_size));
   }
 
   VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
@@ -611,7 +684,9 @@ jmem_heap_stats_print (void)
                    "  Allocated object data = %zu bytes\n"
                    "  Peak allocated object data = %zu bytes\n"
                    "  Allocated property data = %zu bytes\n"
-                   "  Peak allocated property data = %zu bytes\n",
+                   "  Peak allocated property data = %zu bytes\n"
+                   "  Allocated external data = %zu bytes\n"
+                   "  Peak allocated external data = %zu bytes\n",
                    heap_stats->size,
                    heap_stats->allocated_bytes,
                    heap_stats->peak_allocated_bytes,
@@ -624,7 +699,9 @@ jmem_heap_stats_print (void)
                    heap_stats->object_bytes,
                    heap_stats->peak_object_bytes,
                    heap_stats->property_bytes,
-                   heap_stats->peak_property_bytes);
+                   heap_stats->peak_property_bytes,
+                   heap_stats->external_bytes,
+                   heap_stats->peak_external_bytes);
 #ifndef JERRY_SYSTEM_ALLOCATOR
   JERRY_DEBUG_MSG ("  Skip-ahead ratio = %zu.%04zu\n"
                    "  Average alloc iteration = %zu.%04zu\n"
@@ -113,8 +113,13 @@ void jmem_finalize (void);
 
 void *jmem_heap_alloc_block (const size_t size);
 void *jmem_heap_alloc_block_null_on_error (const size_t size);
+void *jmem_heap_alloc_block_no_gc (const size_t size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
+#ifdef JERRY_QUOTAS
+void jmem_heap_request_quota_check (void);
+#endif /* JERRY_QUOTAS */
+
 #ifdef JMEM_STATS
 /**
  * Heap memory usage statistics
@@ -141,6 +146,9 @@ typedef struct
   size_t property_bytes; /**< allocated memory for properties */
   size_t peak_property_bytes; /**< peak allocated memory for properties */
 
+  size_t external_bytes; /**< memory allocated outside of the heap */
+  size_t peak_external_bytes; /**< peak memory allocated outside of the heap */
+
   size_t skip_count; /**< Number of skip-aheads during insertion of free block */
   size_t nonskip_count; /**< Number of times we could not skip ahead during
                          *   free block insertion */
@@ -160,6 +168,8 @@ void jmem_stats_allocate_object_bytes (size_t object_size);
 void jmem_stats_free_object_bytes (size_t string_size);
 void jmem_stats_allocate_property_bytes (size_t property_size);
 void jmem_stats_free_property_bytes (size_t property_size);
+void jmem_stats_allocate_external_bytes (size_t external_size);
+void jmem_stats_free_external_bytes (size_t external_size);
 
 void jmem_heap_get_stats (jmem_heap_stats_t *);
 #endif /* JMEM_STATS */
@@ -0,0 +1,118 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JRT_TRACEPOINTS_H
+#define JRT_TRACEPOINTS_H
+
+#include "jrt.h"
+
+/*
+ * Static tracepoints
+ *
+ * A tracepoint is a single nop instruction, which is described by a SystemTap
+ * SDT note in the .note.stapsdt section of the binary. The note contains the
+ * address of the nop and the location of the arguments, so tracers (perf,
+ * bpftrace, SystemTap, etc.) can replace the nop with a breakpoint when they
+ * attach to the tracepoint. All arguments are 64 bit unsigned integers.
+ *
+ * Tracepoints whose arguments are expensive to compute also have a semaphore,
+ * which is incremented by the tracers while they are attached.
+ */
+#ifdef JERRY_TRACEPOINTS
+
+#if !defined (__ELF__) || !(defined (__x86_64__) || defined (__aarch64__))
+#error "Static tracepoints are only supported on x86-64 and AArch64 ELF targets."
+#endif /* !__ELF__ || !(__x86_64__ || __aarch64__) */
+
+/**
+ * Emit a tracepoint and its SDT note. The %0 operand is the
+ * address of the semaphore (or zero), the rest are the arguments.
+ */
+#define JERRY_TRACEPOINT_ASM(name, semaphore, args_format, ...) \
+  __asm__ __volatile__ ("990: nop\n" \
+                        ".pushsection .note.stapsdt,\"?\",\"note\"\n" \
+                        ".balign 4\n" \
+                        ".4byte 992f-991f,994f-993f,3\n" \
+                        "991: .asciz \"stapsdt\"\n" \
+                        "992: .balign 4\n" \
+                        "993: .8byte 990b\n" \
+                        ".8byte _.stapsdt.base\n" \
+                        ".8byte %c0\n" \
+                        ".asciz \"jerry\"\n" \
+                        ".asciz \"" #name "\"\n" \
+                        ".asciz \"" args_format "\"\n" \
+                        "994: .balign 4\n" \
+                        ".popsection\n" \
+                        ".ifndef _.stapsdt.base\n" \
+                        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+                        ".weak _.stapsdt.base\n" \
+                        ".hidden _.stapsdt.base\n" \
+                        "_.stapsdt.base: .space 1\n" \
+                        ".size _.stapsdt.base, 1\n" \
+                        ".popsection\n" \
+                        ".endif\n" \
+                        : \
+                        : "i" (semaphore), __VA_ARGS__)
+
+/**
+ * Operand of a tracepoint argument.
+ */
+#define JERRY_TRACEPOINT_ARG(value) "nor" ((uint64_t) (value))
+
+/**
+ * Define the semaphore of a tracepoint in the current translation unit.
+ */
+#define JERRY_TRACEPOINT_SEMAPHORE(name) \
+  static volatile uint16_t jerry_tracepoint_ ## name ## _semaphore __attribute__ ((section (".probes"), used))
+
+/**
+ * Check whether a tracer is attached to a tracepoint which has a semaphore.
+ */
+#define JERRY_TRACEPOINT_ENABLED(name) JERRY_UNLIKELY (jerry_tracepoint_ ## name ## _semaphore != 0)
+
+/**
+ * Tracepoints without semaphore.
+ */
+#define JERRY_TRACEPOINT1(name, a1) \
+  JERRY_TRACEPOINT_ASM (name, 0, "8@%1", JERRY_TRACEPOINT_ARG (a1))
+#define JERRY_TRACEPOINT2(name, a1, a2) \
+  JERRY_TRACEPOINT_ASM (name, 0, "8@%1 8@%2", JERRY_TRACEPOINT_ARG (a1), JERRY_TRACEPOINT_ARG (a2))
+#define JERRY_TRACEPOINT3(name, a1, a2, a3) \
+  JERRY_TRACEPOINT_ASM (name, 0, "8@%1 8@%2 8@%3", \
+                        JERRY_TRACEPOINT_ARG (a1), JERRY_TRACEPOINT_ARG (a2), JERRY_TRACEPOINT_ARG (a3))
+
+/**
+ * Tracepoints with semaphore.
+ */
+#define JERRY_TRACEPOINT_SEMAPHORE3(name, a1, a2, a3) \
+  JERRY_TRACEPOINT_ASM (name, &jerry_tracepoint_ ## name ## _semaphore, "8@%1 8@%2 8@%3", \
+                        JERRY_TRACEPOINT_ARG (a1), JERRY_TRACEPOINT_ARG (a2), JERRY_TRACEPOINT_ARG (a3))
+#define JERRY_TRACEPOINT_SEMAPHORE4(name, a1, a2, a3, a4) \
+  JERRY_TRACEPOINT_ASM (name, &jerry_tracepoint_ ## name ## _semaphore, "8@%1 8@%2 8@%3 8@%4", \
+                        JERRY_TRACEPOINT_ARG (a1), JERRY_TRACEPOINT_ARG (a2), JERRY_TRACEPOINT_ARG (a3), \
+                        JERRY_TRACEPOINT_ARG (a4))
+
+#else /* !JERRY_TRACEPOINTS */
+
+#define JERRY_TRACEPOINT1(name, a1) \
+  do { JERRY_UNUSED (a1); } while (0)
+#define JERRY_TRACEPOINT2(name, a1, a2) \
+  do { JERRY_UNUSED (a1); JERRY_UNUSED (a2); } while (0)
+#define JERRY_TRACEPOINT3(name, a1, a2, a3) \
+  do { JERRY_UNUSED (a1); JERRY_UNUSED (a2); JERRY_UNUSED (a3); } while (0)
+
+#endif /* JERRY_TRACEPOINTS */
+
+#endif /* !JRT_TRACEPOINTS_H */
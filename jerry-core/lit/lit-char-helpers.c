@@ -21,85 +21,21 @@
 #include "lit-unicode-conversions.inc.h"
 #endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
 
-#define NUM_OF_ELEMENTS(array) (sizeof (array) / sizeof ((array)[0]))
-
 /**
- * Binary search algorithm that searches the a
- * character in the given char array.
+ * Get the unicode character class of a code unit.
  *
- * @return true - if the character is in the given array
- *         false - otherwise
+ * @return one of the LIT_UNICODE_CLASS_* values - if the code unit is in one of the classes
+ *         0 - otherwise
  */
-static bool
-search_char_in_char_array (ecma_char_t c,               /**< code unit */
-                           const ecma_char_t *array,    /**< array */
-                           int size_of_array)           /**< length of the array */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+lit_char_get_unicode_class (ecma_char_t c) /**< code unit */
 {
-  int bottom = 0;
-  int top = size_of_array - 1;
+  uint32_t index = lit_unicode_class_pages[c >> LIT_UNICODE_CLASS_BLOCK_BITS];
+  index = (index << LIT_UNICODE_CLASS_BLOCK_BITS) | (c & ((1u << LIT_UNICODE_CLASS_BLOCK_BITS) - 1));
 
-  while (bottom <= top)
-  {
-    int middle = (bottom + top) / 2;
-    ecma_char_t current = array[middle];
-
-    if (current == c)
-    {
-      return true;
-    }
-
-    if (c < current)
-    {
-      top = middle - 1;
-    }
-    else
-    {
-      bottom = middle + 1;
-    }
-  }
-
-  return false;
-} /* search_char_in_char_array */
-
-/**
- * Binary search algorithm that searches a character in the given intervals.
- * Intervals specifed by two arrays. The first one contains the starting points
- * of the intervals, the second one contains the length of them.
- *
- * @return true - if the the character is included (inclusively) in one of the intervals in the given array
- *         false - otherwise
- */
-static bool
-search_char_in_interval_array (ecma_char_t c,               /**< code unit */
-                               const ecma_char_t *array_sp, /**< array of interval starting points */
-                               const uint8_t *lengths,      /**< array of interval lengths */
-                               int size_of_array)           /**< length of the array */
-{
-  int bottom = 0;
-  int top = size_of_array - 1;
-
-  while (bottom <= top)
-  {
-    int middle = (bottom + top) / 2;
-    ecma_char_t current_sp = array_sp[middle];
-
-    if (current_sp <= c && c <= current_sp + lengths[middle])
-    {
-      return true;
-    }
-
-    if (c > current_sp)
-    {
-      bottom = middle + 1;
-    }
-    else
-    {
-      top = middle - 1;
-    }
-  }
-
-  return false;
-} /* search_char_in_interval_array */
+  /* Each byte contains the classes of four code units. */
+  return (uint32_t) (lit_unicode_class_blocks[index >> 2] >> ((index & 0x3) << 1)) & 0x3;
+} /* lit_char_get_unicode_class */
 
 /**
  * Check if specified character is one of the Format-Control characters
@@ -136,11 +72,7 @@ lit_char_is_white_space (ecma_char_t c) /**< code unit */
   {
     return (c == LIT_CHAR_NBSP
             || c == LIT_CHAR_BOM
-            || (c >= lit_unicode_separator_char_interval_sps[0]
-                && c <= lit_unicode_separator_char_interval_sps[0] + lit_unicode_separator_char_interval_lengths[0])
-            || search_char_in_char_array (c,
-                                          lit_unicode_separator_chars,
-                                          NUM_OF_ELEMENTS (lit_unicode_separator_chars)));
+            || lit_char_get_unicode_class (c) == LIT_UNICODE_CLASS_SEPARATOR);
   }
 } /* lit_char_is_white_space */
 
@@ -180,39 +112,9 @@ lit_char_is_line_terminator (ecma_char_t c) /**< code unit */
 static bool
 lit_char_is_unicode_letter (ecma_char_t c) /**< code unit */
 {
-  return (search_char_in_interval_array (c,
-                                         lit_unicode_letter_interval_sps,
-                                         lit_unicode_letter_interval_lengths,
-                                         NUM_OF_ELEMENTS (lit_unicode_letter_interval_sps))
-          || search_char_in_char_array (c, lit_unicode_letter_chars, NUM_OF_ELEMENTS (lit_unicode_letter_chars)));
+  return lit_char_get_unicode_class (c) == LIT_UNICODE_CLASS_LETTER;
 } /* lit_char_is_unicode_letter */
 
-/**
- * Check if specified character is a non-letter character and can be used as a
- * non-first character of an identifier.
- * These characters coverd by the following unicode categories:
- *  - digit (Nd)
- *  - punctuation mark (Mn, Mc)
- *  - connector punctuation (Pc)
- *
- * See also:
- *          ECMA-262 v5, 7.6
- *
- * @return true - if specified character falls into one of the listed categories,
- *         false - otherwise
- */
-static bool
-lit_char_is_unicode_non_letter_ident_part (ecma_char_t c) /**< code unit */
-{
-  return (search_char_in_interval_array (c,
-                                         lit_unicode_non_letter_ident_part_interval_sps,
-                                         lit_unicode_non_letter_ident_part_interval_lengths,
-                                         NUM_OF_ELEMENTS (lit_unicode_non_letter_ident_part_interval_sps))
-          || search_char_in_char_array (c,
-                                        lit_unicode_non_letter_ident_part_chars,
-                                        NUM_OF_ELEMENTS (lit_unicode_non_letter_ident_part_chars)));
-} /* lit_char_is_unicode_non_letter_ident_part */
-
 /**
  * Checks whether the next UTF8 character is a valid identifier start.
  *
@@ -299,8 +201,10 @@ lit_char_is_identifier_part_character (uint16_t chr) /**< EcmaScript character *
             || chr == LIT_CHAR_UNDERSCORE);
   }
 
-  return (lit_char_is_unicode_letter (chr)
-          || lit_char_is_unicode_non_letter_ident_part (chr));
+  uint32_t unicode_class = lit_char_get_unicode_class (chr);
+
+  return (unicode_class == LIT_UNICODE_CLASS_LETTER
+          || unicode_class == LIT_UNICODE_CLASS_NON_LETTER_IDENT_PART);
 } /* lit_char_is_identifier_part_character */
 
 /**
@@ -485,179 +389,41 @@ lit_char_is_word_char (ecma_char_t c) /**< code unit */
 #ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
 
 /**
- * Check if the specified character is in one of those tables which contain bidirectional conversions.
+ * Get the lowercase or uppercase character sequence of a code unit.
  *
- * @return the mapped character sequence of an ecma character, if it's in the table.
- *         0 - otherwise.
+ * @return the length of the character sequence
  */
 static ecma_length_t
-search_in_bidirectional_conversion_tables (ecma_char_t character,        /**< code unit */
-                                           ecma_char_t *output_buffer_p, /**< [out] buffer for the result characters */
-                                           bool is_lowercase)            /**< is lowercase conversion */
+lit_char_get_other_case (ecma_char_t character, /**< code unit */
+                         ecma_char_t *output_buffer_p, /**< [out] buffer for the result characters */
+                         const uint16_t *distances_p, /**< distances of the first characters */
+                         uint32_t sequence_offset) /**< offset of the remaining characters in a sequence */
 {
-  /* 1, Check if the specified character is part of the lit_character_case_ranges table. */
-  int number_of_case_ranges = NUM_OF_ELEMENTS (lit_character_case_ranges);
-  int conv_counter = 0;
-
-  for (int i = 0; i < number_of_case_ranges; i++)
-  {
-    if (i % 2 == 0 && i > 0)
-    {
-      conv_counter++;
-    }
-
-    int range_length = lit_character_case_range_lengths[conv_counter];
-    ecma_char_t start_point = lit_character_case_ranges[i];
-
-    if (start_point > character || character >= start_point + range_length)
-    {
-      continue;
-    }
-
-    int char_dist = character - start_point;
-
-    if (i % 2 == 0)
-    {
-      output_buffer_p[0] = is_lowercase ? (ecma_char_t) (lit_character_case_ranges[i + 1] + char_dist) : character;
-    }
-    else
-    {
-      output_buffer_p[0] = is_lowercase ? character : (ecma_char_t) (lit_character_case_ranges[i - 1] + char_dist);
-    }
-
-    return 1;
-  }
-
-  /* 2, Check if the specified character is part of the character_pair_ranges table. */
-  int bottom = 0;
-  int top = NUM_OF_ELEMENTS (lit_character_pair_ranges) - 1;
-
-  while (bottom <= top)
-  {
-    int middle = (bottom + top) / 2;
-    ecma_char_t current_sp = lit_character_pair_ranges[middle];
+  uint32_t index = lit_unicode_case_pages[character >> LIT_UNICODE_CASE_BLOCK_BITS];
+  index = (index << LIT_UNICODE_CASE_BLOCK_BITS) | (character & ((1u << LIT_UNICODE_CASE_BLOCK_BITS) - 1));
+  index = lit_unicode_case_blocks[index];
 
-    if (current_sp <= character && character < current_sp + lit_character_pair_range_lengths[middle])
-    {
-      int char_dist = character - current_sp;
-
-      if ((character - current_sp) % 2 == 0)
-      {
-        output_buffer_p[0] = is_lowercase ? (ecma_char_t) (current_sp + char_dist + 1) : character;
-      }
-      else
-      {
-        output_buffer_p[0] = is_lowercase ? character : (ecma_char_t) (current_sp + char_dist - 1);
-      }
-
-      return 1;
-    }
+  output_buffer_p[0] = (ecma_char_t) (character + distances_p[index]);
 
-    if (character > current_sp)
-    {
-      bottom = middle + 1;
-    }
-    else
-    {
-      top = middle - 1;
-    }
-  }
-
-  /* 3, Check if the specified character is part of the character_pairs table. */
-  int number_of_character_pairs = NUM_OF_ELEMENTS (lit_character_pairs);
-
-  for (int i = 0; i < number_of_character_pairs; i++)
+  if (JERRY_LIKELY (index < LIT_UNICODE_CASE_SEQUENCE_START))
   {
-    if (character != lit_character_pairs[i])
-    {
-      continue;
-    }
-
-    if (i % 2 == 0)
-    {
-      output_buffer_p[0] = is_lowercase ? lit_character_pairs[i + 1] : character;
-    }
-    else
-    {
-      output_buffer_p[0] = is_lowercase ? character : lit_character_pairs[i - 1];
-    }
-
     return 1;
   }
 
-  return 0;
-} /* search_in_bidirectional_conversion_tables */
+  /* Each sequence entry contains the remaining lowercase characters followed by the remaining uppercase characters. */
+  const uint16_t *sequence_p = lit_unicode_case_sequences + sequence_offset;
+  sequence_p += (index - LIT_UNICODE_CASE_SEQUENCE_START) * 2 * (LIT_MAXIMUM_OTHER_CASE_LENGTH - 1);
 
-/**
- * Check if the specified character is in the given conversion table.
- *
- * @return the mapped character sequence of an ecma character, if it's in the table.
- *         0 - otherwise.
- */
-static ecma_length_t
-search_in_conversion_table (ecma_char_t character,        /**< code unit */
-                            ecma_char_t *output_buffer_p, /**< [out] buffer for the result characters */
-                            const ecma_char_t *array,     /**< array */
-                            const uint8_t *counters)      /**< case_values counter */
-{
-  int end_point = 0;
+  ecma_length_t length = 1;
 
-  for (int i = 0; i < 3; i++)
+  while (length < LIT_MAXIMUM_OTHER_CASE_LENGTH && sequence_p[length - 1] != 0)
   {
-    int start_point = end_point;
-    int size_of_case_value = i + 1;
-    end_point += counters[i] * (size_of_case_value + 1);
-
-    int bottom = start_point;
-    int top = end_point - size_of_case_value;
-
-    while (bottom <= top)
-    {
-      int middle = (bottom + top) / 2;
-
-      middle -= ((middle - bottom) % (size_of_case_value + 1));
-
-      ecma_char_t current = array[middle];
-
-      if (current == character)
-      {
-        ecma_length_t char_sequence = 1;
-
-        switch (size_of_case_value)
-        {
-          case 3:
-          {
-            output_buffer_p[2] = array[middle + 3];
-            char_sequence++;
-            /* FALLTHRU */
-          }
-          case 2:
-          {
-            output_buffer_p[1] = array[middle + 2];
-            char_sequence++;
-            /* FALLTHRU */
-          }
-          default:
-          {
-            output_buffer_p[0] = array[middle + 1];
-            return char_sequence;
-          }
-        }
-      }
-
-      if (character < current)
-      {
-        top = middle - (size_of_case_value + 1);
-      }
-      else
-      {
-        bottom = middle + (size_of_case_value + 1);
-      }
-    }
+    output_buffer_p[length] = sequence_p[length - 1];
+    length++;
   }
 
-  return 0;
-} /* search_in_conversion_table */
+  return length;
+} /* lit_char_get_other_case */
 #endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
 
 /**
@@ -682,42 +448,11 @@ lit_char_to_lower_case (ecma_char_t character, /**< input character value */
   }
 
 #ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
-
-  ecma_length_t lowercase_sequence = search_in_bidirectional_conversion_tables (character, output_buffer_p, true);
-
-  if (lowercase_sequence != 0)
-  {
-    return lowercase_sequence;
-  }
-
-  int num_of_lowercase_ranges = NUM_OF_ELEMENTS (lit_lower_case_ranges);
-
-  for (int i = 0, j = 0; i < num_of_lowercase_ranges; i += 2, j++)
-  {
-    int range_length = lit_lower_case_range_lengths[j] - 1;
-    ecma_char_t start_point = lit_lower_case_ranges[i];
-
-    if (start_point <= character && character <= start_point + range_length)
-    {
-      output_buffer_p[0] = (ecma_char_t) (lit_lower_case_ranges[i + 1] + (character - start_point));
-      return 1;
-    }
-  }
-
-  lowercase_sequence = search_in_conversion_table (character,
-                                                   output_buffer_p,
-                                                   lit_lower_case_conversions,
-                                                   lit_lower_case_conversion_counters);
-
-  if (lowercase_sequence != 0)
-  {
-    return lowercase_sequence;
-  }
-
-#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
-
+  return lit_char_get_other_case (character, output_buffer_p, lit_unicode_lower_case_distances, 0);
+#else /* CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
   output_buffer_p[0] = character;
   return 1;
+#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
 } /* lit_char_to_lower_case */
 
 /**
@@ -742,41 +477,12 @@ lit_char_to_upper_case (ecma_char_t character, /**< input character value */
   }
 
 #ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
-
-  ecma_length_t uppercase_sequence = search_in_bidirectional_conversion_tables (character, output_buffer_p, false);
-
-  if (uppercase_sequence != 0)
-  {
-    return uppercase_sequence;
-  }
-
-  int num_of_upper_case_special_ranges = NUM_OF_ELEMENTS (lit_upper_case_special_ranges);
-
-  for (int i = 0, j = 0; i < num_of_upper_case_special_ranges; i += 3, j++)
-  {
-    int range_length = lit_upper_case_special_range_lengths[j];
-    ecma_char_t start_point = lit_upper_case_special_ranges[i];
-
-    if (start_point <= character && character <= start_point + range_length)
-    {
-      output_buffer_p[0] = (ecma_char_t) (lit_upper_case_special_ranges[i + 1] + (character - start_point));
-      output_buffer_p[1] = (ecma_char_t) (lit_upper_case_special_ranges[i + 2]);
-      return 2;
-    }
-  }
-
-  uppercase_sequence = search_in_conversion_table (character,
-                                                   output_buffer_p,
-                                                   lit_upper_case_conversions,
-                                                   lit_upper_case_conversion_counters);
-
-  if (uppercase_sequence != 0)
-  {
-    return uppercase_sequence;
-  }
-
-#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
-
+  return lit_char_get_other_case (character,
+                                  output_buffer_p,
+                                  lit_unicode_upper_case_distances,
+                                  LIT_MAXIMUM_OTHER_CASE_LENGTH - 1);
+#else /* CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
   output_buffer_p[0] = character;
   return 1;
+#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
 } /* lit_char_to_upper_case */
@@ -100,9 +100,69 @@ lit_get_magic_string_size_block_start (lit_utf8_size_t size) /**< magic string s
   return lit_magic_string_size_block_starts[size];
 } /* lit_get_magic_string_size_block_start */
 
+/**
+ * Four consecutive byte values.
+ */
+#define LIT_CHAR_STRING_BYTES_4(byte) \
+  (byte), (byte) + 1, (byte) + 2, (byte) + 3
+
+/**
+ * Sixteen consecutive byte values.
+ */
+#define LIT_CHAR_STRING_BYTES_16(byte) \
+  LIT_CHAR_STRING_BYTES_4 (byte), LIT_CHAR_STRING_BYTES_4 ((byte) + 4), \
+  LIT_CHAR_STRING_BYTES_4 ((byte) + 8), LIT_CHAR_STRING_BYTES_4 ((byte) + 12)
+
+/**
+ * Sixty-four consecutive byte values.
+ */
+#define LIT_CHAR_STRING_BYTES_64(byte) \
+  LIT_CHAR_STRING_BYTES_16 (byte), LIT_CHAR_STRING_BYTES_16 ((byte) + 16), \
+  LIT_CHAR_STRING_BYTES_16 ((byte) + 32), LIT_CHAR_STRING_BYTES_16 ((byte) + 48)
+
+/**
+ * Four consecutive two byte sequences with the same leading byte.
+ */
+#define LIT_CHAR_STRING_PAIRS_4(lead, byte) \
+  (lead), (byte), (lead), (byte) + 1, (lead), (byte) + 2, (lead), (byte) + 3
+
+/**
+ * Sixteen consecutive two byte sequences with the same leading byte.
+ */
+#define LIT_CHAR_STRING_PAIRS_16(lead, byte) \
+  LIT_CHAR_STRING_PAIRS_4 (lead, byte), LIT_CHAR_STRING_PAIRS_4 (lead, (byte) + 4), \
+  LIT_CHAR_STRING_PAIRS_4 (lead, (byte) + 8), LIT_CHAR_STRING_PAIRS_4 (lead, (byte) + 12)
+
+/**
+ * Sixty-four consecutive two byte sequences with the same leading byte.
+ */
+#define LIT_CHAR_STRING_PAIRS_64(lead, byte) \
+  LIT_CHAR_STRING_PAIRS_16 (lead, byte), LIT_CHAR_STRING_PAIRS_16 (lead, (byte) + 16), \
+  LIT_CHAR_STRING_PAIRS_16 (lead, (byte) + 32), LIT_CHAR_STRING_PAIRS_16 (lead, (byte) + 48)
+
+/**
+ * Cesu-8 representation of the characters from U+0000 to U+00FF. Characters
+ * below U+0080 are stored as one byte, the others as two bytes.
+ */
+static const lit_utf8_byte_t lit_char_strings[] JERRY_CONST_DATA =
+{
+  LIT_CHAR_STRING_BYTES_64 (0x00), LIT_CHAR_STRING_BYTES_64 (0x40),
+  LIT_CHAR_STRING_PAIRS_64 (0xc2, 0x80), LIT_CHAR_STRING_PAIRS_64 (0xc3, 0x80)
+};
+
+JERRY_STATIC_ASSERT (sizeof (lit_char_strings) == (LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1) * 3,
+                     lit_char_strings_must_contain_all_characters_up_to_u00ff);
+
+JERRY_STATIC_ASSERT (LIT_MAGIC_STRING_EX_CHAR_MAX == 2 * LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1,
+                     lit_char_strings_must_contain_one_and_two_byte_characters);
+
 /**
  * Get specified magic string as zero-terminated string from external table
  *
+ * Note:
+ *   identifiers reserved for single character strings are also accepted,
+ *   these strings are not zero-terminated
+ *
  * @return pointer to zero-terminated magic string
  */
 const lit_utf8_byte_t *
@@ -113,7 +173,17 @@ lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic str
     return JERRY_CONTEXT (lit_magic_string_ex_array)[id];
   }
 
-  JERRY_UNREACHABLE ();
+  JERRY_ASSERT (id >= LIT_MAGIC_STRING_EX_CHAR_START
+                && id <= LIT_MAGIC_STRING_EX_CHAR_START + LIT_MAGIC_STRING_EX_CHAR_MAX);
+
+  uint32_t code_unit = id - LIT_MAGIC_STRING_EX_CHAR_START;
+
+  if (code_unit <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    return lit_char_strings + code_unit;
+  }
+
+  return lit_char_strings + (2 * code_unit - (LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1));
 } /* lit_get_magic_string_ex_utf8 */
 
 /**
@@ -124,6 +194,13 @@ lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic str
 lit_utf8_size_t
 lit_get_magic_string_ex_size (lit_magic_string_ex_id_t id) /**< external magic string id */
 {
+  if (JERRY_UNLIKELY (id >= LIT_MAGIC_STRING_EX_CHAR_START))
+  {
+    JERRY_ASSERT (id <= LIT_MAGIC_STRING_EX_CHAR_START + LIT_MAGIC_STRING_EX_CHAR_MAX);
+
+    return (id - LIT_MAGIC_STRING_EX_CHAR_START <= LIT_UTF8_1_BYTE_CODE_POINT_MAX) ? 1 : 2;
+  }
+
   return JERRY_CONTEXT (lit_magic_string_ex_sizes)[id];
 } /* lit_get_magic_string_ex_size */
 
@@ -137,7 +214,7 @@ lit_magic_strings_ex_set (const lit_utf8_byte_t **ex_str_items, /**< character a
                           const lit_utf8_size_t *ex_str_sizes)  /**< sizes of the strings */
 {
   JERRY_ASSERT (ex_str_items != NULL);
-  JERRY_ASSERT (count > 0);
+  JERRY_ASSERT (count > 0 && count <= LIT_MAGIC_STRING_EX_CHAR_START);
   JERRY_ASSERT (ex_str_sizes != NULL);
 
   JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_array) == NULL);
@@ -53,6 +53,19 @@ typedef enum
  */
 typedef uint32_t lit_magic_string_ex_id_t;
 
+/**
+ * External magic string identifiers starting from this value are reserved
+ * for single character strings: the character of the string is the
+ * difference of the identifier and LIT_MAGIC_STRING_EX_CHAR_START.
+ */
+#define LIT_MAGIC_STRING_EX_CHAR_START 0xff00u
+
+/**
+ * Maximum code unit of a single character string represented
+ * by a reserved external magic string identifier.
+ */
+#define LIT_MAGIC_STRING_EX_CHAR_MAX 0xffu
+
 uint32_t lit_get_magic_string_ex_count (void);
 
 const lit_utf8_byte_t *lit_get_magic_string_utf8 (lit_magic_string_id_t id);
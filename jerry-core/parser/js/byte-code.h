@@ -647,7 +647,8 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
-  uint16_t padding;                 /**< an unused value */
+  uint16_t size_high;               /**< upper 16 bits of the size of oversized functions
+                                     *   (see ecma_compiled_code_get_size) */
 } cbc_uint16_arguments_t;
 
 /**
@@ -1964,8 +1964,7 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
  * Construct a regular expression object.
  */
 void
-lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
-                               bool parse_only) /**< parse only */
+lexer_construct_regexp_object (parser_context_t *context_p) /**< context */
 {
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
   const uint8_t *source_p = context_p->source_p;
@@ -2107,11 +2106,6 @@ lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
   context_p->column = column;
   context_p->source_p = source_p;
 
-  if (parse_only)
-  {
-    return;
-  }
-
   if (context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
     parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
@@ -2167,7 +2161,6 @@ lexer_construct_regexp_object (parser_context_t *context_p, /**< context */
   context_p->lit_object.index = (uint16_t) (context_p->literal_count - 1);
   context_p->lit_object.type = LEXER_LITERAL_OBJECT_ANY;
 #else /* CONFIG_DISABLE_REGEXP_BUILTIN */
-  JERRY_UNUSED (parse_only);
   parser_raise_error (context_p, PARSER_ERR_UNSUPPORTED_REGEXP);
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 } /* lexer_construct_regexp_object */
@@ -2327,56 +2320,6 @@ lexer_expect_object_literal_id (parser_context_t *context_p, /**< context */
   parser_raise_error (context_p, PARSER_ERR_PROPERTY_IDENTIFIER_EXPECTED);
 } /* lexer_expect_object_literal_id */
 
-/**
- * Next token must be an identifier.
- */
-void
-lexer_scan_identifier (parser_context_t *context_p, /**< context */
-                       bool propety_name) /**< property name */
-{
-  lexer_skip_spaces (context_p);
-  context_p->token.line = context_p->line;
-  context_p->token.column = context_p->column;
-
-  if (context_p->source_p < context_p->source_end_p
-      && (lit_char_is_identifier_start (context_p->source_p) || context_p->source_p[0] == LIT_CHAR_BACKSLASH))
-  {
-    lexer_parse_identifier (context_p, false);
-
-    if (propety_name && context_p->token.lit_location.length == 3)
-    {
-      lexer_skip_spaces (context_p);
-
-      if (context_p->source_p < context_p->source_end_p
-          && context_p->source_p[0] != LIT_CHAR_COLON)
-      {
-        if (lexer_compare_identifier_to_current (context_p, &lexer_get_literal))
-        {
-          context_p->token.type = LEXER_PROPERTY_GETTER;
-        }
-        else if (lexer_compare_identifier_to_current (context_p, &lexer_set_literal))
-        {
-          context_p->token.type = LEXER_PROPERTY_SETTER;
-        }
-      }
-    }
-    return;
-  }
-
-  if (propety_name)
-  {
-    lexer_next_token (context_p);
-
-    if (context_p->token.type == LEXER_LITERAL
-        || context_p->token.type == LEXER_RIGHT_BRACE)
-    {
-      return;
-    }
-  }
-
-  parser_raise_error (context_p, PARSER_ERR_IDENTIFIER_EXPECTED);
-} /* lexer_scan_identifier */
-
 /**
  * Compares the given identifier to that which is the current token
  * in the parser context.
@@ -864,7 +864,7 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
     case LEXER_DIVIDE:
     case LEXER_ASSIGN_DIVIDE:
     {
-      lexer_construct_regexp_object (context_p, false);
+      lexer_construct_regexp_object (context_p);
 
       if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
       {
@@ -1580,6 +1580,26 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
   }
 } /* parser_process_binary_opcodes */
 
+/**
+ * Checks whether the current token is a binary operator of the expression.
+ *
+ * @return true - if the current token is a binary operator
+ *         false - otherwise
+ */
+static inline bool
+parser_is_binary_operator (parser_context_t *context_p, /**< context */
+                           int options, /**< option flags */
+                           size_t grouping_level) /**< grouping level */
+{
+  if (context_p->token.type == LEXER_KEYW_IN)
+  {
+    /* The first part of a for statement can contain the in operator only inside parentheses. */
+    return !(options & PARSE_EXPR_NO_IN) || grouping_level > 0;
+  }
+
+  return LEXER_IS_BINARY_OP_TOKEN (context_p->token.type);
+} /* parser_is_binary_operator */
+
 /**
  * Parse expression.
  */
@@ -1611,7 +1631,7 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
       /* The engine flush binary opcodes above this precedence. */
       uint8_t min_prec_treshold = CBC_MAXIMUM_BYTE_VALUE;
 
-      if (LEXER_IS_BINARY_OP_TOKEN (context_p->token.type))
+      if (parser_is_binary_operator (context_p, options, grouping_level))
       {
         min_prec_treshold = parser_binary_precedence_table[context_p->token.type - LEXER_FIRST_BINARY_OP];
         if (LEXER_IS_BINARY_LVALUE_TOKEN (context_p->token.type)
@@ -1682,7 +1702,8 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
 
         lexer_next_token (context_p);
 
-        parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
+        parser_parse_expression (context_p,
+                                 PARSE_EXPR_NO_COMMA | ((grouping_level == 0) ? (options & PARSE_EXPR_NO_IN) : 0));
         parser_set_branch_to_current_position (context_p, &uncond_branch);
 
         /* Last opcode rewrite is not allowed because
@@ -1714,7 +1735,7 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
         continue;
       }
     }
-    else if (LEXER_IS_BINARY_OP_TOKEN (context_p->token.type))
+    else if (parser_is_binary_operator (context_p, options, grouping_level))
     {
       parser_append_binary_token (context_p);
       lexer_next_token (context_p);
@@ -1731,6 +1752,13 @@ parser_parse_expression (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (context_p->stack_top_uint8 == LEXER_EXPRESSION_START);
   parser_stack_pop_uint8 (context_p);
 
+  if ((options & PARSE_EXPR_NO_IN) && context_p->token.type == LEXER_KEYW_IN)
+  {
+    /* The expression is the left-hand side of a for-in statement. */
+    parser_push_result (context_p);
+    return;
+  }
+
   if (options & PARSE_EXPR_STATEMENT)
   {
     if (!CBC_NO_RESULT_OPERATION (context_p->last_cbc_opcode))
@@ -80,6 +80,9 @@ typedef enum
   PARSE_EXPR_NO_COMMA = (1u << 2),            /**< do not parse comma operator */
   PARSE_EXPR_HAS_LITERAL = (1u << 3),         /**< a primary literal is provided by a
                                                *   CBC_PUSH_LITERAL instruction  */
+  PARSE_EXPR_NO_IN = (1u << 4),               /**< do not parse the in operator outside of parentheses,
+                                               *   the expression result is always pushed if the
+                                               *   expression ends with an in keyword */
 } parser_expression_flags_t;
 
 /* The maximum of PARSER_CBC_STREAM_PAGE_SIZE is 127. */
@@ -163,6 +166,15 @@ typedef struct
   uint32_t last_position;                     /**< position of the last allocated byte */
 } parser_mem_data_t;
 
+/**
+ * Position in a byte code stream.
+ */
+typedef struct
+{
+  parser_mem_page_t *page_p;                  /**< page of the position */
+  uint32_t offset;                            /**< offset inside the page */
+} parser_cbc_stream_position_t;
+
 /**
  * Parser memory list.
  */
@@ -296,6 +308,8 @@ typedef struct
   /* Memory storage members. */
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< current byte code size for branches */
+  parser_mem_data_t deferred_byte_code;       /**< byte code of loop conditions and case
+                                               *   expressions which is emitted later */
   parser_list_t literal_pool;                 /**< literal list */
   parser_mem_data_t stack;                    /**< storage space */
   parser_mem_page_t *free_page_p;             /**< space for fast allocation */
@@ -347,6 +361,16 @@ void parser_free_local (void *ptr, size_t size);
 void parser_cbc_stream_init (parser_mem_data_t *data_p);
 void parser_cbc_stream_free (parser_mem_data_t *data_p);
 void parser_cbc_stream_alloc_page (parser_context_t *context_p, parser_mem_data_t *data_p);
+void parser_cbc_stream_get_position (parser_context_t *context_p, parser_mem_data_t *data_p,
+                                     parser_cbc_stream_position_t *position_p);
+void parser_cbc_stream_write (parser_context_t *context_p, parser_mem_data_t *data_p,
+                              const uint8_t *bytes_p, uint32_t size);
+void parser_cbc_stream_copy (parser_context_t *context_p, parser_mem_data_t *data_p,
+                             parser_cbc_stream_position_t *position_p, uint32_t size);
+void parser_cbc_stream_move (parser_context_t *context_p, parser_mem_data_t *data_p, parser_mem_data_t *source_p,
+                             const parser_cbc_stream_position_t *position_p);
+void parser_cbc_stream_read (parser_cbc_stream_position_t *position_p, uint8_t *bytes_p, uint32_t size);
+void parser_cbc_stream_truncate (parser_mem_data_t *data_p, const parser_cbc_stream_position_t *position_p);
 
 /* Parser list. Ensures pointer alignment. */
 
@@ -400,6 +424,7 @@ parser_branch_node_t *parser_emit_cbc_forward_branch_item (parser_context_t *con
                                                            parser_branch_node_t *next_p);
 void parser_emit_cbc_backward_branch (parser_context_t *context_p, uint16_t opcode, uint32_t offset);
 void parser_set_branch_to_current_position (parser_context_t *context_p, parser_branch_t *branch_p);
+void parser_set_branch_to_offset (parser_branch_t *branch_p, uint32_t offset);
 void parser_set_breaks_to_current_position (parser_context_t *context_p, parser_branch_node_t *current_p);
 void parser_set_continues_to_current_position (parser_context_t *context_p, parser_branch_node_t *current_p);
 
@@ -431,7 +456,6 @@ lexer_token_type_t lexer_check_arrow (parser_context_t *context_p);
 #endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
 void lexer_parse_string (parser_context_t *context_p);
 void lexer_expect_identifier (parser_context_t *context_p, uint8_t literal_type);
-void lexer_scan_identifier (parser_context_t *context_p, bool propety_name);
 ecma_char_t lexer_hex_to_character (parser_context_t *context_p, const uint8_t *source_p, int length);
 void lexer_expect_object_literal_id (parser_context_t *context_p, bool must_be_identifier);
 void lexer_construct_literal_object (parser_context_t *context_p, lexer_lit_location_t *literal_p,
@@ -439,7 +463,7 @@ void lexer_construct_literal_object (parser_context_t *context_p, lexer_lit_loca
 bool lexer_construct_number_object (parser_context_t *context_p, bool is_expr, bool is_negative_number);
 void lexer_convert_push_number_to_push_literal (parser_context_t *context_p);
 uint16_t lexer_construct_function_object (parser_context_t *context_p, uint32_t extra_status_flags);
-void lexer_construct_regexp_object (parser_context_t *context_p, bool parse_only);
+void lexer_construct_regexp_object (parser_context_t *context_p);
 bool lexer_compare_identifier_to_current (parser_context_t *context_p, const lexer_lit_location_t *right);
 
 /**
@@ -453,15 +477,6 @@ bool lexer_compare_identifier_to_current (parser_context_t *context_p, const lex
 
 void parser_parse_expression (parser_context_t *context_p, int options);
 
-/**
- * @}
- *
- * \addtogroup jsparser_scanner Scanner
- * @{
- */
-
-void parser_scan_until (parser_context_t *context_p, lexer_range_t *range_p, lexer_token_type_t end_type);
-
 /**
  * @}
  *
@@ -59,9 +59,10 @@
 #endif /* !PARSER_MAXIMUM_NUMBER_OF_REGISTERS */
 
 /* Maximum code size.
- * Limit: 16777215. Recommended: 65535, 16777215. */
+ * Limit: 16777215. Recommended: 65535, 16777215.
+ * Functions larger than ECMA_COMPILED_CODE_COMPACT_SIZE_LIMIT use the wide byte code header. */
 #ifndef PARSER_MAXIMUM_CODE_SIZE
-#define PARSER_MAXIMUM_CODE_SIZE (65535 << (JMEM_ALIGNMENT_LOG))
+#define PARSER_MAXIMUM_CODE_SIZE 16777215
 #endif /* !PARSER_MAXIMUM_CODE_SIZE */
 
 /* Maximum number of values pushed onto the stack by a function.
@@ -168,6 +168,222 @@ parser_cbc_stream_alloc_page (parser_context_t *context_p, /**< context */
   data_p->last_p = page_p;
 } /* parser_cbc_stream_alloc_page */
 
+/**
+ * Get the current end position of a byte stream.
+ */
+void
+parser_cbc_stream_get_position (parser_context_t *context_p, /**< context */
+                                parser_mem_data_t *data_p, /**< memory manager */
+                                parser_cbc_stream_position_t *position_p) /**< [out] position */
+{
+  if (data_p->last_p == NULL)
+  {
+    parser_cbc_stream_alloc_page (context_p, data_p);
+  }
+
+  position_p->page_p = data_p->last_p;
+  position_p->offset = data_p->last_position;
+} /* parser_cbc_stream_get_position */
+
+/**
+ * Append bytes to the end of a byte stream.
+ */
+void
+parser_cbc_stream_write (parser_context_t *context_p, /**< context */
+                         parser_mem_data_t *data_p, /**< memory manager */
+                         const uint8_t *bytes_p, /**< source bytes */
+                         uint32_t size) /**< number of bytes */
+{
+  while (size > 0)
+  {
+    uint32_t length;
+
+    if (data_p->last_position >= PARSER_CBC_STREAM_PAGE_SIZE)
+    {
+      parser_cbc_stream_alloc_page (context_p, data_p);
+    }
+
+    length = PARSER_CBC_STREAM_PAGE_SIZE - data_p->last_position;
+    if (length > size)
+    {
+      length = size;
+    }
+
+    memcpy (data_p->last_p->bytes + data_p->last_position, bytes_p, length);
+    data_p->last_position += length;
+    bytes_p += length;
+    size -= length;
+  }
+} /* parser_cbc_stream_write */
+
+/**
+ * Append bytes read from a position of another byte stream to the end of a byte stream.
+ * The position is advanced by the number of copied bytes.
+ */
+void
+parser_cbc_stream_copy (parser_context_t *context_p, /**< context */
+                        parser_mem_data_t *data_p, /**< destination memory manager */
+                        parser_cbc_stream_position_t *position_p, /**< [in, out] source position */
+                        uint32_t size) /**< number of bytes */
+{
+  while (size > 0)
+  {
+    uint32_t length;
+
+    if (position_p->offset >= PARSER_CBC_STREAM_PAGE_SIZE)
+    {
+      position_p->page_p = position_p->page_p->next_p;
+      position_p->offset = 0;
+    }
+
+    length = PARSER_CBC_STREAM_PAGE_SIZE - position_p->offset;
+    if (length > size)
+    {
+      length = size;
+    }
+
+    parser_cbc_stream_write (context_p, data_p, position_p->page_p->bytes + position_p->offset, length);
+    position_p->offset += length;
+    size -= length;
+  }
+} /* parser_cbc_stream_copy */
+
+/**
+ * Move all bytes after a position of a byte stream to the end of another byte stream.
+ * Only the bytes on the page of the position are copied: the following pages are
+ * linked to the destination stream and their bytes are shifted in place, so at most
+ * one page is allocated and the heap is not fragmented by the move.
+ */
+void
+parser_cbc_stream_move (parser_context_t *context_p, /**< context */
+                        parser_mem_data_t *data_p, /**< destination memory manager */
+                        parser_mem_data_t *source_p, /**< source memory manager */
+                        const parser_cbc_stream_position_t *position_p) /**< source position */
+{
+  parser_mem_page_t *page_p = position_p->page_p;
+  parser_mem_page_t *last_p = source_p->last_p;
+  uint32_t last_position = source_p->last_position;
+
+  if (page_p == last_p)
+  {
+    parser_cbc_stream_write (context_p, data_p, page_p->bytes + position_p->offset, last_position - position_p->offset);
+    source_p->last_position = position_p->offset;
+    return;
+  }
+
+  /* Writing may throw an out-of-memory error, so the source is not changed before. */
+  parser_cbc_stream_write (context_p,
+                           data_p,
+                           page_p->bytes + position_p->offset,
+                           PARSER_CBC_STREAM_PAGE_SIZE - position_p->offset);
+
+  page_p = page_p->next_p;
+  position_p->page_p->next_p = NULL;
+  source_p->last_p = position_p->page_p;
+  source_p->last_position = position_p->offset;
+
+  if (data_p->last_p == NULL)
+  {
+    data_p->first_p = page_p;
+    data_p->last_p = last_p;
+    data_p->last_position = last_position;
+    return;
+  }
+
+  parser_cbc_stream_position_t destination;
+  uint32_t offset = 0;
+
+  destination.page_p = data_p->last_p;
+  destination.offset = data_p->last_position;
+  data_p->last_p->next_p = page_p;
+
+  while (page_p != last_p || offset < last_position)
+  {
+    uint32_t length;
+
+    if (destination.offset >= PARSER_CBC_STREAM_PAGE_SIZE)
+    {
+      destination.page_p = destination.page_p->next_p;
+      destination.offset = 0;
+    }
+
+    if (offset >= PARSER_CBC_STREAM_PAGE_SIZE)
+    {
+      page_p = page_p->next_p;
+      offset = 0;
+    }
+
+    length = ((page_p == last_p) ? last_position : PARSER_CBC_STREAM_PAGE_SIZE) - offset;
+
+    if (length > PARSER_CBC_STREAM_PAGE_SIZE - destination.offset)
+    {
+      length = PARSER_CBC_STREAM_PAGE_SIZE - destination.offset;
+    }
+
+    /* The destination never follows the source, since the bytes are shifted backward. */
+    memmove (destination.page_p->bytes + destination.offset, page_p->bytes + offset, length);
+    destination.offset += length;
+    offset += length;
+  }
+
+  /* The last page is freed if it becomes empty. */
+  parser_cbc_stream_truncate (data_p, &destination);
+} /* parser_cbc_stream_move */
+
+/**
+ * Read bytes from a position of a byte stream.
+ * The position is advanced by the number of read bytes.
+ */
+void
+parser_cbc_stream_read (parser_cbc_stream_position_t *position_p, /**< [in, out] source position */
+                        uint8_t *bytes_p, /**< [out] destination buffer */
+                        uint32_t size) /**< number of bytes */
+{
+  while (size > 0)
+  {
+    uint32_t length;
+
+    if (position_p->offset >= PARSER_CBC_STREAM_PAGE_SIZE)
+    {
+      position_p->page_p = position_p->page_p->next_p;
+      position_p->offset = 0;
+    }
+
+    length = PARSER_CBC_STREAM_PAGE_SIZE - position_p->offset;
+    if (length > size)
+    {
+      length = size;
+    }
+
+    memcpy (bytes_p, position_p->page_p->bytes + position_p->offset, length);
+    position_p->offset += length;
+    bytes_p += length;
+    size -= length;
+  }
+} /* parser_cbc_stream_read */
+
+/**
+ * Remove all bytes after a position from a byte stream.
+ */
+void
+parser_cbc_stream_truncate (parser_mem_data_t *data_p, /**< memory manager */
+                            const parser_cbc_stream_position_t *position_p) /**< new end position */
+{
+  parser_mem_page_t *page_p = position_p->page_p->next_p;
+
+  while (page_p != NULL)
+  {
+    parser_mem_page_t *next_p = page_p->next_p;
+
+    parser_free (page_p, sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE);
+    page_p = next_p;
+  }
+
+  position_p->page_p->next_p = NULL;
+  data_p->last_p = position_p->page_p;
+  data_p->last_position = position_p->offset;
+} /* parser_cbc_stream_truncate */
+
 /**********************************************************************/
 /* Parser list management functions                                   */
 /**********************************************************************/
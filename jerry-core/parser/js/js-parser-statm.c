@@ -39,6 +39,15 @@
 #define PARSER_USE_STRICT_LENGTH   10
 /** @} */
 
+/**
+ * Size of a forward branch byte code.
+ */
+#if PARSER_MAXIMUM_CODE_SIZE <= 65535
+#define PARSER_FORWARD_BRANCH_LENGTH 3
+#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+#define PARSER_FORWARD_BRANCH_LENGTH 4
+#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+
 /**
  * Parser statement types.
  *
@@ -100,13 +109,30 @@ typedef struct
   parser_branch_t branch;                 /**< branch to the end */
 } parser_if_else_statement_t;
 
+/**
+ * Case clause of a switch statement. It is stored in the deferred
+ * byte code stream followed by the byte code of the case expression.
+ */
+typedef struct
+{
+  uint32_t offset;                        /**< start byte code offset of the clause */
+  uint32_t size;                          /**< size of the case expression byte code */
+} parser_switch_case_t;
+
 /**
  * Switch statement.
  */
 typedef struct
 {
-  parser_branch_t default_branch;         /**< branch to the default case */
-  parser_branch_node_t *branch_list_p;    /**< branches of case statements */
+  parser_cbc_stream_position_t clauses;   /**< start of the clauses in the byte code */
+  uint32_t clauses_offset;                /**< start byte code offset of the clauses */
+  parser_cbc_stream_position_t cases;     /**< start of the case clauses in the deferred byte code */
+  uint32_t case_count;                    /**< number of case clauses */
+  uint32_t cases_size;                    /**< total size of the case expression byte codes */
+  uint32_t default_offset;                /**< start byte code offset of the default clause */
+#ifdef JERRY_ENABLE_LINE_INFO
+  uint32_t dispatch_line;                 /**< last line info emitted into the dispatcher */
+#endif /* JERRY_ENABLE_LINE_INFO */
 } parser_switch_statement_t;
 
 /**
@@ -123,8 +149,10 @@ typedef struct
 typedef struct
 {
   parser_branch_t branch;                 /**< branch to the end */
-  lexer_range_t condition_range;          /**< condition part */
+  parser_cbc_stream_position_t condition; /**< condition part in the deferred byte code */
+  uint32_t condition_size;                /**< size of the condition byte code */
   uint32_t start_offset;                  /**< start byte code offset */
+  uint8_t opcode;                         /**< backward branch opcode closing the loop */
 } parser_while_statement_t;
 
 /**
@@ -133,9 +161,12 @@ typedef struct
 typedef struct
 {
   parser_branch_t branch;                 /**< branch to the end */
-  lexer_range_t condition_range;          /**< condition part */
-  lexer_range_t expression_range;         /**< increase part */
+  parser_cbc_stream_position_t expression; /**< increase part in the deferred byte code
+                                            *   followed by the condition part */
+  uint32_t expression_size;               /**< size of the increase byte code */
+  uint32_t condition_size;                /**< size of the condition byte code */
   uint32_t start_offset;                  /**< start byte code offset */
+  uint8_t opcode;                         /**< backward branch opcode closing the loop */
 } parser_for_statement_t;
 
 /**
@@ -217,33 +248,6 @@ parser_statement_length (uint8_t type) /**< type of statement */
   return statement_lengths[type - PARSER_STATEMENT_BLOCK];
 } /* parser_statement_length */
 
-/**
- * Initialize a range from the current location.
- */
-static inline void
-parser_save_range (parser_context_t *context_p, /**< context */
-                   lexer_range_t *range_p, /**< destination range */
-                   const uint8_t *source_end_p) /**< source end */
-{
-  range_p->source_p = context_p->source_p;
-  range_p->source_end_p = source_end_p;
-  range_p->line = context_p->line;
-  range_p->column = context_p->column;
-} /* parser_save_range */
-
-/**
- * Set the current location on the stack.
- */
-static inline void
-parser_set_range (parser_context_t *context_p, /**< context */
-                  lexer_range_t *range_p) /**< destination range */
-{
-  context_p->source_p = range_p->source_p;
-  context_p->source_end_p = range_p->source_end_p;
-  context_p->line = range_p->line;
-  context_p->column = range_p->column;
-} /* parser_set_range */
-
 /**
  * Initialize stack iterator.
  */
@@ -307,75 +311,88 @@ parser_parse_enclosed_expr (parser_context_t *context_p) /**< context */
 } /* parser_parse_enclosed_expr */
 
 /**
- * Parse var statement.
+ * Parse a variable declaration of a var statement.
+ *
+ * @return literal index of the declared variable
  */
-static void
-parser_parse_var_statement (parser_context_t *context_p) /**< context */
+static uint16_t
+parser_parse_var_declaration (parser_context_t *context_p, /**< context */
+                              int options) /**< expression parsing options of the initialiser */
 {
-  JERRY_ASSERT (context_p->token.type == LEXER_KEYW_VAR);
+  uint16_t literal_index;
 
-  while (true)
-  {
-    lexer_expect_identifier (context_p, LEXER_IDENT_LITERAL);
-    JERRY_ASSERT (context_p->token.type == LEXER_LITERAL
-                  && context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
+  lexer_expect_identifier (context_p, LEXER_IDENT_LITERAL);
+  JERRY_ASSERT (context_p->token.type == LEXER_LITERAL
+                && context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
 
 #if defined (JERRY_DEBUGGER) || defined (JERRY_ENABLE_LINE_INFO)
-    parser_line_counter_t ident_line_counter = context_p->token.line;
+  parser_line_counter_t ident_line_counter = context_p->token.line;
 #endif /* JERRY_DEBUGGER || JERRY_ENABLE_LINE_INFO */
 
-    context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_VAR;
+  context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_VAR;
+  literal_index = context_p->lit_object.index;
 
-    parser_emit_cbc_literal_from_token (context_p, CBC_PUSH_LITERAL);
+  parser_emit_cbc_literal_from_token (context_p, CBC_PUSH_LITERAL);
 
-    lexer_next_token (context_p);
+  lexer_next_token (context_p);
 
-    if (context_p->token.type == LEXER_ASSIGN)
-    {
+  if (context_p->token.type == LEXER_ASSIGN)
+  {
 #ifdef JERRY_DEBUGGER
-      if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
-          && ident_line_counter != context_p->last_breakpoint_line)
-      {
-        JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL);
+    if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+        && ident_line_counter != context_p->last_breakpoint_line)
+    {
+      JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL);
 
-        cbc_argument_t last_cbc = context_p->last_cbc;
-        context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+      cbc_argument_t last_cbc = context_p->last_cbc;
+      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 
-        parser_emit_cbc (context_p, CBC_BREAKPOINT_DISABLED);
-        parser_flush_cbc (context_p);
+      parser_emit_cbc (context_p, CBC_BREAKPOINT_DISABLED);
+      parser_flush_cbc (context_p);
 
-        parser_append_breakpoint_info (context_p, JERRY_DEBUGGER_BREAKPOINT_LIST, ident_line_counter);
+      parser_append_breakpoint_info (context_p, JERRY_DEBUGGER_BREAKPOINT_LIST, ident_line_counter);
 
-        context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
-        context_p->last_cbc = last_cbc;
+      context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+      context_p->last_cbc = last_cbc;
 
-        context_p->last_breakpoint_line = ident_line_counter;
-      }
+      context_p->last_breakpoint_line = ident_line_counter;
+    }
 #endif /* JERRY_DEBUGGER */
 
 #ifdef JERRY_ENABLE_LINE_INFO
-      if (ident_line_counter != context_p->last_line_info_line)
-      {
-        parser_emit_line_info (context_p, ident_line_counter, false);
-      }
-#endif /* JERRY_ENABLE_LINE_INFO */
-
-      parser_parse_expression (context_p,
-                               PARSE_EXPR_STATEMENT | PARSE_EXPR_NO_COMMA | PARSE_EXPR_HAS_LITERAL);
-    }
-    else
+    if (ident_line_counter != context_p->last_line_info_line)
     {
-      JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL
-                    && context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL);
-      /* We don't need to assign anything to this variable. */
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+      parser_emit_line_info (context_p, ident_line_counter, false);
     }
+#endif /* JERRY_ENABLE_LINE_INFO */
 
-    if (context_p->token.type != LEXER_COMMA)
-    {
-      break;
-    }
+    parser_parse_expression (context_p,
+                             PARSE_EXPR_STATEMENT | PARSE_EXPR_NO_COMMA | PARSE_EXPR_HAS_LITERAL | options);
+  }
+  else
+  {
+    JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL
+                  && context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL);
+    /* We don't need to assign anything to this variable. */
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
   }
+
+  return literal_index;
+} /* parser_parse_var_declaration */
+
+/**
+ * Parse var statement.
+ */
+static void
+parser_parse_var_statement (parser_context_t *context_p) /**< context */
+{
+  JERRY_ASSERT (context_p->token.type == LEXER_KEYW_VAR);
+
+  do
+  {
+    parser_parse_var_declaration (context_p, PARSE_EXPR);
+  }
+  while (context_p->token.type == LEXER_COMMA);
 } /* parser_parse_var_statement */
 
 /**
@@ -673,6 +690,76 @@ parser_parse_do_while_statement_end (parser_context_t *context_p) /**< context *
   parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
 } /* parser_parse_do_while_statement_end */
 
+/**
+ * Move the byte code emitted after a position of the byte code
+ * stream to the end of the deferred byte code stream.
+ */
+static void
+parser_defer_byte_code (parser_context_t *context_p, /**< context */
+                        const parser_cbc_stream_position_t *start_p, /**< start position */
+                        uint32_t start_offset) /**< byte code size at the start position */
+{
+  parser_cbc_stream_position_t position = *start_p;
+
+  JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+  JERRY_ASSERT (context_p->byte_code_size >= start_offset);
+
+  parser_cbc_stream_copy (context_p,
+                          &context_p->deferred_byte_code,
+                          &position,
+                          context_p->byte_code_size - start_offset);
+  parser_cbc_stream_truncate (&context_p->byte_code, start_p);
+  context_p->byte_code_size = start_offset;
+} /* parser_defer_byte_code */
+
+/**
+ * Append byte code from the deferred byte code stream to the byte code stream.
+ */
+static void
+parser_emit_deferred_byte_code (parser_context_t *context_p, /**< context */
+                                parser_cbc_stream_position_t *position_p, /**< [in, out] position in
+                                                                           *   the deferred byte code */
+                                uint32_t size) /**< size of the byte code */
+{
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    parser_flush_cbc (context_p);
+  }
+
+  if (size > 0)
+  {
+    context_p->status_flags |= PARSER_NO_END_LABEL;
+    parser_cbc_stream_copy (context_p, &context_p->byte_code, position_p, size);
+    context_p->byte_code_size += size;
+  }
+} /* parser_emit_deferred_byte_code */
+
+/**
+ * Select the backward branch which closes a loop after its
+ * condition is parsed and flush the remaining byte code.
+ *
+ * @return backward branch opcode
+ */
+static cbc_opcode_t
+parser_parse_loop_condition_end (parser_context_t *context_p) /**< context */
+{
+  cbc_opcode_t opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
+
+  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
+  {
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+    opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
+  }
+  else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
+  {
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+    opcode = CBC_JUMP_BACKWARD;
+  }
+
+  parser_flush_cbc (context_p);
+  return opcode;
+} /* parser_parse_loop_condition_end */
+
 /**
  * Parse while statement (starting part).
  */
@@ -681,6 +768,8 @@ parser_parse_while_statement_start (parser_context_t *context_p) /**< context */
 {
   parser_while_statement_t while_statement;
   parser_loop_statement_t loop;
+  parser_cbc_stream_position_t condition_start;
+  uint16_t stack_depth = context_p->stack_depth;
 
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_WHILE);
   lexer_next_token (context_p);
@@ -695,8 +784,24 @@ parser_parse_while_statement_start (parser_context_t *context_p) /**< context */
   JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
   while_statement.start_offset = context_p->byte_code_size;
 
-  /* The conditional part is processed at the end. */
-  parser_scan_until (context_p, &while_statement.condition_range, LEXER_RIGHT_PAREN);
+  /* The condition is parsed here, but its byte code is
+   * emitted after the loop body by the ending part. */
+  parser_cbc_stream_get_position (context_p, &context_p->byte_code, &condition_start);
+  lexer_next_token (context_p);
+  parser_parse_expression (context_p, PARSE_EXPR);
+
+  if (context_p->token.type != LEXER_RIGHT_PAREN)
+  {
+    parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
+  }
+
+  while_statement.opcode = (uint8_t) parser_parse_loop_condition_end (context_p);
+  while_statement.condition_size = context_p->byte_code_size - while_statement.start_offset;
+
+  parser_cbc_stream_get_position (context_p, &context_p->deferred_byte_code, &while_statement.condition);
+  parser_defer_byte_code (context_p, &condition_start, while_statement.start_offset);
+  context_p->stack_depth = stack_depth;
+
   lexer_next_token (context_p);
 
   loop.branch_list_p = NULL;
@@ -715,9 +820,7 @@ parser_parse_while_statement_end (parser_context_t *context_p) /**< context */
 {
   parser_while_statement_t while_statement;
   parser_loop_statement_t loop;
-  lexer_token_t current_token;
-  lexer_range_t range;
-  cbc_opcode_t opcode;
+  parser_cbc_stream_position_t position;
 
   JERRY_ASSERT (context_p->stack_top_uint8 == PARSER_STATEMENT_WHILE);
 
@@ -729,51 +832,42 @@ parser_parse_while_statement_end (parser_context_t *context_p) /**< context */
   parser_stack_iterator_skip (&iterator, sizeof (parser_loop_statement_t));
   parser_stack_iterator_read (&iterator, &while_statement, sizeof (parser_while_statement_t));
 
-  parser_save_range (context_p, &range, context_p->source_end_p);
-  current_token = context_p->token;
-
   parser_set_branch_to_current_position (context_p, &while_statement.branch);
   parser_set_continues_to_current_position (context_p, loop.branch_list_p);
 
-  parser_set_range (context_p, &while_statement.condition_range);
-  lexer_next_token (context_p);
+  position = while_statement.condition;
+  parser_emit_deferred_byte_code (context_p, &position, while_statement.condition_size);
+  parser_cbc_stream_truncate (&context_p->deferred_byte_code, &while_statement.condition);
 
-  parser_parse_expression (context_p, PARSE_EXPR);
-  if (context_p->token.type != LEXER_EOS)
+  if (while_statement.opcode != CBC_JUMP_BACKWARD)
   {
-    parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
-  }
-
-  opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-  if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-  {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-  }
-  else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
-  {
-    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-    opcode = CBC_JUMP_BACKWARD;
+    /* The result of the condition is consumed by the branch. */
+    PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
   }
 
   parser_stack_pop (context_p, NULL, 1 + sizeof (parser_loop_statement_t) + sizeof (parser_while_statement_t));
   parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-  parser_emit_cbc_backward_branch (context_p, opcode, while_statement.start_offset);
+  parser_emit_cbc_backward_branch (context_p, while_statement.opcode, while_statement.start_offset);
   parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
-
-  parser_set_range (context_p, &range);
-  context_p->token = current_token;
 } /* parser_parse_while_statement_end */
 
 /**
  * Parse for statement (starting part).
+ *
+ * Note:
+ *      the first part of the header is parsed before it is known whether the
+ *      statement is a for-in statement, and the in operator is not parsed
+ *      there; the byte code of a for-in target is moved behind the object
+ *      expression, since the target is evaluated in each iteration
  */
 static void
 parser_parse_for_statement_start (parser_context_t *context_p) /**< context */
 {
   parser_loop_statement_t loop;
-  lexer_range_t start_range;
+  parser_cbc_stream_position_t start;
+  uint16_t literal_index = 0;
+  bool is_var = false;
 
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_FOR);
   lexer_next_token (context_p);
@@ -783,74 +877,50 @@ parser_parse_for_statement_start (parser_context_t *context_p) /**< context */
     parser_raise_error (context_p, PARSER_ERR_LEFT_PAREN_EXPECTED);
   }
 
-  parser_scan_until (context_p, &start_range, LEXER_KEYW_IN);
-
-  if (context_p->token.type == LEXER_KEYW_IN)
-  {
-    parser_for_in_statement_t for_in_statement;
-    lexer_range_t range;
-
-    lexer_next_token (context_p);
-    parser_parse_expression (context_p, PARSE_EXPR);
-
-    if (context_p->token.type != LEXER_RIGHT_PAREN)
-    {
-      parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
-    }
-
-#ifndef JERRY_NDEBUG
-    PARSER_PLUS_EQUAL_U16 (context_p->context_stack_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
-#endif /* !JERRY_NDEBUG */
-
-    parser_emit_cbc_ext_forward_branch (context_p,
-                                        CBC_EXT_FOR_IN_CREATE_CONTEXT,
-                                        &for_in_statement.branch);
-
-    JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
-    for_in_statement.start_offset = context_p->byte_code_size;
+  parser_flush_cbc (context_p);
 
-    parser_save_range (context_p, &range, context_p->source_end_p);
-    parser_set_range (context_p, &start_range);
-    lexer_next_token (context_p);
+  uint32_t start_offset = context_p->byte_code_size;
+  uint16_t stack_depth = context_p->stack_depth;
+  uint16_t stack_limit = context_p->stack_limit;
 
-    if (context_p->token.type == LEXER_KEYW_VAR)
-    {
-      uint16_t literal_index;
+  parser_cbc_stream_get_position (context_p, &context_p->byte_code, &start);
 
-      lexer_expect_identifier (context_p, LEXER_IDENT_LITERAL);
-      JERRY_ASSERT (context_p->token.type == LEXER_LITERAL
-                    && context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
+  /* The stack usage of the first part is measured, since a for-in
+   * target is evaluated after the for-in context is created. */
+  context_p->stack_limit = stack_depth;
 
-      context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_VAR;
+  lexer_next_token (context_p);
 
-      literal_index = context_p->lit_object.index;
+  if (context_p->token.type == LEXER_KEYW_VAR)
+  {
+    literal_index = parser_parse_var_declaration (context_p, PARSE_EXPR_NO_IN);
+    is_var = true;
+  }
+  else if (context_p->token.type != LEXER_SEMICOLON)
+  {
+    parser_parse_expression (context_p, PARSE_EXPR_STATEMENT | PARSE_EXPR_NO_IN);
+  }
 
-      lexer_next_token (context_p);
+  uint16_t target_stack_limit = (uint16_t) (context_p->stack_limit - stack_depth);
 
-      if (context_p->token.type == LEXER_ASSIGN)
-      {
-        parser_branch_t branch;
+  if (context_p->stack_limit < stack_limit)
+  {
+    context_p->stack_limit = stack_limit;
+  }
 
-        /* Initialiser is never executed. */
-        parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &branch);
-        lexer_next_token (context_p);
-        parser_parse_expression (context_p,
-                                 PARSE_EXPR_STATEMENT | PARSE_EXPR_NO_COMMA);
-        parser_set_branch_to_current_position (context_p, &branch);
-      }
+  if (context_p->token.type == LEXER_KEYW_IN)
+  {
+    parser_for_in_statement_t for_in_statement;
+    parser_cbc_stream_position_t target_position;
+    parser_cbc_stream_position_t position;
+    cbc_argument_t last_cbc;
+    uint16_t opcode = CBC_ASSIGN_SET_IDENT;
 
-      parser_emit_cbc_ext (context_p, CBC_EXT_FOR_IN_GET_NEXT);
-      parser_emit_cbc_literal (context_p, CBC_ASSIGN_SET_IDENT, literal_index);
-    }
-    else
+    if (!is_var)
     {
-      uint16_t opcode;
-
-      parser_parse_expression (context_p, PARSE_EXPR);
-
       opcode = context_p->last_cbc_opcode;
 
-      /* The CBC_EXT_FOR_IN_CREATE_CONTEXT flushed the opcode combiner. */
+      /* The opcode combiner was flushed before the target. */
       JERRY_ASSERT (opcode != CBC_PUSH_TWO_LITERALS
                     && opcode != CBC_PUSH_THREE_LITERALS);
 
@@ -887,19 +957,86 @@ parser_parse_for_statement_start (parser_context_t *context_p) /**< context */
         opcode = CBC_ASSIGN;
       }
 
-      parser_emit_cbc_ext (context_p, CBC_EXT_FOR_IN_GET_NEXT);
-      parser_flush_cbc (context_p);
+      last_cbc = context_p->last_cbc;
+    }
 
-      context_p->last_cbc_opcode = opcode;
+    parser_flush_cbc (context_p);
+
+    uint32_t target_size = context_p->byte_code_size - start_offset;
+    uint16_t target_stack_depth = (uint16_t) (context_p->stack_depth - stack_depth);
+
+    parser_cbc_stream_get_position (context_p, &context_p->deferred_byte_code, &target_position);
+    parser_defer_byte_code (context_p, &start, start_offset);
+    context_p->stack_depth = stack_depth;
+
+    lexer_next_token (context_p);
+    parser_parse_expression (context_p, PARSE_EXPR);
+
+    if (context_p->token.type != LEXER_RIGHT_PAREN)
+    {
+      parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
     }
 
-    if (context_p->token.type != LEXER_EOS)
+#ifndef JERRY_NDEBUG
+    PARSER_PLUS_EQUAL_U16 (context_p->context_stack_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
+#endif /* !JERRY_NDEBUG */
+
+    parser_emit_cbc_ext_forward_branch (context_p,
+                                        CBC_EXT_FOR_IN_CREATE_CONTEXT,
+                                        &for_in_statement.branch);
+
+    JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+    for_in_statement.start_offset = context_p->byte_code_size;
+
+    if (context_p->stack_depth + target_stack_limit > context_p->stack_limit)
     {
-      parser_raise_error (context_p, PARSER_ERR_IN_EXPECTED);
+      context_p->stack_limit = (uint16_t) (context_p->stack_depth + target_stack_limit);
+
+      if (context_p->stack_limit > PARSER_MAXIMUM_STACK_LIMIT)
+      {
+        parser_raise_error (context_p, PARSER_ERR_STACK_LIMIT_REACHED);
+      }
+    }
+
+    position = target_position;
+
+    if (is_var && target_size > 0)
+    {
+      parser_branch_t branch;
+
+      /* Initialiser is never executed. */
+      parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &branch);
+      parser_emit_deferred_byte_code (context_p, &position, target_size);
+      parser_set_branch_to_current_position (context_p, &branch);
+    }
+    else
+    {
+      parser_emit_deferred_byte_code (context_p, &position, target_size);
+    }
+
+    parser_cbc_stream_truncate (&context_p->deferred_byte_code, &target_position);
+
+    if (!is_var)
+    {
+      PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, target_stack_depth);
+    }
+
+    parser_emit_cbc_ext (context_p, CBC_EXT_FOR_IN_GET_NEXT);
+
+    if (is_var)
+    {
+      parser_emit_cbc_literal (context_p, CBC_ASSIGN_SET_IDENT, literal_index);
+    }
+    else
+    {
+      parser_flush_cbc (context_p);
+
+      context_p->last_cbc_opcode = opcode;
+      context_p->last_cbc = last_cbc;
     }
 
     parser_flush_cbc (context_p);
-    parser_set_range (context_p, &range);
+
     lexer_next_token (context_p);
 
     loop.branch_list_p = NULL;
@@ -912,36 +1049,78 @@ parser_parse_for_statement_start (parser_context_t *context_p) /**< context */
   else
   {
     parser_for_statement_t for_statement;
+    parser_cbc_stream_position_t condition_start;
+    parser_cbc_stream_position_t expression_start;
+    parser_cbc_stream_position_t position;
 
-    start_range.source_end_p = context_p->source_end_p;
-    parser_set_range (context_p, &start_range);
+    if (is_var)
+    {
+      while (context_p->token.type == LEXER_COMMA)
+      {
+        parser_parse_var_declaration (context_p, PARSE_EXPR_NO_IN);
+      }
+    }
+
+    if (context_p->token.type != LEXER_SEMICOLON)
+    {
+      parser_raise_error (context_p, PARSER_ERR_SEMICOLON_EXPECTED);
+    }
+
+    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &for_statement.branch);
+
+    JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
+    for_statement.start_offset = context_p->byte_code_size;
+
+    /* The conditional and expression parts are parsed here, but
+     * their byte code is emitted after the loop body by the ending part. */
+    parser_cbc_stream_get_position (context_p, &context_p->byte_code, &condition_start);
     lexer_next_token (context_p);
 
+    for_statement.opcode = CBC_JUMP_BACKWARD;
+
     if (context_p->token.type != LEXER_SEMICOLON)
     {
-      if (context_p->token.type == LEXER_KEYW_VAR)
-      {
-        parser_parse_var_statement (context_p);
-      }
-      else
-      {
-        parser_parse_expression (context_p, PARSE_EXPR_STATEMENT);
-      }
+      parser_parse_expression (context_p, PARSE_EXPR);
 
       if (context_p->token.type != LEXER_SEMICOLON)
       {
         parser_raise_error (context_p, PARSER_ERR_SEMICOLON_EXPECTED);
       }
+
+      for_statement.opcode = (uint8_t) parser_parse_loop_condition_end (context_p);
+      context_p->stack_depth = stack_depth;
     }
 
-    parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &for_statement.branch);
+    for_statement.condition_size = context_p->byte_code_size - for_statement.start_offset;
+    parser_cbc_stream_get_position (context_p, &context_p->byte_code, &expression_start);
+    lexer_next_token (context_p);
 
-    JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
-    for_statement.start_offset = context_p->byte_code_size;
+    if (context_p->token.type != LEXER_RIGHT_PAREN)
+    {
+      parser_parse_expression (context_p, PARSE_EXPR_STATEMENT);
+
+      if (context_p->token.type != LEXER_RIGHT_PAREN)
+      {
+        parser_raise_error (context_p, PARSER_ERR_RIGHT_PAREN_EXPECTED);
+      }
+
+      parser_flush_cbc (context_p);
+    }
+
+    for_statement.expression_size = (context_p->byte_code_size
+                                     - for_statement.start_offset
+                                     - for_statement.condition_size);
+
+    /* The increase part is executed first. */
+    parser_cbc_stream_get_position (context_p, &context_p->deferred_byte_code, &for_statement.expression);
+
+    position = expression_start;
+    parser_cbc_stream_copy (context_p, &context_p->deferred_byte_code, &position, for_statement.expression_size);
+    parser_cbc_stream_truncate (&context_p->byte_code, &expression_start);
+    context_p->byte_code_size = for_statement.start_offset + for_statement.condition_size;
+
+    parser_defer_byte_code (context_p, &condition_start, for_statement.start_offset);
 
-    /* The conditional and expression parts are processed at the end. */
-    parser_scan_until (context_p, &for_statement.condition_range, LEXER_SEMICOLON);
-    parser_scan_until (context_p, &for_statement.expression_range, LEXER_RIGHT_PAREN);
     lexer_next_token (context_p);
 
     loop.branch_list_p = NULL;
@@ -961,9 +1140,7 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
 {
   parser_for_statement_t for_statement;
   parser_loop_statement_t loop;
-  lexer_token_t current_token;
-  lexer_range_t range;
-  cbc_opcode_t opcode;
+  parser_cbc_stream_position_t position;
 
   JERRY_ASSERT (context_p->stack_top_uint8 == PARSER_STATEMENT_FOR);
 
@@ -975,79 +1152,42 @@ parser_parse_for_statement_end (parser_context_t *context_p) /**< context */
   parser_stack_iterator_skip (&iterator, sizeof (parser_loop_statement_t));
   parser_stack_iterator_read (&iterator, &for_statement, sizeof (parser_for_statement_t));
 
-  parser_save_range (context_p, &range, context_p->source_end_p);
-  current_token = context_p->token;
-
-  parser_set_range (context_p, &for_statement.expression_range);
-  lexer_next_token (context_p);
-
+  parser_flush_cbc (context_p);
   parser_set_continues_to_current_position (context_p, loop.branch_list_p);
 
-  if (context_p->token.type != LEXER_EOS)
-  {
-    parser_parse_expression (context_p, PARSE_EXPR_STATEMENT);
-
-    if (context_p->token.type != LEXER_EOS)
-    {
-      parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
-    }
-  }
+  position = for_statement.expression;
+  parser_emit_deferred_byte_code (context_p, &position, for_statement.expression_size);
 
   parser_set_branch_to_current_position (context_p, &for_statement.branch);
 
-  parser_set_range (context_p, &for_statement.condition_range);
-  lexer_next_token (context_p);
+  parser_emit_deferred_byte_code (context_p, &position, for_statement.condition_size);
+  parser_cbc_stream_truncate (&context_p->deferred_byte_code, &for_statement.expression);
 
-  if (context_p->token.type != LEXER_EOS)
+  if (for_statement.opcode != CBC_JUMP_BACKWARD)
   {
-    parser_parse_expression (context_p, PARSE_EXPR);
-
-    if (context_p->token.type != LEXER_EOS)
-    {
-      parser_raise_error (context_p, PARSER_ERR_INVALID_EXPRESSION);
-    }
-
-    opcode = CBC_BRANCH_IF_TRUE_BACKWARD;
-    if (context_p->last_cbc_opcode == CBC_LOGICAL_NOT)
-    {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_BRANCH_IF_FALSE_BACKWARD;
-    }
-    else if (context_p->last_cbc_opcode == CBC_PUSH_TRUE)
-    {
-      context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
-      opcode = CBC_JUMP_BACKWARD;
-    }
-  }
-  else
-  {
-    opcode = CBC_JUMP_BACKWARD;
+    /* The result of the condition is consumed by the branch. */
+    PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
   }
 
   parser_stack_pop (context_p, NULL, 1 + sizeof (parser_loop_statement_t) + sizeof (parser_for_statement_t));
   parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-  parser_emit_cbc_backward_branch (context_p, opcode, for_statement.start_offset);
+  parser_emit_cbc_backward_branch (context_p, for_statement.opcode, for_statement.start_offset);
   parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
-
-  parser_set_range (context_p, &range);
-  context_p->token = current_token;
 } /* parser_parse_for_statement_end */
 
 /**
  * Parse switch statement (starting part).
+ *
+ * The switch body is processed in a single pass: the byte code of the
+ * case expressions is deferred and parser_parse_switch_statement_end
+ * emits a dispatcher from it in front of the clauses.
  */
 static void JERRY_ATTR_NOINLINE
 parser_parse_switch_statement_start (parser_context_t *context_p) /**< context */
 {
   parser_switch_statement_t switch_statement;
   parser_loop_statement_t loop;
-  parser_stack_iterator_t iterator;
-  lexer_range_t switch_body_start;
-  lexer_range_t unused_range;
-  bool switch_case_was_found;
-  bool default_case_was_found;
-  parser_branch_node_t *cases_p = NULL;
 
   JERRY_ASSERT (context_p->token.type == LEXER_KEYW_SWITCH);
 
@@ -1058,7 +1198,6 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
     parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
   }
 
-  parser_save_range (context_p, &switch_body_start, context_p->source_end_p);
   lexer_next_token (context_p);
 
   if (context_p->token.type == LEXER_RIGHT_BRACE)
@@ -1077,126 +1216,276 @@ parser_parse_switch_statement_start (parser_context_t *context_p) /**< context *
     parser_raise_error (context_p, PARSER_ERR_INVALID_SWITCH);
   }
 
-  /* The reason of using an iterator is error management. If an error
-   * occures, parser_free_jumps() free all data. However, the branches
-   * created by parser_emit_cbc_forward_branch_item() would not be freed.
-   * To free these branches, the current switch data is always stored
-   * on the stack. If any change happens, this data is updated. Updates
-   * are done using the iterator. */
+  parser_flush_cbc (context_p);
+
+  /* The switch value is consumed by the dispatcher. */
+  PARSER_MINUS_EQUAL_U16 (context_p->stack_depth, 1);
 
-  switch_statement.branch_list_p = NULL;
+  parser_cbc_stream_get_position (context_p, &context_p->byte_code, &switch_statement.clauses);
+  switch_statement.clauses_offset = context_p->byte_code_size;
+  parser_cbc_stream_get_position (context_p, &context_p->deferred_byte_code, &switch_statement.cases);
+  switch_statement.case_count = 0;
+  switch_statement.cases_size = 0;
+  switch_statement.default_offset = 0;
+#ifdef JERRY_ENABLE_LINE_INFO
+  switch_statement.dispatch_line = context_p->last_line_info_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
   loop.branch_list_p = NULL;
 
   parser_stack_push (context_p, &switch_statement, sizeof (parser_switch_statement_t));
-  parser_stack_iterator_init (context_p, &iterator);
   parser_stack_push (context_p, &loop, sizeof (parser_loop_statement_t));
-  parser_stack_push_uint8 (context_p, PARSER_STATEMENT_SWITCH);
+  parser_stack_push_uint8 (context_p, PARSER_STATEMENT_SWITCH_NO_DEFAULT);
   parser_stack_iterator_init (context_p, &context_p->last_statement);
+} /* parser_parse_switch_statement_start */
+
+/**
+ * Free the pages of the deferred byte code stream which are passed
+ * by a position, except the first one.
+ */
+static void
+parser_free_deferred_pages (parser_mem_page_t *first_page_p, /**< first page, which is kept */
+                            const parser_cbc_stream_position_t *position_p) /**< position in
+                                                                             *   the deferred byte code */
+{
+  while (first_page_p != position_p->page_p && first_page_p->next_p != position_p->page_p)
+  {
+    parser_mem_page_t *page_p = first_page_p->next_p;
 
-  switch_case_was_found = false;
-  default_case_was_found = false;
+    first_page_p->next_p = page_p->next_p;
+    parser_free (page_p, sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE);
+  }
+} /* parser_free_deferred_pages */
 
-#ifdef JERRY_ENABLE_LINE_INFO
-  uint32_t last_line_info_line = context_p->last_line_info_line;
-#endif /* JERRY_ENABLE_LINE_INFO */
+/**
+ * Reverse a list of branches.
+ *
+ * @return first node of the reversed list
+ */
+static parser_branch_node_t *
+parser_reverse_branch_list (parser_branch_node_t *branch_list_p) /**< branch list */
+{
+  parser_branch_node_t *reversed_list_p = NULL;
+
+  while (branch_list_p != NULL)
+  {
+    parser_branch_node_t *next_p = branch_list_p->next_p;
+
+    branch_list_p->next_p = reversed_list_p;
+    reversed_list_p = branch_list_p;
+    branch_list_p = next_p;
+  }
+
+  return reversed_list_p;
+} /* parser_reverse_branch_list */
+
+/**
+ * Update the pending breaks and continues emitted into the clauses of
+ * the innermost switch statement after the clauses are moved behind
+ * the dispatcher.
+ */
+static void
+parser_move_switch_branches (parser_context_t *context_p, /**< context */
+                             const parser_switch_statement_t *switch_statement_p, /**< switch statement */
+                             uint32_t dispatcher_size) /**< size of the dispatcher */
+{
+  parser_stack_iterator_t iterator;
+
+  parser_stack_iterator_init (context_p, &iterator);
 
   while (true)
   {
-    parser_scan_until (context_p, &unused_range, LEXER_KEYW_CASE);
+    uint8_t type = parser_stack_iterator_read_uint8 (&iterator);
+    parser_branch_node_t *branch_list_p;
 
-    if (context_p->token.type == LEXER_KEYW_DEFAULT)
+    if (type == PARSER_STATEMENT_START)
     {
-      if (default_case_was_found)
-      {
-        parser_raise_error (context_p, PARSER_ERR_MULTIPLE_DEFAULTS_NOT_ALLOWED);
-      }
+      return;
+    }
 
-      lexer_next_token (context_p);
-      if (context_p->token.type != LEXER_COLON)
-      {
-        parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
-      }
+    if (type == PARSER_STATEMENT_LABEL)
+    {
+      parser_label_statement_t label;
 
-      default_case_was_found = true;
+      parser_stack_iterator_skip (&iterator, 1);
+      parser_stack_iterator_read (&iterator, &label, sizeof (parser_label_statement_t));
+      parser_stack_iterator_skip (&iterator, sizeof (parser_label_statement_t));
+      branch_list_p = label.break_list_p;
     }
-    else if (context_p->token.type == LEXER_KEYW_CASE
-             || context_p->token.type == LEXER_RIGHT_BRACE)
+    else if (type >= PARSER_STATEMENT_SWITCH && type <= PARSER_STATEMENT_FOR_IN)
     {
-      if (switch_case_was_found)
-      {
-        parser_branch_node_t *new_case_p;
-        uint16_t opcode = CBC_BRANCH_IF_STRICT_EQUAL;
+      parser_loop_statement_t loop;
 
-        if (context_p->token.type != LEXER_KEYW_CASE)
-        {
-          /* We don't duplicate the value for the last case. */
-          parser_emit_cbc (context_p, CBC_STRICT_EQUAL);
-          opcode = CBC_BRANCH_IF_TRUE_FORWARD;
-        }
-        new_case_p = parser_emit_cbc_forward_branch_item (context_p, opcode, NULL);
-        if (cases_p == NULL)
-        {
-          switch_statement.branch_list_p = new_case_p;
-          parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
-        }
-        else
-        {
-          cases_p->next_p = new_case_p;
-        }
-        cases_p = new_case_p;
-      }
+      parser_stack_iterator_skip (&iterator, 1);
+      parser_stack_iterator_read (&iterator, &loop, sizeof (parser_loop_statement_t));
+      parser_stack_iterator_skip (&iterator, parser_statement_length (type) - 1);
+      branch_list_p = loop.branch_list_p;
+    }
+    else
+    {
+      parser_stack_iterator_skip (&iterator, parser_statement_length (type));
+      continue;
+    }
 
-      /* End of switch statement. */
-      if (context_p->token.type == LEXER_RIGHT_BRACE)
+    /* New branches are inserted at the front of the lists, so a reversed
+     * list visits the pages of the byte code stream in increasing order. */
+    parser_branch_node_t *reversed_list_p = parser_reverse_branch_list (branch_list_p);
+    parser_mem_page_t *page_p = switch_statement_p->clauses.page_p;
+    uint32_t page_start = 0;
+
+    for (branch_list_p = reversed_list_p; branch_list_p != NULL; branch_list_p = branch_list_p->next_p)
+    {
+      uint32_t offset = branch_list_p->branch.offset >> 8;
+
+      if (offset < switch_statement_p->clauses_offset)
       {
-        break;
+        continue;
       }
 
-      lexer_next_token (context_p);
+      /* The branch offset follows the opcode, and the prefix byte of extended opcodes. */
+      uint32_t position = switch_statement_p->clauses.offset + (offset - switch_statement_p->clauses_offset) + 1;
 
-#ifdef JERRY_ENABLE_LINE_INFO
-      if (context_p->token.line != context_p->last_line_info_line)
+      if ((position % PARSER_CBC_STREAM_PAGE_SIZE) != (branch_list_p->branch.offset & CBC_LOWER_SEVEN_BIT_MASK))
       {
-        parser_emit_line_info (context_p, context_p->token.line, true);
+        position++;
       }
-#endif /* JERRY_ENABLE_LINE_INFO */
 
-      parser_parse_expression (context_p, PARSE_EXPR);
+      JERRY_ASSERT ((position % PARSER_CBC_STREAM_PAGE_SIZE)
+                    == (branch_list_p->branch.offset & CBC_LOWER_SEVEN_BIT_MASK));
+
+      position += dispatcher_size;
+
+      if (position < page_start)
+      {
+        page_p = switch_statement_p->clauses.page_p;
+        page_start = 0;
+      }
 
-      if (context_p->token.type != LEXER_COLON)
+      while (position >= page_start + PARSER_CBC_STREAM_PAGE_SIZE)
       {
-        parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
+        page_p = page_p->next_p;
+        page_start += PARSER_CBC_STREAM_PAGE_SIZE;
       }
-      switch_case_was_found = true;
+
+      branch_list_p->branch.page_p = page_p;
+      branch_list_p->branch.offset = ((branch_list_p->branch.offset & CBC_HIGHEST_BIT_MASK)
+                                      | (position - page_start)
+                                      | ((offset + dispatcher_size) << 8));
     }
 
-    lexer_next_token (context_p);
+    parser_reverse_branch_list (reversed_list_p);
   }
+} /* parser_move_switch_branches */
+
+/**
+ * Parse switch statement (ending part).
+ */
+static void JERRY_ATTR_NOINLINE
+parser_parse_switch_statement_end (parser_context_t *context_p) /**< context */
+{
+  parser_switch_statement_t switch_statement;
+  parser_loop_statement_t loop;
+  parser_cbc_stream_position_t position;
+  parser_cbc_stream_position_t clause_position;
+  parser_branch_t branch;
+  parser_branch_t default_branch;
+  bool has_default = (context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH);
 
-  JERRY_ASSERT (switch_case_was_found || default_case_was_found);
+  JERRY_ASSERT (context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH
+                || context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH_NO_DEFAULT);
 
-#ifdef JERRY_ENABLE_LINE_INFO
-  context_p->last_line_info_line = last_line_info_line;
-#endif /* JERRY_ENABLE_LINE_INFO */
+  parser_stack_iterator_t iterator;
+  parser_stack_iterator_init (context_p, &iterator);
+
+  parser_stack_iterator_skip (&iterator, 1);
+  parser_stack_iterator_read (&iterator, &loop, sizeof (parser_loop_statement_t));
+  parser_stack_iterator_skip (&iterator, sizeof (parser_loop_statement_t));
+  parser_stack_iterator_read (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+
+  parser_flush_cbc (context_p);
+
+  uint32_t clauses_end = context_p->byte_code_size;
+  uint32_t no_end_label = context_p->status_flags & PARSER_NO_END_LABEL;
+  uint32_t default_offset = has_default ? switch_statement.default_offset : clauses_end;
+  bool is_end_target = (default_offset == clauses_end);
 
-  if (!switch_case_was_found)
+  /* Each case is a comparison followed by a branch, and the dispatcher ends
+   * with a jump to the default clause. The extra byte is either a CBC_POP
+   * when there are no cases, or the CBC_STRICT_EQUAL of the last case. */
+  uint32_t dispatcher_size = (switch_statement.cases_size
+                              + switch_statement.case_count * PARSER_FORWARD_BRANCH_LENGTH
+                              + 1 + PARSER_FORWARD_BRANCH_LENGTH);
+
+  /* The clauses are moved into the deferred byte code stream while the dispatcher
+   * is emitted in front of them, and moved back afterwards. The moves relink the
+   * pages of the clauses, so their byte code is never stored twice. */
+  parser_cbc_stream_get_position (context_p, &context_p->deferred_byte_code, &clause_position);
+  parser_cbc_stream_move (context_p, &context_p->deferred_byte_code, &context_p->byte_code, &switch_statement.clauses);
+  context_p->byte_code_size = switch_statement.clauses_offset;
+
+  PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
+
+  if (switch_statement.case_count == 0)
   {
     /* There was no case statement, so the expression result
      * of the switch must be popped from the stack */
     parser_emit_cbc (context_p, CBC_POP);
   }
 
-  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &switch_statement.default_branch);
-  parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+  position = switch_statement.cases;
 
-  if (!default_case_was_found)
+  for (uint32_t i = switch_statement.case_count; i > 0; i--)
   {
-    parser_stack_change_last_uint8 (context_p, PARSER_STATEMENT_SWITCH_NO_DEFAULT);
+    parser_switch_case_t switch_case;
+    uint16_t opcode = CBC_BRANCH_IF_STRICT_EQUAL;
+
+    parser_cbc_stream_read (&position, (uint8_t *) &switch_case, sizeof (parser_switch_case_t));
+    parser_emit_deferred_byte_code (context_p, &position, switch_case.size);
+    PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
+
+    if (i == 1)
+    {
+      /* We don't duplicate the value for the last case. */
+      parser_emit_cbc (context_p, CBC_STRICT_EQUAL);
+      opcode = CBC_BRANCH_IF_TRUE_FORWARD;
+    }
+
+    parser_emit_cbc_forward_branch (context_p, opcode, &branch);
+    parser_set_branch_to_offset (&branch, switch_case.offset + dispatcher_size);
+
+    if (switch_case.offset == clauses_end)
+    {
+      is_end_target = true;
+    }
+
+    /* The dispatcher pages can reuse the memory of the cases. */
+    parser_free_deferred_pages (switch_statement.cases.page_p, &position);
   }
 
-  parser_set_range (context_p, &switch_body_start);
-  lexer_next_token (context_p);
-} /* parser_parse_switch_statement_start */
+  parser_emit_cbc_forward_branch (context_p, CBC_JUMP_FORWARD, &default_branch);
+  parser_set_branch_to_offset (&default_branch, default_offset + dispatcher_size);
+
+  JERRY_ASSERT (context_p->byte_code_size == switch_statement.clauses_offset + dispatcher_size);
+
+  parser_cbc_stream_move (context_p, &context_p->byte_code, &context_p->deferred_byte_code, &clause_position);
+  parser_cbc_stream_truncate (&context_p->deferred_byte_code, &switch_statement.cases);
+  context_p->byte_code_size = clauses_end + dispatcher_size;
+
+  /* The end of the clauses follows the last byte code of the clauses,
+   * unless a branch of the dispatcher targets it. */
+  context_p->status_flags &= (uint32_t) ~PARSER_NO_END_LABEL;
+
+  if (!is_end_target)
+  {
+    context_p->status_flags |= no_end_label;
+  }
+
+  parser_move_switch_branches (context_p, &switch_statement, dispatcher_size);
+
+  parser_stack_pop (context_p, NULL, 1 + sizeof (parser_loop_statement_t) + sizeof (parser_switch_statement_t));
+  parser_stack_iterator_init (context_p, &context_p->last_statement);
+
+  parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
+} /* parser_parse_switch_statement_end */
 
 /**
  * Parse try statement (ending part).
@@ -1340,16 +1629,29 @@ parser_parse_default_statement (parser_context_t *context_p) /**< context */
     parser_raise_error (context_p, PARSER_ERR_DEFAULT_NOT_IN_SWITCH);
   }
 
+  if (context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH)
+  {
+    parser_raise_error (context_p, PARSER_ERR_MULTIPLE_DEFAULTS_NOT_ALLOWED);
+  }
+
   lexer_next_token (context_p);
-  /* Already checked in parser_parse_switch_statement_start. */
-  JERRY_ASSERT (context_p->token.type == LEXER_COLON);
+
+  if (context_p->token.type != LEXER_COLON)
+  {
+    parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
+  }
+
   lexer_next_token (context_p);
+  parser_flush_cbc (context_p);
 
   parser_stack_iterator_init (context_p, &iterator);
   parser_stack_iterator_skip (&iterator, 1 + sizeof (parser_loop_statement_t));
   parser_stack_iterator_read (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
 
-  parser_set_branch_to_current_position (context_p, &switch_statement.default_branch);
+  switch_statement.default_offset = context_p->byte_code_size;
+  parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
+
+  parser_stack_change_last_uint8 (context_p, PARSER_STATEMENT_SWITCH);
 } /* parser_parse_default_statement */
 
 /**
@@ -1360,8 +1662,9 @@ parser_parse_case_statement (parser_context_t *context_p) /**< context */
 {
   parser_stack_iterator_t iterator;
   parser_switch_statement_t switch_statement;
-  lexer_range_t dummy_range;
-  parser_branch_node_t *branch_p;
+  parser_switch_case_t switch_case;
+  parser_cbc_stream_position_t expression_start;
+  uint16_t stack_depth = context_p->stack_depth;
 
   if (context_p->stack_top_uint8 != PARSER_STATEMENT_SWITCH
       && context_p->stack_top_uint8 != PARSER_STATEMENT_SWITCH_NO_DEFAULT)
@@ -1369,22 +1672,56 @@ parser_parse_case_statement (parser_context_t *context_p) /**< context */
     parser_raise_error (context_p, PARSER_ERR_CASE_NOT_IN_SWITCH);
   }
 
-  parser_scan_until (context_p, &dummy_range, LEXER_COLON);
-  lexer_next_token (context_p);
-
   parser_stack_iterator_init (context_p, &iterator);
   parser_stack_iterator_skip (&iterator, 1 + sizeof (parser_loop_statement_t));
   parser_stack_iterator_read (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
 
-  /* Free memory after the case statement is found. */
+  parser_flush_cbc (context_p);
+  switch_case.offset = context_p->byte_code_size;
+  parser_cbc_stream_get_position (context_p, &context_p->byte_code, &expression_start);
+
+  /* The case expression is parsed here, but its byte code is emitted into
+   * the dispatcher, where the switch value is below the case value. */
+  PARSER_PLUS_EQUAL_U16 (context_p->stack_depth, 1);
+
+  lexer_next_token (context_p);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  uint32_t last_line_info_line = context_p->last_line_info_line;
 
-  branch_p = switch_statement.branch_list_p;
-  JERRY_ASSERT (branch_p != NULL);
-  switch_statement.branch_list_p = branch_p->next_p;
+  if (context_p->token.line != switch_statement.dispatch_line)
+  {
+    parser_emit_line_info (context_p, context_p->token.line, true);
+    switch_statement.dispatch_line = context_p->token.line;
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  parser_parse_expression (context_p, PARSE_EXPR);
+
+  if (context_p->token.type != LEXER_COLON)
+  {
+    parser_raise_error (context_p, PARSER_ERR_COLON_EXPECTED);
+  }
+
+  parser_flush_cbc (context_p);
+  switch_case.size = context_p->byte_code_size - switch_case.offset;
+
+  parser_cbc_stream_write (context_p,
+                           &context_p->deferred_byte_code,
+                           (const uint8_t *) &switch_case,
+                           sizeof (parser_switch_case_t));
+  parser_defer_byte_code (context_p, &expression_start, switch_case.offset);
+  context_p->stack_depth = stack_depth;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  context_p->last_line_info_line = last_line_info_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  switch_statement.case_count++;
+  switch_statement.cases_size += switch_case.size;
   parser_stack_iterator_write (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
 
-  parser_set_branch_to_current_position (context_p, &branch_p->branch);
-  parser_free (branch_p, sizeof (parser_branch_node_t));
+  lexer_next_token (context_p);
 } /* parser_parse_case_statement */
 
 /**
@@ -2043,23 +2380,7 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
       else if (context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH
                || context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH_NO_DEFAULT)
       {
-        int has_default = (context_p->stack_top_uint8 == PARSER_STATEMENT_SWITCH);
-        parser_loop_statement_t loop;
-        parser_switch_statement_t switch_statement;
-
-        parser_stack_pop_uint8 (context_p);
-        parser_stack_pop (context_p, &loop, sizeof (parser_loop_statement_t));
-        parser_stack_pop (context_p, &switch_statement, sizeof (parser_switch_statement_t));
-        parser_stack_iterator_init (context_p, &context_p->last_statement);
-
-        JERRY_ASSERT (switch_statement.branch_list_p == NULL);
-
-        if (!has_default)
-        {
-          parser_set_branch_to_current_position (context_p, &switch_statement.default_branch);
-        }
-
-        parser_set_breaks_to_current_position (context_p, loop.branch_list_p);
+        parser_parse_switch_statement_end (context_p);
         lexer_next_token (context_p);
       }
       else if (context_p->stack_top_uint8 == PARSER_STATEMENT_TRY)
@@ -2249,13 +2570,6 @@ parser_free_jumps (parser_stack_iterator_t iterator) /**< iterator position */
         parser_stack_iterator_read (&iterator, &switch_statement, sizeof (parser_switch_statement_t));
         parser_stack_iterator_skip (&iterator, sizeof (parser_switch_statement_t));
 
-        branch_list_p = switch_statement.branch_list_p;
-        while (branch_list_p != NULL)
-        {
-          parser_branch_node_t *next_p = branch_list_p->next_p;
-          parser_free (branch_list_p, sizeof (parser_branch_node_t));
-          branch_list_p = next_p;
-        }
         branch_list_p = loop.branch_list_p;
         break;
       }
@@ -650,10 +650,6 @@ void
 parser_set_branch_to_current_position (parser_context_t *context_p, /**< context */
                                        parser_branch_t *branch_p) /**< branch result */
 {
-  uint32_t delta;
-  size_t offset;
-  parser_mem_page_t *page_p = branch_p->page_p;
-
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -661,9 +657,23 @@ parser_set_branch_to_current_position (parser_context_t *context_p, /**< context
 
   context_p->status_flags &= (uint32_t) ~PARSER_NO_END_LABEL;
 
-  JERRY_ASSERT (context_p->byte_code_size > (branch_p->offset >> 8));
+  parser_set_branch_to_offset (branch_p, context_p->byte_code_size);
+} /* parser_set_branch_to_current_position */
 
-  delta = context_p->byte_code_size - (branch_p->offset >> 8);
+/**
+ * Set a forward branch to a byte code offset
+ */
+void
+parser_set_branch_to_offset (parser_branch_t *branch_p, /**< branch result */
+                             uint32_t target_offset) /**< target byte code offset */
+{
+  uint32_t delta;
+  size_t offset;
+  parser_mem_page_t *page_p = branch_p->page_p;
+
+  JERRY_ASSERT (target_offset > (branch_p->offset >> 8));
+
+  delta = target_offset - (branch_p->offset >> 8);
   offset = (branch_p->offset & CBC_LOWER_SEVEN_BIT_MASK);
 
   JERRY_ASSERT (delta <= PARSER_MAXIMUM_CODE_SIZE);
@@ -690,7 +700,7 @@ parser_set_branch_to_current_position (parser_context_t *context_p, /**< context
   }
 #endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
   page_p->bytes[offset++] = delta & 0xff;
-} /* parser_set_branch_to_current_position */
+} /* parser_set_branch_to_offset */
 
 /**
  * Set breaks to the current byte code position
@@ -19,6 +19,7 @@
 #include "ecma-literal-storage.h"
 #include "jcontext.h"
 #include "js-parser-internal.h"
+#include "jrt-tracepoints.h"
 
 #ifndef JERRY_DISABLE_JS_PARSER
 
@@ -1650,20 +1651,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     length++;
   }
 
-  needs_uint16_arguments = false;
-  total_size = sizeof (cbc_uint8_arguments_t);
-
-  if (context_p->stack_limit > CBC_MAXIMUM_BYTE_VALUE
-      || context_p->register_count > CBC_MAXIMUM_BYTE_VALUE
-      || context_p->literal_count > CBC_MAXIMUM_BYTE_VALUE)
-  {
-    needs_uint16_arguments = true;
-    total_size = sizeof (cbc_uint16_arguments_t);
-  }
-
   literal_length = (size_t) (context_p->literal_count - context_p->register_count) * sizeof (ecma_value_t);
 
-  total_size += literal_length + length;
+  total_size = literal_length + length;
 
   if ((context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
       && !(context_p->status_flags & PARSER_IS_STRICT))
@@ -1678,6 +1668,23 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 #endif /* JERRY_ENABLE_LINE_INFO */
 
+  needs_uint16_arguments = false;
+
+  /* The size of oversized functions does not fit into the compact header,
+   * the upper part of their size is stored in cbc_uint16_arguments_t. */
+  if (context_p->stack_limit > CBC_MAXIMUM_BYTE_VALUE
+      || context_p->register_count > CBC_MAXIMUM_BYTE_VALUE
+      || context_p->literal_count > CBC_MAXIMUM_BYTE_VALUE
+      || total_size + sizeof (cbc_uint8_arguments_t) > ECMA_COMPILED_CODE_COMPACT_SIZE_LIMIT)
+  {
+    needs_uint16_arguments = true;
+    total_size += sizeof (cbc_uint16_arguments_t);
+  }
+  else
+  {
+    total_size += sizeof (cbc_uint8_arguments_t);
+  }
+
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
   total_size_used = total_size;
 #endif
@@ -1698,7 +1705,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #endif /* JMEM_STATS */
 
   byte_code_p = (uint8_t *) compiled_code_p;
-  compiled_code_p->size = (uint16_t) (total_size >> JMEM_ALIGNMENT_LOG);
   compiled_code_p->refs = 1;
   compiled_code_p->status_flags = CBC_CODE_FLAGS_FUNCTION;
 
@@ -1730,6 +1736,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     byte_code_p += sizeof (cbc_uint8_arguments_t);
   }
 
+  ecma_compiled_code_set_size (compiled_code_p, total_size);
+
   if (context_p->literal_count > CBC_MAXIMUM_SMALL_VALUE)
   {
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_FULL_LITERAL_ENCODING;
@@ -2276,6 +2284,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
 
   parser_cbc_stream_init (&context.byte_code);
   context.byte_code_size = 0;
+  parser_cbc_stream_init (&context.deferred_byte_code);
   parser_list_init (&context.literal_pool,
                     sizeof (lexer_literal_t),
                     (uint32_t) ((128 - sizeof (void *)) / sizeof (lexer_literal_t)));
@@ -2386,6 +2395,7 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
 #endif /* PARSER_DUMP_BYTE_CODE */
 
   parser_stack_free (&context);
+  parser_cbc_stream_free (&context.deferred_byte_code);
 
   return compiled_code;
 } /* parser_parse_source */
@@ -2834,6 +2844,8 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
   }
 #endif /* JERRY_DEBUGGER */
 
+  JERRY_TRACEPOINT2 (parse__begin, (uintptr_t) source_p, source_size);
+
   *bytecode_data_p = parser_parse_source (arg_list_p,
                                           arg_list_size,
                                           source_p,
@@ -2841,6 +2853,8 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
                                           is_strict,
                                           &parser_error);
 
+  JERRY_TRACEPOINT1 (parse__end, (uintptr_t) *bytecode_data_p);
+
   if (!*bytecode_data_p)
   {
 #ifdef JERRY_DEBUGGER
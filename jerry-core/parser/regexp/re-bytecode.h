@@ -81,6 +81,11 @@ typedef enum
 
 /**
  * Compiled byte code data.
+ *
+ * Note:
+ *      compiled regular expressions are saved into snapshots, so
+ *      JERRY_SNAPSHOT_VERSION must be increased when this structure
+ *      or the re_opcode_t list is changed.
  */
 typedef struct
 {
@@ -596,6 +596,23 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
                              0,
                              (uint8_t *) &re_compiled_code,
                              sizeof (re_compiled_code_t));
+
+    /* Release the unused part of the last bytecode block. This also keeps
+     * the compiled code compact when it is saved into a snapshot. */
+    size_t used_size = JERRY_ALIGNUP (re_get_bytecode_length (&bc_ctx), JMEM_ALIGNMENT);
+    size_t block_size = (size_t) (bc_ctx.block_end_p - bc_ctx.block_start_p);
+
+    if (used_size < block_size)
+    {
+      uint8_t *block_start_p = (uint8_t *) jmem_heap_alloc_block (used_size);
+
+      memcpy (block_start_p, bc_ctx.block_start_p, used_size);
+      jmem_heap_free_block (bc_ctx.block_start_p, block_size);
+
+      bc_ctx.current_p = block_start_p + (bc_ctx.current_p - bc_ctx.block_start_p);
+      bc_ctx.block_start_p = block_start_p;
+      bc_ctx.block_end_p = block_start_p + used_size;
+    }
   }
 
   size_t byte_code_size = (size_t) (bc_ctx.block_end_p - bc_ctx.block_start_p);
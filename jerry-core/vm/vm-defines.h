@@ -36,6 +36,48 @@
  */
 typedef const uint8_t *vm_instr_counter_t;
 
+#ifdef JERRY_JIT
+
+/**
+ * Number of hash table buckets of the functions compiled by the JIT compiler.
+ */
+#define VM_JIT_HASH_SIZE 64
+
+/**
+ * Number of execution counters used for selecting the functions compiled by the JIT compiler.
+ */
+#define VM_JIT_COUNTER_SIZE 256
+
+/**
+ * The instruction has no native code, it must be executed by the interpreter.
+ */
+#define VM_JIT_ENTRY_INTERPRETED 0x80000000u
+
+/**
+ * Entry point of a byte code instruction in the native code.
+ */
+typedef struct
+{
+  uint32_t byte_code_offset;                          /**< offset of the instruction from the byte code header */
+  uint32_t native_offset;                             /**< offset of its native code, combined with
+                                                       *   VM_JIT_ENTRY_INTERPRETED if it is not compiled */
+} vm_jit_entry_t;
+
+/**
+ * Function compiled by the JIT compiler.
+ */
+typedef struct vm_jit_function_t
+{
+  struct vm_jit_function_t *next_p;                   /**< next function in the same hash bucket */
+  const ecma_compiled_code_t *bytecode_header_p;      /**< compiled byte-code data */
+  uint8_t *code_p;                                    /**< native code (NULL if the compilation failed) */
+  size_t code_size;                                   /**< size of the native code block */
+  const vm_jit_entry_t *entries_p;                    /**< entry points sorted by byte code offset */
+  uint32_t entry_count;                               /**< number of entry points */
+} vm_jit_function_t;
+
+#endif /* JERRY_JIT */
+
 /**
  * Context of interpreter, related to a JS stack frame
  */
@@ -58,6 +100,9 @@ typedef struct vm_frame_ctx_t
   uint16_t context_depth;                             /**< current context depth */
   uint8_t is_eval_code;                               /**< eval mode flag */
   uint8_t call_operation;                             /**< perform a call or construct operation */
+#ifdef JERRY_JIT
+  const vm_jit_function_t *jit_function_p;            /**< native code of the function (NULL if not compiled) */
+#endif /* JERRY_JIT */
 } vm_frame_ctx_t;
 
 /**
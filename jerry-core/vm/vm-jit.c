@@ -0,0 +1,2856 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte-code.h"
+#include "ecma-array-object.h"
+#include "ecma-comparison.h"
+#include "ecma-conversion.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jerryscript-port.h"
+#include "vm.h"
+#include "vm-jit.h"
+
+#ifdef JERRY_JIT
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_jit Baseline JIT compiler
+ * @{
+ *
+ * The compiler translates the byte code of hot functions into x86-64 machine code.
+ * The native code uses the frame context and the value stack of the interpreter,
+ * so it can return to the interpreter before any instruction. Instructions which
+ * are not compiled (e.g. context handling) are executed by the interpreter, and
+ * the native code is entered again at the next compiled instruction.
+ *
+ * Register usage of the native code:
+ *   rbx - frame context
+ *   r12 - stack top (stored into the frame context before calling helpers
+ *         which access the stack and when the native code returns)
+ *   r13 - registers of the function
+ *   r14 - left operand
+ *   r15 - right operand
+ *   [rsp] - temporary slot
+ */
+
+/**
+ * x86-64 registers.
+ */
+typedef enum
+{
+  VM_JIT_RAX, /**< rax */
+  VM_JIT_RCX, /**< rcx */
+  VM_JIT_RDX, /**< rdx */
+  VM_JIT_RBX, /**< rbx */
+  VM_JIT_RSP, /**< rsp */
+  VM_JIT_RBP, /**< rbp */
+  VM_JIT_RSI, /**< rsi */
+  VM_JIT_RDI, /**< rdi */
+  VM_JIT_R8, /**< r8 */
+  VM_JIT_R9, /**< r9 */
+  VM_JIT_R10, /**< r10 */
+  VM_JIT_R11, /**< r11 */
+  VM_JIT_R12, /**< r12 */
+  VM_JIT_R13, /**< r13 */
+  VM_JIT_R14, /**< r14 */
+  VM_JIT_R15, /**< r15 */
+} vm_jit_register_t;
+
+/**
+ * Register which holds the frame context.
+ */
+#define VM_JIT_FRAME VM_JIT_RBX
+
+/**
+ * Register which holds the stack top.
+ */
+#define VM_JIT_STACK_TOP VM_JIT_R12
+
+/**
+ * Register which holds the start of the registers.
+ */
+#define VM_JIT_REGISTERS VM_JIT_R13
+
+/**
+ * Register which holds the left operand.
+ */
+#define VM_JIT_LEFT VM_JIT_R14
+
+/**
+ * Register which holds the right operand.
+ */
+#define VM_JIT_RIGHT VM_JIT_R15
+
+/**
+ * Condition codes.
+ */
+typedef enum
+{
+  VM_JIT_CC_O = 0x0, /**< overflow */
+  VM_JIT_CC_NO = 0x1, /**< not overflow */
+  VM_JIT_CC_B = 0x2, /**< below */
+  VM_JIT_CC_AE = 0x3, /**< above or equal */
+  VM_JIT_CC_E = 0x4, /**< equal */
+  VM_JIT_CC_NE = 0x5, /**< not equal */
+  VM_JIT_CC_BE = 0x6, /**< below or equal */
+  VM_JIT_CC_A = 0x7, /**< above */
+  VM_JIT_CC_S = 0x8, /**< sign */
+  VM_JIT_CC_NS = 0x9, /**< not sign */
+  VM_JIT_CC_L = 0xc, /**< less */
+  VM_JIT_CC_GE = 0xd, /**< greater or equal */
+  VM_JIT_CC_LE = 0xe, /**< less or equal */
+  VM_JIT_CC_G = 0xf, /**< greater */
+  VM_JIT_CC_ALWAYS = 0x10, /**< unconditional jump */
+} vm_jit_condition_t;
+
+/**
+ * Inverse of a condition code.
+ */
+#define VM_JIT_CC_INVERT(cc) ((vm_jit_condition_t) ((cc) ^ 0x1))
+
+/**
+ * Arithmetic instructions (the value is the extension of the immediate form).
+ */
+typedef enum
+{
+  VM_JIT_ALU_ADD = 0, /**< add */
+  VM_JIT_ALU_OR = 1, /**< or */
+  VM_JIT_ALU_AND = 4, /**< and */
+  VM_JIT_ALU_SUB = 5, /**< sub */
+  VM_JIT_ALU_XOR = 6, /**< xor */
+  VM_JIT_ALU_CMP = 7, /**< cmp */
+} vm_jit_alu_t;
+
+/**
+ * Shift instructions (the value is the extension of the opcode).
+ */
+typedef enum
+{
+  VM_JIT_SHIFT_SHL = 4, /**< shift left */
+  VM_JIT_SHIFT_SHR = 5, /**< logical shift right */
+  VM_JIT_SHIFT_SAR = 7, /**< arithmetic shift right */
+} vm_jit_shift_t;
+
+/**
+ * Ownership flags of the operands.
+ */
+typedef enum
+{
+  VM_JIT_OPERAND_LEFT = (1u << 0), /**< left operand */
+  VM_JIT_OPERAND_RIGHT = (1u << 1), /**< right operand */
+} vm_jit_operand_flags_t;
+
+/**
+ * Maximum number of unresolved jumps to a local label.
+ */
+#define VM_JIT_LABEL_MAX_JUMPS 8
+
+/**
+ * Offset of an unbound label.
+ */
+#define VM_JIT_LABEL_UNBOUND UINT32_MAX
+
+/**
+ * Local label of the native code.
+ */
+typedef struct
+{
+  uint32_t offset; /**< offset of the label */
+  uint32_t jump_count; /**< number of unresolved jumps */
+  uint32_t jumps[VM_JIT_LABEL_MAX_JUMPS]; /**< offsets of the displacements of unresolved jumps */
+} vm_jit_label_t;
+
+/**
+ * Decoded byte code instruction.
+ */
+typedef struct
+{
+  const uint8_t *byte_code_p; /**< start of the instruction */
+  const uint8_t *next_p; /**< start of the next instruction */
+  const uint8_t *branch_target_p; /**< branch target (NULL if the instruction is not a branch) */
+  uint32_t opcode; /**< opcode (extended opcodes start from CBC_END + 1) */
+  uint32_t opcode_data; /**< decoded opcode data (see vm_decode_table) */
+  uint32_t line; /**< line number of CBC_EXT_LINE */
+  uint16_t literals[3]; /**< literal indicies */
+  uint8_t literal_count; /**< number of literal indicies */
+  uint8_t byte_arg; /**< byte argument */
+} vm_jit_instruction_t;
+
+/**
+ * Compiler state.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< native code buffer (NULL while the code size is computed) */
+  uint32_t offset; /**< current offset of the native code */
+  const ecma_compiled_code_t *bytecode_header_p; /**< compiled byte code */
+  const ecma_value_t *literal_start_p; /**< literal list start pointer */
+  const uint8_t *body_start_p; /**< first instruction after the initializers */
+  vm_jit_entry_t *entries_p; /**< entry points of the instructions */
+  uint32_t entry_count; /**< number of instructions */
+  uint32_t error_offsets[4]; /**< error exits, which free the owned operands (see vm_jit_operand_flags_t) */
+  uint32_t exit_value_offset; /**< exit which returns with the value in eax */
+  uint32_t exit_interpreter_offset; /**< exit which continues the execution in the interpreter
+                                     *   from the instruction stored in rax */
+  uint16_t encoding_limit; /**< literal encoding limit */
+  uint16_t encoding_delta; /**< literal encoding delta */
+  uint16_t register_end; /**< end position of the register group */
+  uint16_t ident_end; /**< end position of the identifier group */
+  uint16_t const_literal_end; /**< end position of the const literal group */
+  uint32_t operands; /**< operands which must be freed (see vm_jit_operand_flags_t) */
+  uint32_t integer_operands; /**< operands which are integer constants */
+  uint32_t other_operands; /**< operands which are non-integer constants */
+  ecma_value_t right_constant; /**< value of the right operand if it is an integer constant */
+} vm_jit_compiler_t;
+
+/**
+ * Type of the native code.
+ */
+typedef ecma_value_t (*vm_jit_native_code_t) (vm_frame_ctx_t *frame_ctx_p, const uint8_t *entry_p);
+
+JERRY_STATIC_ASSERT (sizeof (vm_jit_native_code_t) == sizeof (uint8_t *),
+                     native_code_pointers_must_have_the_size_of_data_pointers);
+
+JERRY_STATIC_ASSERT ((ECMA_VALUE_TRUE ^ ECMA_VALUE_FALSE) == (1u << ECMA_DIRECT_SHIFT),
+                     true_and_false_values_must_differ_in_the_lowest_value_bit);
+
+JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
+                     direct_type_mask_must_fill_all_bits_before_the_value_starts);
+
+/**
+ * Address of a helper function.
+ */
+#define VM_JIT_FUNCTION_ADDRESS(function) ((uint64_t) (uintptr_t) (function))
+
+/**
+ * Displacement of a frame context member.
+ */
+#define VM_JIT_FRAME_OFFSET(member) ((int32_t) offsetof (vm_frame_ctx_t, member))
+
+/**
+ * Emit a byte.
+ */
+static void
+vm_jit_emit_byte (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uint32_t value) /**< byte value */
+{
+  if (compiler_p->buffer_p != NULL)
+  {
+    compiler_p->buffer_p[compiler_p->offset] = (uint8_t) value;
+  }
+
+  compiler_p->offset++;
+} /* vm_jit_emit_byte */
+
+/**
+ * Emit a 32 bit little endian value.
+ */
+static void
+vm_jit_emit_u32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 uint32_t value) /**< value */
+{
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    vm_jit_emit_byte (compiler_p, value & 0xff);
+    value >>= 8;
+  }
+} /* vm_jit_emit_u32 */
+
+/**
+ * Emit a REX prefix if it is needed.
+ */
+static void
+vm_jit_emit_rex (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 bool is_64bit, /**< 64 bit operand size */
+                 uint32_t reg, /**< register of the ModRM reg field */
+                 uint32_t base, /**< register of the ModRM rm field */
+                 bool is_forced) /**< emit the prefix even if it has no bits */
+{
+  uint32_t rex = 0x40;
+
+  if (is_64bit)
+  {
+    rex |= 0x8;
+  }
+
+  if (reg & 0x8)
+  {
+    rex |= 0x4;
+  }
+
+  if (base & 0x8)
+  {
+    rex |= 0x1;
+  }
+
+  if (rex != 0x40 || is_forced)
+  {
+    vm_jit_emit_byte (compiler_p, rex);
+  }
+} /* vm_jit_emit_rex */
+
+/**
+ * Emit an instruction with a register-register ModRM operand.
+ */
+static void
+vm_jit_emit_op_reg (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    uint32_t opcode, /**< opcode (0x0fxx for two byte opcodes) */
+                    bool is_64bit, /**< 64 bit operand size */
+                    uint32_t reg, /**< register (or opcode extension) of the reg field */
+                    vm_jit_register_t rm) /**< register of the rm field */
+{
+  vm_jit_emit_rex (compiler_p, is_64bit, reg, rm, false);
+
+  if (opcode > 0xff)
+  {
+    vm_jit_emit_byte (compiler_p, opcode >> 8);
+  }
+
+  vm_jit_emit_byte (compiler_p, opcode & 0xff);
+  vm_jit_emit_byte (compiler_p, 0xc0 | ((reg & 0x7) << 3) | (rm & 0x7));
+} /* vm_jit_emit_op_reg */
+
+/**
+ * Emit an instruction with a [base + displacement] ModRM operand.
+ */
+static void
+vm_jit_emit_op_mem (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    uint32_t opcode, /**< opcode */
+                    bool is_64bit, /**< 64 bit operand size */
+                    uint32_t reg, /**< register (or opcode extension) of the reg field */
+                    vm_jit_register_t base, /**< base register */
+                    int32_t displacement) /**< displacement */
+{
+  uint32_t mod;
+
+  vm_jit_emit_rex (compiler_p, is_64bit, reg, base, false);
+  vm_jit_emit_byte (compiler_p, opcode);
+
+  if (displacement == 0 && (base & 0x7) != VM_JIT_RBP)
+  {
+    mod = 0x00;
+  }
+  else if (displacement >= INT8_MIN && displacement <= INT8_MAX)
+  {
+    mod = 0x40;
+  }
+  else
+  {
+    mod = 0x80;
+  }
+
+  vm_jit_emit_byte (compiler_p, mod | ((reg & 0x7) << 3) | (base & 0x7));
+
+  if ((base & 0x7) == VM_JIT_RSP)
+  {
+    /* SIB byte: no index. */
+    vm_jit_emit_byte (compiler_p, 0x24);
+  }
+
+  if (mod == 0x40)
+  {
+    vm_jit_emit_byte (compiler_p, (uint32_t) displacement);
+  }
+  else if (mod == 0x80)
+  {
+    vm_jit_emit_u32 (compiler_p, (uint32_t) displacement);
+  }
+} /* vm_jit_emit_op_mem */
+
+/**
+ * Emit: mov reg32, [base + displacement]
+ */
+static void
+vm_jit_emit_load32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    vm_jit_register_t reg, /**< destination */
+                    vm_jit_register_t base, /**< base register */
+                    int32_t displacement) /**< displacement */
+{
+  vm_jit_emit_op_mem (compiler_p, 0x8b, false, reg, base, displacement);
+} /* vm_jit_emit_load32 */
+
+/**
+ * Emit: mov [base + displacement], reg32
+ */
+static void
+vm_jit_emit_store32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     vm_jit_register_t base, /**< base register */
+                     int32_t displacement, /**< displacement */
+                     vm_jit_register_t reg) /**< source */
+{
+  vm_jit_emit_op_mem (compiler_p, 0x89, false, reg, base, displacement);
+} /* vm_jit_emit_store32 */
+
+/**
+ * Emit: mov reg64, [base + displacement]
+ */
+static void
+vm_jit_emit_load64 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    vm_jit_register_t reg, /**< destination */
+                    vm_jit_register_t base, /**< base register */
+                    int32_t displacement) /**< displacement */
+{
+  vm_jit_emit_op_mem (compiler_p, 0x8b, true, reg, base, displacement);
+} /* vm_jit_emit_load64 */
+
+/**
+ * Emit: mov [base + displacement], reg64
+ */
+static void
+vm_jit_emit_store64 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     vm_jit_register_t base, /**< base register */
+                     int32_t displacement, /**< displacement */
+                     vm_jit_register_t reg) /**< source */
+{
+  vm_jit_emit_op_mem (compiler_p, 0x89, true, reg, base, displacement);
+} /* vm_jit_emit_store64 */
+
+/**
+ * Emit: mov dword [base + displacement], imm32
+ */
+static void
+vm_jit_emit_store_imm32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                         vm_jit_register_t base, /**< base register */
+                         int32_t displacement, /**< displacement */
+                         uint32_t value) /**< immediate value */
+{
+  vm_jit_emit_op_mem (compiler_p, 0xc7, false, 0, base, displacement);
+  vm_jit_emit_u32 (compiler_p, value);
+} /* vm_jit_emit_store_imm32 */
+
+/**
+ * Emit: mov dst32, src32
+ */
+static void
+vm_jit_emit_mov32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   vm_jit_register_t dst, /**< destination */
+                   vm_jit_register_t src) /**< source */
+{
+  if (dst != src)
+  {
+    vm_jit_emit_op_reg (compiler_p, 0x89, false, src, dst);
+  }
+} /* vm_jit_emit_mov32 */
+
+/**
+ * Emit: mov dst64, src64
+ */
+static void
+vm_jit_emit_mov64 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   vm_jit_register_t dst, /**< destination */
+                   vm_jit_register_t src) /**< source */
+{
+  vm_jit_emit_op_reg (compiler_p, 0x89, true, src, dst);
+} /* vm_jit_emit_mov64 */
+
+/**
+ * Emit: mov reg32, imm32
+ */
+static void
+vm_jit_emit_mov32_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_register_t reg, /**< destination */
+                       uint32_t value) /**< immediate value */
+{
+  vm_jit_emit_rex (compiler_p, false, 0, reg, false);
+  vm_jit_emit_byte (compiler_p, 0xb8 | (reg & 0x7));
+  vm_jit_emit_u32 (compiler_p, value);
+} /* vm_jit_emit_mov32_imm */
+
+/**
+ * Emit: mov reg64, imm64
+ */
+static void
+vm_jit_emit_mov64_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_register_t reg, /**< destination */
+                       uint64_t value) /**< immediate value */
+{
+  vm_jit_emit_rex (compiler_p, true, 0, reg, false);
+  vm_jit_emit_byte (compiler_p, 0xb8 | (reg & 0x7));
+  vm_jit_emit_u32 (compiler_p, (uint32_t) value);
+  vm_jit_emit_u32 (compiler_p, (uint32_t) (value >> 32));
+} /* vm_jit_emit_mov64_imm */
+
+/**
+ * Emit: op dst32, src32 (op is add, or, and, sub, xor or cmp)
+ */
+static void
+vm_jit_emit_alu32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   vm_jit_alu_t alu, /**< instruction */
+                   vm_jit_register_t dst, /**< destination */
+                   vm_jit_register_t src) /**< source */
+{
+  vm_jit_emit_op_reg (compiler_p, ((uint32_t) alu << 3) | 0x1, false, src, dst);
+} /* vm_jit_emit_alu32 */
+
+/**
+ * Emit: op reg, imm (op is add, or, and, sub, xor or cmp)
+ */
+static void
+vm_jit_emit_alu_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     vm_jit_alu_t alu, /**< instruction */
+                     bool is_64bit, /**< 64 bit operand size */
+                     vm_jit_register_t reg, /**< destination */
+                     int32_t value) /**< immediate value */
+{
+  if (value >= INT8_MIN && value <= INT8_MAX)
+  {
+    vm_jit_emit_op_reg (compiler_p, 0x83, is_64bit, alu, reg);
+    vm_jit_emit_byte (compiler_p, (uint32_t) value);
+  }
+  else
+  {
+    vm_jit_emit_op_reg (compiler_p, 0x81, is_64bit, alu, reg);
+    vm_jit_emit_u32 (compiler_p, (uint32_t) value);
+  }
+} /* vm_jit_emit_alu_imm */
+
+/**
+ * Emit: test reg8, imm8
+ */
+static void
+vm_jit_emit_test8_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_register_t reg, /**< register */
+                       uint32_t value) /**< immediate value */
+{
+  if (reg == VM_JIT_RAX)
+  {
+    vm_jit_emit_byte (compiler_p, 0xa8);
+  }
+  else
+  {
+    /* The prefix selects the low byte of rsp, rbp, rsi and rdi. */
+    vm_jit_emit_rex (compiler_p, false, 0, reg, reg >= VM_JIT_RSP);
+    vm_jit_emit_byte (compiler_p, 0xf6);
+    vm_jit_emit_byte (compiler_p, 0xc0 | (reg & 0x7));
+  }
+
+  vm_jit_emit_byte (compiler_p, value);
+} /* vm_jit_emit_test8_imm */
+
+/**
+ * Emit: test reg32, reg32
+ */
+static void
+vm_jit_emit_test32 (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    vm_jit_register_t reg) /**< register */
+{
+  vm_jit_emit_op_reg (compiler_p, 0x85, false, reg, reg);
+} /* vm_jit_emit_test32 */
+
+/**
+ * Emit: shift reg32, imm8
+ */
+static void
+vm_jit_emit_shift_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_shift_t shift, /**< instruction */
+                       vm_jit_register_t reg, /**< register */
+                       uint32_t count) /**< shift count */
+{
+  vm_jit_emit_op_reg (compiler_p, 0xc1, false, shift, reg);
+  vm_jit_emit_byte (compiler_p, count);
+} /* vm_jit_emit_shift_imm */
+
+/**
+ * Emit: shift reg32, cl
+ */
+static void
+vm_jit_emit_shift_cl (vm_jit_compiler_t *compiler_p, /**< compiler */
+                      vm_jit_shift_t shift, /**< instruction */
+                      vm_jit_register_t reg) /**< register */
+{
+  vm_jit_emit_op_reg (compiler_p, 0xd3, false, shift, reg);
+} /* vm_jit_emit_shift_cl */
+
+/**
+ * Emit: call function
+ */
+static void
+vm_jit_emit_call (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  uint64_t address) /**< address of the function */
+{
+  vm_jit_emit_mov64_imm (compiler_p, VM_JIT_RAX, address);
+  /* call rax */
+  vm_jit_emit_byte (compiler_p, 0xff);
+  vm_jit_emit_byte (compiler_p, 0xd0);
+} /* vm_jit_emit_call */
+
+/**
+ * Emit the opcode of a jump with a 32 bit displacement.
+ */
+static void
+vm_jit_emit_jump_opcode (vm_jit_compiler_t *compiler_p, /**< compiler */
+                         vm_jit_condition_t cc) /**< condition */
+{
+  if (cc == VM_JIT_CC_ALWAYS)
+  {
+    vm_jit_emit_byte (compiler_p, 0xe9);
+  }
+  else
+  {
+    vm_jit_emit_byte (compiler_p, 0x0f);
+    vm_jit_emit_byte (compiler_p, 0x80 | cc);
+  }
+} /* vm_jit_emit_jump_opcode */
+
+/**
+ * Emit a jump to a native code offset.
+ */
+static void
+vm_jit_emit_jump_offset (vm_jit_compiler_t *compiler_p, /**< compiler */
+                         vm_jit_condition_t cc, /**< condition */
+                         uint32_t target_offset) /**< target offset */
+{
+  vm_jit_emit_jump_opcode (compiler_p, cc);
+  vm_jit_emit_u32 (compiler_p, target_offset - (compiler_p->offset + 4));
+} /* vm_jit_emit_jump_offset */
+
+/**
+ * Initialize a local label.
+ */
+static void
+vm_jit_init_label (vm_jit_label_t *label_p) /**< label */
+{
+  label_p->offset = VM_JIT_LABEL_UNBOUND;
+  label_p->jump_count = 0;
+} /* vm_jit_init_label */
+
+/**
+ * Emit a jump to a local label.
+ */
+static void
+vm_jit_emit_jump_label (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        vm_jit_condition_t cc, /**< condition */
+                        vm_jit_label_t *label_p) /**< label */
+{
+  if (label_p->offset != VM_JIT_LABEL_UNBOUND)
+  {
+    vm_jit_emit_jump_offset (compiler_p, cc, label_p->offset);
+    return;
+  }
+
+  JERRY_ASSERT (label_p->jump_count < VM_JIT_LABEL_MAX_JUMPS);
+
+  vm_jit_emit_jump_opcode (compiler_p, cc);
+  label_p->jumps[label_p->jump_count++] = compiler_p->offset;
+  vm_jit_emit_u32 (compiler_p, 0);
+} /* vm_jit_emit_jump_label */
+
+/**
+ * Bind a local label to the current offset and resolve the jumps to it.
+ */
+static void
+vm_jit_bind_label (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   vm_jit_label_t *label_p) /**< label */
+{
+  JERRY_ASSERT (label_p->offset == VM_JIT_LABEL_UNBOUND);
+
+  label_p->offset = compiler_p->offset;
+
+  if (compiler_p->buffer_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < label_p->jump_count; i++)
+  {
+    uint32_t displacement = label_p->offset - (label_p->jumps[i] + 4);
+    uint8_t *displacement_p = compiler_p->buffer_p + label_p->jumps[i];
+
+    for (uint32_t j = 0; j < 4; j++)
+    {
+      displacement_p[j] = (uint8_t) (displacement >> (j * 8));
+    }
+  }
+} /* vm_jit_bind_label */
+
+/**
+ * Emit: push a register to the value stack
+ */
+static void
+vm_jit_emit_push (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  vm_jit_register_t reg) /**< register */
+{
+  vm_jit_emit_store32 (compiler_p, VM_JIT_STACK_TOP, 0, reg);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_ADD, true, VM_JIT_STACK_TOP, (int32_t) sizeof (ecma_value_t));
+} /* vm_jit_emit_push */
+
+/**
+ * Emit: push an immediate value to the value stack
+ */
+static void
+vm_jit_emit_push_imm (vm_jit_compiler_t *compiler_p, /**< compiler */
+                      ecma_value_t value) /**< immediate value */
+{
+  vm_jit_emit_store_imm32 (compiler_p, VM_JIT_STACK_TOP, 0, value);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_ADD, true, VM_JIT_STACK_TOP, (int32_t) sizeof (ecma_value_t));
+} /* vm_jit_emit_push_imm */
+
+/**
+ * Emit: pop a value from the value stack into a register
+ */
+static void
+vm_jit_emit_pop (vm_jit_compiler_t *compiler_p, /**< compiler */
+                 vm_jit_register_t reg) /**< register */
+{
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_SUB, true, VM_JIT_STACK_TOP, (int32_t) sizeof (ecma_value_t));
+  vm_jit_emit_load32 (compiler_p, reg, VM_JIT_STACK_TOP, 0);
+} /* vm_jit_emit_pop */
+
+/**
+ * Emit: store the stack top into the frame context
+ */
+static void
+vm_jit_emit_save_stack_top (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_emit_store64 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p), VM_JIT_STACK_TOP);
+} /* vm_jit_emit_save_stack_top */
+
+/**
+ * Emit: load the stack top from the frame context
+ */
+static void
+vm_jit_emit_load_stack_top (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_emit_load64 (compiler_p, VM_JIT_STACK_TOP, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (stack_top_p));
+} /* vm_jit_emit_load_stack_top */
+
+/**
+ * Emit: free a value unless it is a direct value (same as ecma_fast_free_value)
+ */
+static void
+vm_jit_emit_free_value (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        vm_jit_register_t reg) /**< register of the value */
+{
+  vm_jit_label_t done_label;
+  vm_jit_init_label (&done_label);
+
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RDI, reg);
+  vm_jit_emit_test8_imm (compiler_p, VM_JIT_RDI, ECMA_VALUE_TYPE_MASK);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &done_label);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_free_value));
+  vm_jit_bind_label (compiler_p, &done_label);
+} /* vm_jit_emit_free_value */
+
+/**
+ * Emit: copy the value in eax unless it is a direct value (same as ecma_fast_copy_value)
+ */
+static void
+vm_jit_emit_copy_value (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_label_t done_label;
+  vm_jit_init_label (&done_label);
+
+  vm_jit_emit_test8_imm (compiler_p, VM_JIT_RAX, ECMA_VALUE_TYPE_MASK);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &done_label);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RDI, VM_JIT_RAX);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_copy_value));
+  vm_jit_bind_label (compiler_p, &done_label);
+} /* vm_jit_emit_copy_value */
+
+/**
+ * Emit: jump to the error exit if eax is ECMA_VALUE_ERROR
+ */
+static void
+vm_jit_emit_error_check (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_VALUE_ERROR);
+  vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_E, compiler_p->error_offsets[compiler_p->operands]);
+} /* vm_jit_emit_error_check */
+
+/**
+ * Emit: free the owned operands
+ */
+static void
+vm_jit_emit_free_operands (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  if (compiler_p->operands & VM_JIT_OPERAND_RIGHT)
+  {
+    vm_jit_emit_free_value (compiler_p, VM_JIT_RIGHT);
+  }
+
+  if (compiler_p->operands & VM_JIT_OPERAND_LEFT)
+  {
+    vm_jit_emit_free_value (compiler_p, VM_JIT_LEFT);
+  }
+
+  compiler_p->operands = 0;
+} /* vm_jit_emit_free_operands */
+
+/**
+ * Emit: continue the execution in the interpreter from a byte code instruction
+ */
+static void
+vm_jit_emit_exit (vm_jit_compiler_t *compiler_p, /**< compiler */
+                  const uint8_t *byte_code_p) /**< instruction */
+{
+  vm_jit_emit_mov64_imm (compiler_p, VM_JIT_RAX, (uint64_t) (uintptr_t) byte_code_p);
+  vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_ALWAYS, compiler_p->exit_interpreter_offset);
+} /* vm_jit_emit_exit */
+
+/**
+ * Find the index of an instruction.
+ *
+ * @return index of the instruction - if found
+ *         UINT32_MAX - otherwise
+ */
+static uint32_t
+vm_jit_find_entry_index (const vm_jit_entry_t *entries_p, /**< entry points */
+                         uint32_t entry_count, /**< number of entry points */
+                         uint32_t byte_code_offset) /**< offset of the instruction */
+{
+  uint32_t lower = 0;
+  uint32_t upper = entry_count;
+
+  while (lower < upper)
+  {
+    uint32_t middle = (lower + upper) >> 1;
+
+    if (entries_p[middle].byte_code_offset < byte_code_offset)
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  if (lower < entry_count && entries_p[lower].byte_code_offset == byte_code_offset)
+  {
+    return lower;
+  }
+
+  return UINT32_MAX;
+} /* vm_jit_find_entry_index */
+
+/**
+ * Emit a jump to a byte code instruction.
+ */
+static void
+vm_jit_emit_branch (vm_jit_compiler_t *compiler_p, /**< compiler */
+                    vm_jit_condition_t cc, /**< condition */
+                    const uint8_t *target_p) /**< target instruction */
+{
+  uint32_t byte_code_offset = (uint32_t) (target_p - (const uint8_t *) compiler_p->bytecode_header_p);
+  uint32_t index = vm_jit_find_entry_index (compiler_p->entries_p, compiler_p->entry_count, byte_code_offset);
+
+  if (index != UINT32_MAX && !(compiler_p->entries_p[index].native_offset & VM_JIT_ENTRY_INTERPRETED))
+  {
+    vm_jit_emit_jump_offset (compiler_p, cc, compiler_p->entries_p[index].native_offset);
+    return;
+  }
+
+  /* The target is executed by the interpreter. */
+  vm_jit_label_t skip_label;
+  vm_jit_init_label (&skip_label);
+
+  if (cc != VM_JIT_CC_ALWAYS)
+  {
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_INVERT (cc), &skip_label);
+  }
+
+  vm_jit_emit_exit (compiler_p, target_p);
+  vm_jit_bind_label (compiler_p, &skip_label);
+} /* vm_jit_emit_branch */
+
+/**
+ * Emit: load a literal into an operand register
+ */
+static void
+vm_jit_emit_load_literal (vm_jit_compiler_t *compiler_p, /**< compiler */
+                          uint32_t literal_index, /**< literal index */
+                          vm_jit_register_t reg, /**< operand register */
+                          vm_jit_operand_flags_t operand, /**< operand flag */
+                          bool is_borrowed) /**< the value is not freed by the instruction */
+{
+  if (literal_index < compiler_p->register_end)
+  {
+    int32_t displacement = (int32_t) (literal_index * sizeof (ecma_value_t));
+
+    if (is_borrowed)
+    {
+      vm_jit_emit_load32 (compiler_p, reg, VM_JIT_REGISTERS, displacement);
+      return;
+    }
+
+    vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_REGISTERS, displacement);
+    vm_jit_emit_copy_value (compiler_p);
+    vm_jit_emit_mov32 (compiler_p, reg, VM_JIT_RAX);
+    compiler_p->operands |= operand;
+    return;
+  }
+
+  ecma_value_t lit_value = compiler_p->literal_start_p[literal_index];
+
+  if (literal_index < compiler_p->ident_end)
+  {
+    vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+    vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, lit_value);
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_resolve_identifier));
+    vm_jit_emit_error_check (compiler_p);
+  }
+  else if (literal_index < compiler_p->const_literal_end)
+  {
+    if (ecma_is_value_integer_number (lit_value))
+    {
+      compiler_p->integer_operands |= operand;
+
+      if (operand == VM_JIT_OPERAND_RIGHT)
+      {
+        compiler_p->right_constant = lit_value;
+      }
+    }
+    else
+    {
+      compiler_p->other_operands |= operand;
+    }
+
+    if (is_borrowed
+        || ecma_is_value_direct (lit_value)
+        || ecma_is_value_direct_string (lit_value))
+    {
+      vm_jit_emit_mov32_imm (compiler_p, reg, lit_value);
+      return;
+    }
+
+    vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDI, lit_value);
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_copy_value));
+  }
+  else
+  {
+    vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+    vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, lit_value);
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_construct_literal_object));
+  }
+
+  vm_jit_emit_mov32 (compiler_p, reg, VM_JIT_RAX);
+  compiler_p->operands |= operand;
+} /* vm_jit_emit_load_literal */
+
+/**
+ * Emit: jump to the slow path if the operands are not integers
+ */
+static void
+vm_jit_emit_integer_check (vm_jit_compiler_t *compiler_p, /**< compiler */
+                           uint32_t operands, /**< checked operands */
+                           vm_jit_label_t *slow_label_p) /**< label of the slow path */
+{
+  operands &= (uint32_t) ~compiler_p->integer_operands;
+
+  if (operands == (VM_JIT_OPERAND_LEFT | VM_JIT_OPERAND_RIGHT))
+  {
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+    vm_jit_emit_alu32 (compiler_p, VM_JIT_ALU_OR, VM_JIT_RAX, VM_JIT_RIGHT);
+    vm_jit_emit_test8_imm (compiler_p, VM_JIT_RAX, ECMA_DIRECT_TYPE_MASK);
+  }
+  else if (operands != 0)
+  {
+    vm_jit_emit_test8_imm (compiler_p,
+                           (operands == VM_JIT_OPERAND_LEFT) ? VM_JIT_LEFT : VM_JIT_RIGHT,
+                           ECMA_DIRECT_TYPE_MASK);
+  }
+  else
+  {
+    return;
+  }
+
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, slow_label_p);
+} /* vm_jit_emit_integer_check */
+
+/**
+ * Emit: jump to the slow path if eax is not in the range of shifted integer values
+ */
+static void
+vm_jit_emit_integer_range_check (vm_jit_compiler_t *compiler_p, /**< compiler */
+                                 vm_jit_label_t *slow_label_p) /**< label of the slow path */
+{
+#if ECMA_INTEGER_NUMBER_MAX_SHIFTED != 0x7ffffff0
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_INTEGER_NUMBER_MAX_SHIFTED);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_G, slow_label_p);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_INTEGER_NUMBER_MIN_SHIFTED);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_L, slow_label_p);
+#else /* ECMA_INTEGER_NUMBER_MAX_SHIFTED == 0x7ffffff0 */
+  /* The overflow flag has already been checked. */
+  JERRY_UNUSED (compiler_p);
+  JERRY_UNUSED (slow_label_p);
+#endif /* ECMA_INTEGER_NUMBER_MAX_SHIFTED != 0x7ffffff0 */
+} /* vm_jit_emit_integer_range_check */
+
+/**
+ * Emit: load the right operand as an unshifted integer into ecx
+ */
+static void
+vm_jit_emit_load_right_integer (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RCX, VM_JIT_RIGHT);
+  vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RCX, ECMA_DIRECT_SHIFT);
+} /* vm_jit_emit_load_right_integer */
+
+/**
+ * Emit: shift the unshifted integer in eax by the right operand
+ */
+static void
+vm_jit_emit_shift_by_right (vm_jit_compiler_t *compiler_p, /**< compiler */
+                            vm_jit_shift_t shift) /**< instruction */
+{
+  if (compiler_p->integer_operands & VM_JIT_OPERAND_RIGHT)
+  {
+    uint32_t count = (uint32_t) ecma_get_integer_from_value (compiler_p->right_constant) & 0x1f;
+    vm_jit_emit_shift_imm (compiler_p, shift, VM_JIT_RAX, count);
+    return;
+  }
+
+  vm_jit_emit_load_right_integer (compiler_p);
+  vm_jit_emit_shift_cl (compiler_p, shift, VM_JIT_RAX);
+} /* vm_jit_emit_shift_by_right */
+
+/**
+ * Emit: alu eax, right operand
+ */
+static void
+vm_jit_emit_alu_right (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       vm_jit_alu_t alu, /**< instruction */
+                       vm_jit_register_t reg) /**< destination */
+{
+  if (compiler_p->integer_operands & VM_JIT_OPERAND_RIGHT)
+  {
+    vm_jit_emit_alu_imm (compiler_p, alu, false, reg, (int32_t) compiler_p->right_constant);
+    return;
+  }
+
+  vm_jit_emit_alu32 (compiler_p, alu, reg, VM_JIT_RIGHT);
+} /* vm_jit_emit_alu_right */
+
+/**
+ * Emit the integer fast path of an arithmetic operation. The result is stored in eax.
+ *
+ * @return true - if the operation has an integer fast path
+ *         false - otherwise
+ */
+static bool
+vm_jit_emit_integer_arithmetic (vm_jit_compiler_t *compiler_p, /**< compiler */
+                                uint32_t vm_oc, /**< arithmetic operation */
+                                vm_jit_label_t *slow_label_p) /**< label of the slow path */
+{
+  switch (vm_oc)
+  {
+    case VM_OC_ADD:
+    case VM_OC_SUB:
+    case VM_OC_MUL:
+    case VM_OC_MOD:
+    case VM_OC_BIT_OR:
+    case VM_OC_BIT_XOR:
+    case VM_OC_BIT_AND:
+    case VM_OC_LEFT_SHIFT:
+    case VM_OC_RIGHT_SHIFT:
+    case VM_OC_UNS_RIGHT_SHIFT:
+    {
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  if (compiler_p->other_operands != 0)
+  {
+    return false;
+  }
+
+  vm_jit_emit_integer_check (compiler_p, VM_JIT_OPERAND_LEFT | VM_JIT_OPERAND_RIGHT, slow_label_p);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+
+  switch (vm_oc)
+  {
+    case VM_OC_ADD:
+    case VM_OC_SUB:
+    {
+      vm_jit_emit_alu_right (compiler_p, (vm_oc == VM_OC_ADD) ? VM_JIT_ALU_ADD : VM_JIT_ALU_SUB, VM_JIT_RAX);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_O, slow_label_p);
+      vm_jit_emit_integer_range_check (compiler_p, slow_label_p);
+      break;
+    }
+    case VM_OC_MUL:
+    {
+      /* The product of an unshifted and a shifted integer is a shifted integer.
+       * Zero results are computed by the slow path, since they can be negative. */
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_op_reg (compiler_p, 0x0faf, false, VM_JIT_RAX, VM_JIT_RIGHT);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_O, slow_label_p);
+      vm_jit_emit_test32 (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, slow_label_p);
+      vm_jit_emit_integer_range_check (compiler_p, slow_label_p);
+      break;
+    }
+    case VM_OC_MOD:
+    {
+      vm_jit_label_t non_zero_label;
+      vm_jit_init_label (&non_zero_label);
+
+      vm_jit_emit_test32 (compiler_p, VM_JIT_RIGHT);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, slow_label_p);
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_load_right_integer (compiler_p);
+      /* cdq; idiv ecx */
+      vm_jit_emit_byte (compiler_p, 0x99);
+      vm_jit_emit_op_reg (compiler_p, 0xf7, false, 7, VM_JIT_RCX);
+      /* A zero remainder of a negative number is negative zero. */
+      vm_jit_emit_test32 (compiler_p, VM_JIT_RDX);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, &non_zero_label);
+      vm_jit_emit_test32 (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_S, slow_label_p);
+      vm_jit_bind_label (compiler_p, &non_zero_label);
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_RDX);
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SHL, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      break;
+    }
+    case VM_OC_BIT_OR:
+    {
+      vm_jit_emit_alu_right (compiler_p, VM_JIT_ALU_OR, VM_JIT_RAX);
+      break;
+    }
+    case VM_OC_BIT_XOR:
+    {
+      vm_jit_emit_alu_right (compiler_p, VM_JIT_ALU_XOR, VM_JIT_RAX);
+      break;
+    }
+    case VM_OC_BIT_AND:
+    {
+      vm_jit_emit_alu_right (compiler_p, VM_JIT_ALU_AND, VM_JIT_RAX);
+      break;
+    }
+    case VM_OC_LEFT_SHIFT:
+    {
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_shift_by_right (compiler_p, VM_JIT_SHIFT_SHL);
+      vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_INTEGER_NUMBER_MAX);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_G, slow_label_p);
+      vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_INTEGER_NUMBER_MIN);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_L, slow_label_p);
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SHL, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      break;
+    }
+    case VM_OC_RIGHT_SHIFT:
+    {
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_shift_by_right (compiler_p, VM_JIT_SHIFT_SAR);
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SHL, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (vm_oc == VM_OC_UNS_RIGHT_SHIFT);
+
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SAR, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      vm_jit_emit_shift_by_right (compiler_p, VM_JIT_SHIFT_SHR);
+      vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_INTEGER_NUMBER_MAX);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_A, slow_label_p);
+      vm_jit_emit_shift_imm (compiler_p, VM_JIT_SHIFT_SHL, VM_JIT_RAX, ECMA_DIRECT_SHIFT);
+      break;
+    }
+  }
+
+  return true;
+} /* vm_jit_emit_integer_arithmetic */
+
+/**
+ * Emit a binary arithmetic operation. The result is stored in eax.
+ */
+static void
+vm_jit_emit_arithmetic (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        uint32_t vm_oc) /**< arithmetic operation */
+{
+  vm_jit_label_t slow_label;
+  vm_jit_label_t done_label;
+
+  vm_jit_init_label (&slow_label);
+  vm_jit_init_label (&done_label);
+
+  if (vm_jit_emit_integer_arithmetic (compiler_p, vm_oc, &slow_label))
+  {
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &done_label);
+  }
+
+  vm_jit_bind_label (compiler_p, &slow_label);
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDI, vm_oc);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_LEFT);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RDX, VM_JIT_RIGHT);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_binary_operation));
+
+  /* The operands are freed by the helper, and integers need no free. */
+  compiler_p->operands = 0;
+  vm_jit_emit_error_check (compiler_p);
+  vm_jit_bind_label (compiler_p, &done_label);
+} /* vm_jit_emit_arithmetic */
+
+/**
+ * Emit a unary operation. The result is pushed onto the stack.
+ */
+static void
+vm_jit_emit_unary (vm_jit_compiler_t *compiler_p, /**< compiler */
+                   uint32_t vm_oc) /**< unary operation */
+{
+  vm_jit_label_t slow_label;
+  vm_jit_label_t done_label;
+
+  vm_jit_init_label (&slow_label);
+  vm_jit_init_label (&done_label);
+
+  if (vm_oc == VM_OC_NOT)
+  {
+    /* Boolean values differ only in one bit. */
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+    vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_OR, false, VM_JIT_RAX, 1 << ECMA_DIRECT_SHIFT);
+    vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_VALUE_TRUE);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, &slow_label);
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+    vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_XOR, false, VM_JIT_RAX, 1 << ECMA_DIRECT_SHIFT);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &done_label);
+  }
+  else if (vm_oc == VM_OC_BIT_NOT && !(compiler_p->other_operands & VM_JIT_OPERAND_LEFT))
+  {
+    vm_jit_emit_integer_check (compiler_p, VM_JIT_OPERAND_LEFT, &slow_label);
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+    /* not eax */
+    vm_jit_emit_op_reg (compiler_p, 0xf7, false, 2, VM_JIT_RAX);
+    vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_AND, false, VM_JIT_RAX, (int32_t) ~ECMA_DIRECT_TYPE_MASK);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &done_label);
+  }
+
+  vm_jit_bind_label (compiler_p, &slow_label);
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDI, vm_oc);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_LEFT);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_unary_operation));
+
+  /* The operand is freed by the helper, and direct values need no free. */
+  compiler_p->operands = 0;
+  vm_jit_emit_error_check (compiler_p);
+  vm_jit_bind_label (compiler_p, &done_label);
+  vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+} /* vm_jit_emit_unary */
+
+/**
+ * Emit a comparison, which is fused with the next conditional branch if possible.
+ */
+static void
+vm_jit_emit_compare (vm_jit_compiler_t *compiler_p, /**< compiler */
+                     uint32_t vm_oc, /**< comparison */
+                     const vm_jit_instruction_t *next_instr_p) /**< next instruction (NULL if not available) */
+{
+  vm_jit_condition_t cc;
+  vm_jit_label_t true_label;
+  vm_jit_label_t false_label;
+  vm_jit_label_t slow_label;
+  vm_jit_label_t done_label;
+
+  vm_jit_init_label (&true_label);
+  vm_jit_init_label (&false_label);
+  vm_jit_init_label (&slow_label);
+  vm_jit_init_label (&done_label);
+
+  switch (vm_oc)
+  {
+    case VM_OC_EQUAL:
+    case VM_OC_STRICT_EQUAL:
+    {
+      cc = VM_JIT_CC_E;
+      break;
+    }
+    case VM_OC_NOT_EQUAL:
+    case VM_OC_STRICT_NOT_EQUAL:
+    {
+      cc = VM_JIT_CC_NE;
+      break;
+    }
+    case VM_OC_LESS:
+    {
+      cc = VM_JIT_CC_L;
+      break;
+    }
+    case VM_OC_GREATER:
+    {
+      cc = VM_JIT_CC_G;
+      break;
+    }
+    case VM_OC_LESS_EQUAL:
+    {
+      cc = VM_JIT_CC_LE;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (vm_oc == VM_OC_GREATER_EQUAL);
+      cc = VM_JIT_CC_GE;
+      break;
+    }
+  }
+
+  bool is_fused_branch = false;
+  bool is_branch_if_true = false;
+
+  if (next_instr_p != NULL)
+  {
+    uint32_t branch_group = VM_OC_GROUP_GET_INDEX (next_instr_p->opcode_data);
+
+    is_fused_branch = (branch_group == VM_OC_BRANCH_IF_TRUE || branch_group == VM_OC_BRANCH_IF_FALSE);
+    is_branch_if_true = (branch_group == VM_OC_BRANCH_IF_TRUE);
+
+#if defined (JERRY_VM_EXEC_STOP) || defined (JERRY_QUOTAS)
+    /* Backward branches must perform their checks. */
+    if (next_instr_p->opcode_data & VM_OC_BACKWARD_BRANCH)
+    {
+      is_fused_branch = false;
+    }
+#endif /* JERRY_VM_EXEC_STOP || JERRY_QUOTAS */
+  }
+
+  if (compiler_p->other_operands == 0)
+  {
+    vm_jit_emit_integer_check (compiler_p, VM_JIT_OPERAND_LEFT | VM_JIT_OPERAND_RIGHT, &slow_label);
+    vm_jit_emit_alu_right (compiler_p, VM_JIT_ALU_CMP, VM_JIT_LEFT);
+    vm_jit_emit_jump_label (compiler_p, cc, &true_label);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &false_label);
+  }
+
+  vm_jit_bind_label (compiler_p, &slow_label);
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDI, vm_oc);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_LEFT);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RDX, VM_JIT_RIGHT);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_compare));
+
+  /* The operands are freed by the helper, and integers need no free. */
+  compiler_p->operands = 0;
+  vm_jit_emit_error_check (compiler_p);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RAX, ECMA_VALUE_TRUE);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &true_label);
+
+  vm_jit_bind_label (compiler_p, &false_label);
+
+  if (is_fused_branch)
+  {
+    vm_jit_emit_branch (compiler_p,
+                        VM_JIT_CC_ALWAYS,
+                        is_branch_if_true ? next_instr_p->next_p : next_instr_p->branch_target_p);
+  }
+  else
+  {
+    vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_FALSE);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &done_label);
+  }
+
+  vm_jit_bind_label (compiler_p, &true_label);
+
+  if (is_fused_branch)
+  {
+    vm_jit_emit_branch (compiler_p,
+                        VM_JIT_CC_ALWAYS,
+                        is_branch_if_true ? next_instr_p->branch_target_p : next_instr_p->next_p);
+  }
+  else
+  {
+    vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_TRUE);
+  }
+
+  vm_jit_bind_label (compiler_p, &done_label);
+} /* vm_jit_emit_compare */
+
+/**
+ * Emit a conditional branch.
+ */
+static void
+vm_jit_emit_conditional_branch (vm_jit_compiler_t *compiler_p, /**< compiler */
+                                const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (instr_p->opcode_data) - VM_OC_BRANCH_IF_TRUE;
+  bool is_branch_if_true = !(opcode_flags & VM_OC_BRANCH_IF_FALSE_FLAG);
+  vm_jit_label_t true_label;
+  vm_jit_label_t false_label;
+  vm_jit_label_t slow_label;
+  vm_jit_label_t next_label;
+
+  vm_jit_init_label (&true_label);
+  vm_jit_init_label (&false_label);
+  vm_jit_init_label (&slow_label);
+  vm_jit_init_label (&next_label);
+
+  if (opcode_flags & VM_OC_LOGICAL_BRANCH_FLAG)
+  {
+    /* The value is kept on the stack if the branch is taken. */
+    vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_op_to_boolean));
+    /* test al, al */
+    vm_jit_emit_byte (compiler_p, 0x84);
+    vm_jit_emit_byte (compiler_p, 0xc0);
+    vm_jit_emit_jump_label (compiler_p, is_branch_if_true ? VM_JIT_CC_E : VM_JIT_CC_NE, &next_label);
+    vm_jit_emit_branch (compiler_p, VM_JIT_CC_ALWAYS, instr_p->branch_target_p);
+    vm_jit_bind_label (compiler_p, &next_label);
+    vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+    vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+    return;
+  }
+
+  vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RDI, ECMA_VALUE_TRUE);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &true_label);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_CMP, false, VM_JIT_RDI, ECMA_VALUE_FALSE);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &false_label);
+  vm_jit_emit_test8_imm (compiler_p, VM_JIT_RDI, ECMA_DIRECT_TYPE_MASK);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, &slow_label);
+  vm_jit_emit_test32 (compiler_p, VM_JIT_RDI);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, &true_label);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &false_label);
+
+  vm_jit_bind_label (compiler_p, &slow_label);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_LEFT, VM_JIT_RDI);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_op_to_boolean));
+  vm_jit_emit_store32 (compiler_p, VM_JIT_RSP, 0, VM_JIT_RAX);
+  vm_jit_emit_free_value (compiler_p, VM_JIT_LEFT);
+  vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_RSP, 0);
+  /* test al, al */
+  vm_jit_emit_byte (compiler_p, 0x84);
+  vm_jit_emit_byte (compiler_p, 0xc0);
+  vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_NE, &true_label);
+
+  vm_jit_bind_label (compiler_p, &false_label);
+
+  if (is_branch_if_true)
+  {
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &next_label);
+  }
+  else
+  {
+    vm_jit_emit_branch (compiler_p, VM_JIT_CC_ALWAYS, instr_p->branch_target_p);
+  }
+
+  vm_jit_bind_label (compiler_p, &true_label);
+
+  if (is_branch_if_true)
+  {
+    vm_jit_emit_branch (compiler_p, VM_JIT_CC_ALWAYS, instr_p->branch_target_p);
+  }
+
+  vm_jit_bind_label (compiler_p, &next_label);
+} /* vm_jit_emit_conditional_branch */
+
+/**
+ * Emit: store the result in eax to its destination
+ */
+static void
+vm_jit_emit_put_result (vm_jit_compiler_t *compiler_p, /**< compiler */
+                        uint32_t opcode_data, /**< opcode data */
+                        uint32_t literal_index) /**< literal index of VM_OC_PUT_IDENT */
+{
+  JERRY_ASSERT (VM_OC_HAS_PUT_RESULT (opcode_data));
+
+  if ((opcode_data & VM_OC_PUT_IDENT) && literal_index < compiler_p->register_end)
+  {
+    int32_t displacement = (int32_t) (literal_index * sizeof (ecma_value_t));
+
+    vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_REGISTERS, displacement);
+    vm_jit_emit_store32 (compiler_p, VM_JIT_REGISTERS, displacement, VM_JIT_RAX);
+
+    if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+    {
+      vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+      return;
+    }
+
+    vm_jit_emit_store32 (compiler_p, VM_JIT_RSP, 0, VM_JIT_RAX);
+    vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+    vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_RSP, 0);
+    vm_jit_emit_copy_value (compiler_p);
+  }
+  else if (opcode_data & (VM_OC_PUT_IDENT | VM_OC_PUT_REFERENCE))
+  {
+    uint32_t put_data = (opcode_data & (VM_OC_PUT_RESULT_MASK << VM_OC_PUT_RESULT_SHIFT)) | (literal_index << 16);
+
+    vm_jit_emit_save_stack_top (compiler_p);
+    vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_RAX);
+    vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDX, put_data);
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_put_result));
+    vm_jit_emit_load_stack_top (compiler_p);
+    vm_jit_emit_error_check (compiler_p);
+    return;
+  }
+
+  if (opcode_data & VM_OC_PUT_STACK)
+  {
+    vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+  }
+  else if (opcode_data & VM_OC_PUT_BLOCK)
+  {
+    vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result));
+    vm_jit_emit_store32 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result), VM_JIT_RAX);
+    vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+  }
+} /* vm_jit_emit_put_result */
+
+/**
+ * Emit the increment and decrement operators of identifiers. The result is stored in eax.
+ */
+static void
+vm_jit_emit_incr_decr (vm_jit_compiler_t *compiler_p, /**< compiler */
+                       uint32_t opcode_data) /**< opcode data */
+{
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+  vm_jit_label_t slow_label;
+  vm_jit_label_t done_label;
+
+  vm_jit_init_label (&slow_label);
+  vm_jit_init_label (&done_label);
+
+  JERRY_ASSERT (opcode_flags & VM_OC_IDENT_INCR_DECR_OPERATOR_FLAG);
+
+  if (compiler_p->other_operands == 0)
+  {
+    int32_t increase = (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG) ? -(1 << ECMA_DIRECT_SHIFT)
+                                                                       : (1 << ECMA_DIRECT_SHIFT);
+
+    vm_jit_emit_integer_check (compiler_p, VM_JIT_OPERAND_LEFT, &slow_label);
+    vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+    vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_ADD, false, VM_JIT_RAX, increase);
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_O, &slow_label);
+    vm_jit_emit_integer_range_check (compiler_p, &slow_label);
+
+    /* Postfix operators require the unmodifed number value. */
+    if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+    {
+      if (opcode_data & VM_OC_PUT_STACK)
+      {
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      }
+      else if (opcode_data & VM_OC_PUT_BLOCK)
+      {
+        vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result));
+        vm_jit_emit_store32 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result), VM_JIT_LEFT);
+        vm_jit_emit_store32 (compiler_p, VM_JIT_RSP, 0, VM_JIT_RAX);
+        vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+        vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_RSP, 0);
+      }
+    }
+
+    vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_ALWAYS, &done_label);
+  }
+
+  vm_jit_bind_label (compiler_p, &slow_label);
+  vm_jit_emit_save_stack_top (compiler_p);
+  vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+  vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_LEFT);
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDX, opcode_data);
+  vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_incr_decr));
+  vm_jit_emit_load_stack_top (compiler_p);
+
+  /* The operand is freed by the helper, and integers need no free. */
+  compiler_p->operands = 0;
+  vm_jit_emit_error_check (compiler_p);
+  vm_jit_bind_label (compiler_p, &done_label);
+} /* vm_jit_emit_incr_decr */
+
+/**
+ * Emit a call or construct operation.
+ */
+static void
+vm_jit_emit_call_operation (vm_jit_compiler_t *compiler_p, /**< compiler */
+                            const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  uint32_t opcode_data = instr_p->opcode_data;
+  bool is_call = (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_CALL);
+
+  /* The call handlers read the instruction from the frame context. */
+  vm_jit_emit_mov64_imm (compiler_p, VM_JIT_RAX, (uint64_t) (uintptr_t) instr_p->byte_code_p);
+  vm_jit_emit_store64 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (byte_code_p), VM_JIT_RAX);
+  vm_jit_emit_save_stack_top (compiler_p);
+  vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+  vm_jit_emit_call (compiler_p, is_call ? VM_JIT_FUNCTION_ADDRESS (vm_jit_call)
+                                        : VM_JIT_FUNCTION_ADDRESS (vm_jit_construct));
+  vm_jit_emit_load_stack_top (compiler_p);
+  vm_jit_emit_error_check (compiler_p);
+
+  if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+  {
+    vm_jit_emit_free_value (compiler_p, VM_JIT_RAX);
+    return;
+  }
+
+  vm_jit_emit_put_result (compiler_p, opcode_data, 0);
+} /* vm_jit_emit_call_operation */
+
+/**
+ * Emit the native code of an instruction.
+ */
+static void
+vm_jit_emit_instruction (vm_jit_compiler_t *compiler_p, /**< compiler */
+                         const vm_jit_instruction_t *instr_p, /**< instruction */
+                         const vm_jit_instruction_t *next_instr_p) /**< next instruction
+                                                                     *   (NULL if not available) */
+{
+  uint32_t opcode_data = instr_p->opcode_data;
+  uint32_t group = VM_OC_GROUP_GET_INDEX (opcode_data);
+  uint32_t operands = VM_OC_GET_ARGS_INDEX (opcode_data);
+  uint32_t literal_count = 0;
+  bool is_borrowed = (group == VM_OC_PROP_GET);
+
+  compiler_p->operands = 0;
+  compiler_p->integer_operands = 0;
+  compiler_p->other_operands = 0;
+
+#if defined (JERRY_VM_EXEC_STOP) || defined (JERRY_QUOTAS)
+  if (opcode_data & VM_OC_BACKWARD_BRANCH)
+  {
+    vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_check_backward_branch));
+    vm_jit_emit_error_check (compiler_p);
+  }
+#endif /* JERRY_VM_EXEC_STOP || JERRY_QUOTAS */
+
+  if (group >= VM_OC_PROP_PRE_INCR && group <= VM_OC_PROP_POST_DECR)
+  {
+    /* The helper reads the reference from the stack. */
+    operands = VM_OC_GET_NONE;
+  }
+
+  switch (operands)
+  {
+    case VM_OC_GET_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_LEFT, VM_JIT_OPERAND_LEFT, is_borrowed);
+      literal_count = 1;
+      break;
+    }
+    case VM_OC_GET_LITERAL_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_LEFT, VM_JIT_OPERAND_LEFT, is_borrowed);
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[1], VM_JIT_RIGHT, VM_JIT_OPERAND_RIGHT, is_borrowed);
+      literal_count = 2;
+      break;
+    }
+    case VM_OC_GET_STACK_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_RIGHT, VM_JIT_OPERAND_RIGHT, is_borrowed);
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->operands |= VM_JIT_OPERAND_LEFT;
+      literal_count = 1;
+      break;
+    }
+    case VM_OC_GET_THIS_LITERAL:
+    {
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[0], VM_JIT_RIGHT, VM_JIT_OPERAND_RIGHT, is_borrowed);
+
+      if (is_borrowed)
+      {
+        vm_jit_emit_load32 (compiler_p, VM_JIT_LEFT, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (this_binding));
+      }
+      else
+      {
+        vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (this_binding));
+        vm_jit_emit_copy_value (compiler_p);
+        vm_jit_emit_mov32 (compiler_p, VM_JIT_LEFT, VM_JIT_RAX);
+        compiler_p->operands |= VM_JIT_OPERAND_LEFT;
+      }
+      literal_count = 1;
+      break;
+    }
+    case VM_OC_GET_STACK:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->operands |= VM_JIT_OPERAND_LEFT;
+      break;
+    }
+    case VM_OC_GET_STACK_STACK:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_RIGHT);
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      compiler_p->operands |= VM_JIT_OPERAND_LEFT | VM_JIT_OPERAND_RIGHT;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (operands == VM_OC_GET_NONE || operands == VM_OC_GET_BRANCH);
+      break;
+    }
+  }
+
+  uint32_t put_literal_index = instr_p->literals[literal_count];
+
+  switch (group)
+  {
+    case VM_OC_NONE:
+    {
+      JERRY_ASSERT (instr_p->opcode == (CBC_END + 1) + CBC_EXT_DEBUGGER);
+      return;
+    }
+    case VM_OC_POP:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+      return;
+    }
+    case VM_OC_POP_BLOCK:
+    {
+      vm_jit_emit_pop (compiler_p, VM_JIT_RAX);
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result));
+      vm_jit_emit_store32 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result), VM_JIT_RAX);
+      vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+      return;
+    }
+    case VM_OC_PUSH:
+    {
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      return;
+    }
+    case VM_OC_PUSH_TWO:
+    {
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+      return;
+    }
+    case VM_OC_PUSH_THREE:
+    {
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      compiler_p->operands &= (uint32_t) ~VM_JIT_OPERAND_LEFT;
+      vm_jit_emit_load_literal (compiler_p, instr_p->literals[2], VM_JIT_LEFT, VM_JIT_OPERAND_LEFT, false);
+      vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      return;
+    }
+    case VM_OC_PUSH_UNDEFINED:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_UNDEFINED);
+      return;
+    }
+    case VM_OC_PUSH_TRUE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_TRUE);
+      return;
+    }
+    case VM_OC_PUSH_FALSE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_FALSE);
+      return;
+    }
+    case VM_OC_PUSH_NULL:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_NULL);
+      return;
+    }
+    case VM_OC_PUSH_THIS:
+    {
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (this_binding));
+      vm_jit_emit_copy_value (compiler_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return;
+    }
+    case VM_OC_PUSH_0:
+    {
+      vm_jit_emit_push_imm (compiler_p, ecma_make_integer_value (0));
+      return;
+    }
+    case VM_OC_PUSH_POS_BYTE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ecma_make_integer_value (instr_p->byte_arg + 1));
+      return;
+    }
+    case VM_OC_PUSH_NEG_BYTE:
+    {
+      vm_jit_emit_push_imm (compiler_p, ecma_make_integer_value (-(instr_p->byte_arg + 1)));
+      return;
+    }
+    case VM_OC_PUSH_LIT_0:
+    case VM_OC_PUSH_LIT_POS_BYTE:
+    case VM_OC_PUSH_LIT_NEG_BYTE:
+    {
+      ecma_integer_value_t number = 0;
+
+      if (group == VM_OC_PUSH_LIT_POS_BYTE)
+      {
+        number = instr_p->byte_arg + 1;
+      }
+      else if (group == VM_OC_PUSH_LIT_NEG_BYTE)
+      {
+        number = -(instr_p->byte_arg + 1);
+      }
+
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_push_imm (compiler_p, ecma_make_integer_value (number));
+      return;
+    }
+    case VM_OC_PUSH_OBJECT:
+    {
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_create_object));
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return;
+    }
+    case VM_OC_SET_PROPERTY:
+    {
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RDI, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_RIGHT);
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RDX, VM_JIT_LEFT);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_set_property));
+      vm_jit_emit_error_check (compiler_p);
+      vm_jit_emit_free_operands (compiler_p);
+      return;
+    }
+    case VM_OC_PUSH_UNDEFINED_BASE:
+    {
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      vm_jit_emit_store32 (compiler_p, VM_JIT_STACK_TOP, 0, VM_JIT_RAX);
+      vm_jit_emit_store_imm32 (compiler_p,
+                               VM_JIT_STACK_TOP,
+                               -(int32_t) sizeof (ecma_value_t),
+                               ECMA_VALUE_UNDEFINED);
+      vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_ADD, true, VM_JIT_STACK_TOP, (int32_t) sizeof (ecma_value_t));
+      return;
+    }
+    case VM_OC_PUSH_ARRAY:
+    {
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDI, 0);
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, 0);
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RDX, 0);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_op_create_array_object));
+      vm_jit_emit_error_check (compiler_p);
+      vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+      return;
+    }
+    case VM_OC_PUSH_ELISON:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_ARRAY_HOLE);
+      return;
+    }
+    case VM_OC_APPEND_ARRAY:
+    {
+      vm_jit_emit_alu_imm (compiler_p,
+                           VM_JIT_ALU_SUB,
+                           true,
+                           VM_JIT_STACK_TOP,
+                           (int32_t) (instr_p->byte_arg * sizeof (ecma_value_t)));
+      vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_STACK_TOP);
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, instr_p->byte_arg);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_append_array));
+      return;
+    }
+    case VM_OC_IDENT_REFERENCE:
+    {
+      uint32_t literal_index = instr_p->literals[0];
+
+      if (literal_index < compiler_p->register_end)
+      {
+        vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_REGISTER_REF);
+        vm_jit_emit_push_imm (compiler_p, literal_index);
+        vm_jit_emit_load32 (compiler_p,
+                            VM_JIT_RAX,
+                            VM_JIT_REGISTERS,
+                            (int32_t) (literal_index * sizeof (ecma_value_t)));
+        vm_jit_emit_copy_value (compiler_p);
+        vm_jit_emit_push (compiler_p, VM_JIT_RAX);
+        return;
+      }
+
+      vm_jit_emit_save_stack_top (compiler_p);
+      vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, compiler_p->literal_start_p[literal_index]);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_ident_reference));
+      vm_jit_emit_load_stack_top (compiler_p);
+      vm_jit_emit_error_check (compiler_p);
+      return;
+    }
+    case VM_OC_PROP_REFERENCE:
+    {
+      /* Forms with reference requires preserving the base and offset. */
+      if (instr_p->opcode == CBC_PUSH_PROP_REFERENCE)
+      {
+        vm_jit_emit_load32 (compiler_p, VM_JIT_LEFT, VM_JIT_STACK_TOP, -2 * (int32_t) sizeof (ecma_value_t));
+        vm_jit_emit_load32 (compiler_p, VM_JIT_RIGHT, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      }
+      else if (instr_p->opcode == CBC_PUSH_PROP_LITERAL_REFERENCE)
+      {
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+        vm_jit_emit_mov32 (compiler_p, VM_JIT_RIGHT, VM_JIT_LEFT);
+        vm_jit_emit_load32 (compiler_p, VM_JIT_LEFT, VM_JIT_STACK_TOP, -2 * (int32_t) sizeof (ecma_value_t));
+      }
+      else
+      {
+        JERRY_ASSERT (instr_p->opcode == CBC_PUSH_PROP_LITERAL_LITERAL_REFERENCE
+                      || instr_p->opcode == CBC_PUSH_PROP_THIS_LITERAL_REFERENCE);
+
+        vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+        vm_jit_emit_push (compiler_p, VM_JIT_RIGHT);
+      }
+
+      /* The operands are owned by the stack. */
+      compiler_p->operands = 0;
+      /* FALLTHRU */
+    }
+    case VM_OC_PROP_GET:
+    {
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RSI, VM_JIT_RIGHT);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_get_value));
+      vm_jit_emit_error_check (compiler_p);
+      break;
+    }
+    case VM_OC_PROP_PRE_INCR:
+    case VM_OC_PROP_PRE_DECR:
+    case VM_OC_PROP_POST_INCR:
+    case VM_OC_PROP_POST_DECR:
+    {
+      vm_jit_emit_save_stack_top (compiler_p);
+      vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RSI, opcode_data);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_prop_incr_decr));
+      vm_jit_emit_load_stack_top (compiler_p);
+      vm_jit_emit_error_check (compiler_p);
+      return;
+    }
+    case VM_OC_PRE_INCR:
+    case VM_OC_PRE_DECR:
+    case VM_OC_POST_INCR:
+    case VM_OC_POST_DECR:
+    {
+      vm_jit_emit_incr_decr (compiler_p, opcode_data);
+
+      if ((group - VM_OC_PROP_PRE_INCR) & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+      {
+        opcode_data &= (uint32_t) ~(VM_OC_PUT_STACK | VM_OC_PUT_BLOCK);
+      }
+
+      /* The result is assigned to the operand. */
+      put_literal_index = instr_p->literals[0];
+      break;
+    }
+    case VM_OC_ASSIGN:
+    {
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+      compiler_p->operands &= (uint32_t) ~VM_JIT_OPERAND_LEFT;
+      break;
+    }
+    case VM_OC_ASSIGN_PROP:
+    {
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      vm_jit_emit_store32 (compiler_p, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t), VM_JIT_LEFT);
+      compiler_p->operands &= (uint32_t) ~VM_JIT_OPERAND_LEFT;
+      break;
+    }
+    case VM_OC_ASSIGN_PROP_THIS:
+    {
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (this_binding));
+      vm_jit_emit_copy_value (compiler_p);
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RCX, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      vm_jit_emit_store32 (compiler_p, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t), VM_JIT_RAX);
+      vm_jit_emit_push (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_RCX);
+      compiler_p->operands &= (uint32_t) ~VM_JIT_OPERAND_LEFT;
+      break;
+    }
+    case VM_OC_RET:
+    {
+      if (instr_p->opcode == CBC_RETURN_WITH_BLOCK)
+      {
+        vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (call_block_result));
+        vm_jit_emit_store_imm32 (compiler_p,
+                                 VM_JIT_FRAME,
+                                 VM_JIT_FRAME_OFFSET (call_block_result),
+                                 ECMA_VALUE_UNDEFINED);
+      }
+      else
+      {
+        vm_jit_emit_mov32 (compiler_p, VM_JIT_RAX, VM_JIT_LEFT);
+      }
+
+      vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_ALWAYS, compiler_p->exit_value_offset);
+      return;
+    }
+    case VM_OC_THROW:
+    {
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_throw));
+      vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_ALWAYS, compiler_p->error_offsets[0]);
+      return;
+    }
+    case VM_OC_EVAL:
+    {
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_set_direct_eval));
+      return;
+    }
+    case VM_OC_CALL:
+    case VM_OC_NEW:
+    {
+      vm_jit_emit_call_operation (compiler_p, instr_p);
+      return;
+    }
+    case VM_OC_JUMP:
+    {
+      vm_jit_emit_branch (compiler_p, VM_JIT_CC_ALWAYS, instr_p->branch_target_p);
+      return;
+    }
+    case VM_OC_BRANCH_IF_STRICT_EQUAL:
+    {
+      vm_jit_label_t next_label;
+      vm_jit_init_label (&next_label);
+
+      vm_jit_emit_pop (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_mov32 (compiler_p, VM_JIT_RDI, VM_JIT_LEFT);
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RSI, VM_JIT_STACK_TOP, -(int32_t) sizeof (ecma_value_t));
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (ecma_op_strict_equality_compare));
+      vm_jit_emit_store32 (compiler_p, VM_JIT_RSP, 0, VM_JIT_RAX);
+      vm_jit_emit_free_value (compiler_p, VM_JIT_LEFT);
+      vm_jit_emit_load32 (compiler_p, VM_JIT_RAX, VM_JIT_RSP, 0);
+      /* test al, al */
+      vm_jit_emit_byte (compiler_p, 0x84);
+      vm_jit_emit_byte (compiler_p, 0xc0);
+      vm_jit_emit_jump_label (compiler_p, VM_JIT_CC_E, &next_label);
+      vm_jit_emit_pop (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_free_value (compiler_p, VM_JIT_RDI);
+      vm_jit_emit_branch (compiler_p, VM_JIT_CC_ALWAYS, instr_p->branch_target_p);
+      vm_jit_bind_label (compiler_p, &next_label);
+      return;
+    }
+    case VM_OC_BRANCH_IF_TRUE:
+    case VM_OC_BRANCH_IF_FALSE:
+    case VM_OC_BRANCH_IF_LOGICAL_TRUE:
+    case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+    {
+      vm_jit_emit_conditional_branch (compiler_p, instr_p);
+      return;
+    }
+    case VM_OC_PLUS:
+    case VM_OC_MINUS:
+    case VM_OC_NOT:
+    case VM_OC_BIT_NOT:
+    case VM_OC_TYPEOF:
+    {
+      vm_jit_emit_unary (compiler_p, group);
+      return;
+    }
+    case VM_OC_VOID:
+    {
+      vm_jit_emit_push_imm (compiler_p, ECMA_VALUE_UNDEFINED);
+      vm_jit_emit_free_operands (compiler_p);
+      return;
+    }
+    case VM_OC_ADD:
+    case VM_OC_SUB:
+    case VM_OC_MUL:
+    case VM_OC_DIV:
+    case VM_OC_MOD:
+    case VM_OC_IN:
+    case VM_OC_INSTANCEOF:
+    case VM_OC_BIT_OR:
+    case VM_OC_BIT_XOR:
+    case VM_OC_BIT_AND:
+    case VM_OC_LEFT_SHIFT:
+    case VM_OC_RIGHT_SHIFT:
+    case VM_OC_UNS_RIGHT_SHIFT:
+    {
+      vm_jit_emit_arithmetic (compiler_p, group);
+      break;
+    }
+    case VM_OC_EQUAL:
+    case VM_OC_NOT_EQUAL:
+    case VM_OC_STRICT_EQUAL:
+    case VM_OC_STRICT_NOT_EQUAL:
+    case VM_OC_LESS:
+    case VM_OC_GREATER:
+    case VM_OC_LESS_EQUAL:
+    case VM_OC_GREATER_EQUAL:
+    {
+      vm_jit_emit_compare (compiler_p, group, next_instr_p);
+      return;
+    }
+#ifdef JERRY_ENABLE_LINE_INFO
+    case VM_OC_RESOURCE_NAME:
+    {
+      vm_jit_emit_mov64 (compiler_p, VM_JIT_RDI, VM_JIT_FRAME);
+      vm_jit_emit_call (compiler_p, VM_JIT_FUNCTION_ADDRESS (vm_jit_set_resource_name));
+      return;
+    }
+    case VM_OC_LINE:
+    {
+      vm_jit_emit_store_imm32 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (current_line), instr_p->line);
+      return;
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+    default:
+    {
+      JERRY_UNREACHABLE ();
+      return;
+    }
+  }
+
+  vm_jit_emit_put_result (compiler_p, opcode_data, put_literal_index);
+  vm_jit_emit_free_operands (compiler_p);
+} /* vm_jit_emit_instruction */
+
+/**
+ * Decode a byte code instruction.
+ *
+ * @return true - if the instruction is valid
+ *         false - otherwise
+ */
+static bool
+vm_jit_decode_instruction (const vm_jit_compiler_t *compiler_p, /**< compiler */
+                           const uint8_t *byte_code_p, /**< instruction */
+                           vm_jit_instruction_t *instr_p) /**< [out] decoded instruction */
+{
+  uint32_t opcode = *byte_code_p++;
+  uint8_t flags;
+
+  instr_p->byte_code_p = byte_code_p - 1;
+  instr_p->branch_target_p = NULL;
+  instr_p->line = 0;
+  instr_p->literals[0] = 0;
+  instr_p->literals[1] = 0;
+  instr_p->literals[2] = 0;
+  instr_p->literal_count = 0;
+  instr_p->byte_arg = 0;
+
+  if (opcode == CBC_EXT_OPCODE)
+  {
+    opcode = *byte_code_p++;
+
+    if (opcode >= CBC_EXT_END)
+    {
+      return false;
+    }
+
+    flags = cbc_ext_flags[opcode];
+    instr_p->opcode = (CBC_END + 1) + opcode;
+  }
+  else
+  {
+    if (opcode >= CBC_END)
+    {
+      return false;
+    }
+
+    flags = cbc_flags[opcode];
+    instr_p->opcode = opcode;
+  }
+
+  instr_p->opcode_data = vm_decode_table[instr_p->opcode];
+
+  if (flags & CBC_HAS_BRANCH_ARG)
+  {
+    uint32_t branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+    uint32_t branch_offset = 0;
+
+    while (branch_offset_length > 0)
+    {
+      branch_offset = (branch_offset << 8) | *byte_code_p++;
+      branch_offset_length--;
+    }
+
+    if (CBC_BRANCH_IS_FORWARD (flags))
+    {
+      instr_p->branch_target_p = instr_p->byte_code_p + branch_offset;
+    }
+    else
+    {
+      instr_p->branch_target_p = instr_p->byte_code_p - branch_offset;
+    }
+  }
+
+  uint32_t literal_count = 0;
+
+  if (flags & CBC_HAS_LITERAL_ARG)
+  {
+    literal_count++;
+  }
+
+  if (flags & CBC_HAS_LITERAL_ARG2)
+  {
+    literal_count++;
+  }
+
+  if (instr_p->opcode == CBC_PUSH_THREE_LITERALS)
+  {
+    literal_count = 3;
+  }
+
+  while (instr_p->literal_count < literal_count)
+  {
+    uint32_t literal_index = *byte_code_p++;
+
+    if (literal_index >= compiler_p->encoding_limit)
+    {
+      literal_index = ((literal_index << 8) | *byte_code_p++) - compiler_p->encoding_delta;
+    }
+
+    instr_p->literals[instr_p->literal_count++] = (uint16_t) literal_index;
+  }
+
+  if (flags & CBC_HAS_BYTE_ARG)
+  {
+    instr_p->byte_arg = *byte_code_p++;
+  }
+
+  if (instr_p->opcode == (CBC_END + 1) + CBC_EXT_LINE)
+  {
+    uint8_t byte;
+
+    do
+    {
+      byte = *byte_code_p++;
+      instr_p->line = (instr_p->line << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
+    }
+    while (byte & CBC_HIGHEST_BIT_MASK);
+  }
+
+  instr_p->next_p = byte_code_p;
+  return true;
+} /* vm_jit_decode_instruction */
+
+/**
+ * Checks whether an instruction is compiled to native code.
+ *
+ * @return true - if the instruction is compiled
+ *         false - if it is executed by the interpreter
+ */
+static bool
+vm_jit_is_compiled (const vm_jit_instruction_t *instr_p) /**< instruction */
+{
+  switch (VM_OC_GROUP_GET_INDEX (instr_p->opcode_data))
+  {
+    case VM_OC_SET_GETTER:
+    case VM_OC_SET_SETTER:
+    case VM_OC_PROP_DELETE:
+    case VM_OC_DELETE:
+    case VM_OC_TYPEOF_IDENT:
+    case VM_OC_THROW_REFERENCE_ERROR:
+    case VM_OC_WITH:
+    case VM_OC_FOR_IN_CREATE_CONTEXT:
+    case VM_OC_FOR_IN_GET_NEXT:
+    case VM_OC_FOR_IN_HAS_NEXT:
+    case VM_OC_TRY:
+    case VM_OC_CATCH:
+    case VM_OC_FINALLY:
+    case VM_OC_CONTEXT_END:
+    case VM_OC_JUMP_AND_EXIT_CONTEXT:
+    case VM_OC_BREAKPOINT_ENABLED:
+    case VM_OC_BREAKPOINT_DISABLED:
+    {
+      return false;
+    }
+    default:
+    {
+      return true;
+    }
+  }
+} /* vm_jit_is_compiled */
+
+/**
+ * Find the instructions of the function body.
+ *
+ * @return number of instructions - if the function can be compiled
+ *         0 - otherwise
+ */
+static uint32_t
+vm_jit_scan_instructions (const vm_jit_compiler_t *compiler_p, /**< compiler */
+                          const uint8_t *byte_code_end_p) /**< end of the byte code data */
+{
+  const uint8_t *byte_code_p = compiler_p->body_start_p;
+  const uint8_t *last_target_p = byte_code_p;
+  uint32_t count = 0;
+
+  while (true)
+  {
+    vm_jit_instruction_t instr;
+
+    if (byte_code_p >= byte_code_end_p
+        || !vm_jit_decode_instruction (compiler_p, byte_code_p, &instr)
+        || instr.next_p > byte_code_end_p)
+    {
+      return 0;
+    }
+
+    uint32_t group = VM_OC_GROUP_GET_INDEX (instr.opcode_data);
+
+    if (group == VM_OC_NONE && instr.opcode != (CBC_END + 1) + CBC_EXT_DEBUGGER)
+    {
+      return 0;
+    }
+
+    if (instr.branch_target_p != NULL)
+    {
+      if (instr.branch_target_p < compiler_p->body_start_p || instr.branch_target_p >= byte_code_end_p)
+      {
+        return 0;
+      }
+
+      if (instr.branch_target_p > last_target_p)
+      {
+        last_target_p = instr.branch_target_p;
+      }
+    }
+
+    count++;
+    byte_code_p = instr.next_p;
+
+    /* The body ends with the first unconditional control transfer which
+     * is not followed by the target of a forward branch. */
+    if ((group == VM_OC_RET
+         || group == VM_OC_THROW
+         || group == VM_OC_THROW_REFERENCE_ERROR
+         || group == VM_OC_JUMP
+         || group == VM_OC_JUMP_AND_EXIT_CONTEXT)
+        && byte_code_p > last_target_p)
+    {
+      return count;
+    }
+  }
+} /* vm_jit_scan_instructions */
+
+/**
+ * Emit the native code of the function.
+ */
+static void
+vm_jit_emit_function (vm_jit_compiler_t *compiler_p) /**< compiler */
+{
+  const uint8_t *byte_code_p = compiler_p->body_start_p;
+  vm_jit_instruction_t instr;
+  vm_jit_instruction_t next_instr;
+  bool is_previous_compiled = false;
+
+  compiler_p->offset = 0;
+
+  /* Prologue: save the callee saved registers, and align the stack. */
+  vm_jit_emit_byte (compiler_p, 0x50 | VM_JIT_RBP);
+  vm_jit_emit_byte (compiler_p, 0x50 | VM_JIT_RBX);
+
+  for (uint32_t reg = VM_JIT_R12; reg <= VM_JIT_R15; reg++)
+  {
+    vm_jit_emit_byte (compiler_p, 0x41);
+    vm_jit_emit_byte (compiler_p, 0x50 | (reg & 0x7));
+  }
+
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_SUB, true, VM_JIT_RSP, 8);
+  vm_jit_emit_mov64 (compiler_p, VM_JIT_FRAME, VM_JIT_RDI);
+  vm_jit_emit_load_stack_top (compiler_p);
+  vm_jit_emit_load64 (compiler_p, VM_JIT_REGISTERS, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (registers_p));
+  /* jmp rsi */
+  vm_jit_emit_byte (compiler_p, 0xff);
+  vm_jit_emit_byte (compiler_p, 0xe6);
+
+  vm_jit_decode_instruction (compiler_p, byte_code_p, &instr);
+
+  for (uint32_t i = 0; i < compiler_p->entry_count; i++)
+  {
+    vm_jit_entry_t *entry_p = compiler_p->entries_p + i;
+    bool has_next = (i + 1 < compiler_p->entry_count);
+
+    JERRY_ASSERT (entry_p->byte_code_offset
+                  == (uint32_t) (instr.byte_code_p - (const uint8_t *) compiler_p->bytecode_header_p));
+
+    if (has_next)
+    {
+      vm_jit_decode_instruction (compiler_p, instr.next_p, &next_instr);
+    }
+
+    if (entry_p->native_offset & VM_JIT_ENTRY_INTERPRETED)
+    {
+      entry_p->native_offset = compiler_p->offset | VM_JIT_ENTRY_INTERPRETED;
+
+      if (is_previous_compiled)
+      {
+        vm_jit_emit_exit (compiler_p, instr.byte_code_p);
+      }
+
+      is_previous_compiled = false;
+    }
+    else
+    {
+      entry_p->native_offset = compiler_p->offset;
+      vm_jit_emit_instruction (compiler_p, &instr, has_next ? &next_instr : NULL);
+      is_previous_compiled = true;
+    }
+
+    if (!has_next)
+    {
+      if (is_previous_compiled)
+      {
+        vm_jit_emit_exit (compiler_p, instr.next_p);
+      }
+      break;
+    }
+
+    instr = next_instr;
+  }
+
+  /* Error exits: free the owned operands. */
+  compiler_p->error_offsets[VM_JIT_OPERAND_RIGHT] = compiler_p->offset;
+  vm_jit_emit_free_value (compiler_p, VM_JIT_RIGHT);
+  vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_ALWAYS, compiler_p->error_offsets[0]);
+
+  compiler_p->error_offsets[VM_JIT_OPERAND_LEFT | VM_JIT_OPERAND_RIGHT] = compiler_p->offset;
+  vm_jit_emit_free_value (compiler_p, VM_JIT_RIGHT);
+
+  compiler_p->error_offsets[VM_JIT_OPERAND_LEFT] = compiler_p->offset;
+  vm_jit_emit_free_value (compiler_p, VM_JIT_LEFT);
+
+  compiler_p->error_offsets[0] = compiler_p->offset;
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RAX, ECMA_VALUE_ERROR);
+
+  /* Epilogue: return the value in eax. */
+  compiler_p->exit_value_offset = compiler_p->offset;
+  vm_jit_emit_save_stack_top (compiler_p);
+  vm_jit_emit_alu_imm (compiler_p, VM_JIT_ALU_ADD, true, VM_JIT_RSP, 8);
+
+  for (uint32_t reg = VM_JIT_R15; reg >= VM_JIT_R12; reg--)
+  {
+    vm_jit_emit_byte (compiler_p, 0x41);
+    vm_jit_emit_byte (compiler_p, 0x58 | (reg & 0x7));
+  }
+
+  vm_jit_emit_byte (compiler_p, 0x58 | VM_JIT_RBX);
+  vm_jit_emit_byte (compiler_p, 0x58 | VM_JIT_RBP);
+  /* ret */
+  vm_jit_emit_byte (compiler_p, 0xc3);
+
+  /* Continue in the interpreter from the instruction in rax. */
+  compiler_p->exit_interpreter_offset = compiler_p->offset;
+  vm_jit_emit_store64 (compiler_p, VM_JIT_FRAME, VM_JIT_FRAME_OFFSET (byte_code_p), VM_JIT_RAX);
+  vm_jit_emit_mov32_imm (compiler_p, VM_JIT_RAX, ECMA_VALUE_EMPTY);
+  vm_jit_emit_jump_offset (compiler_p, VM_JIT_CC_ALWAYS, compiler_p->exit_value_offset);
+} /* vm_jit_emit_function */
+
+/**
+ * Compile the byte code of a function.
+ *
+ * @return true - if the function is compiled
+ *         false - otherwise
+ */
+static bool
+vm_jit_compile_function (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                         vm_jit_function_t *function_p) /**< [out] compiled function */
+{
+  const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
+  const uint8_t *byte_code_end_p = ((const uint8_t *) bytecode_header_p
+                                    + ecma_compiled_code_get_size (bytecode_header_p));
+  const uint8_t *byte_code_p = frame_ctx_p->byte_code_start_p;
+  vm_jit_compiler_t compiler;
+
+  memset (&compiler, 0, sizeof (vm_jit_compiler_t));
+
+  compiler.bytecode_header_p = bytecode_header_p;
+  compiler.literal_start_p = frame_ctx_p->literal_start_p;
+
+  if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
+  {
+    compiler.encoding_limit = 255;
+    compiler.encoding_delta = 0xfe01;
+  }
+  else
+  {
+    compiler.encoding_limit = 128;
+    compiler.encoding_delta = 0x8000;
+  }
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+    compiler.register_end = args_p->register_end;
+    compiler.ident_end = args_p->ident_end;
+    compiler.const_literal_end = args_p->const_literal_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+    compiler.register_end = args_p->register_end;
+    compiler.ident_end = args_p->ident_end;
+    compiler.const_literal_end = args_p->const_literal_end;
+  }
+
+  if (byte_code_p <= (const uint8_t *) bytecode_header_p || byte_code_p >= byte_code_end_p)
+  {
+    return false;
+  }
+
+  /* Skip the initializers (see vm_init_loop). */
+  while (true)
+  {
+    uint8_t opcode = *byte_code_p;
+
+    if (opcode != CBC_DEFINE_VARS && opcode != CBC_INITIALIZE_VAR && opcode != CBC_INITIALIZE_VARS)
+    {
+      if (opcode == CBC_SET_BYTECODE_PTR)
+      {
+        return false;
+      }
+      break;
+    }
+
+    vm_jit_instruction_t instr;
+
+    if (!vm_jit_decode_instruction (&compiler, byte_code_p, &instr))
+    {
+      return false;
+    }
+
+    byte_code_p = instr.next_p;
+
+    if (opcode == CBC_INITIALIZE_VARS)
+    {
+      /* Each variable has a value literal index. */
+      uint32_t value_count = (uint32_t) (instr.literals[1] - instr.literals[0]) + 1;
+
+      while (value_count-- > 0)
+      {
+        byte_code_p += (*byte_code_p >= compiler.encoding_limit) ? 2 : 1;
+      }
+    }
+
+    if (byte_code_p >= byte_code_end_p)
+    {
+      return false;
+    }
+  }
+
+  compiler.body_start_p = byte_code_p;
+
+  uint32_t entry_count = vm_jit_scan_instructions (&compiler, byte_code_end_p);
+
+  if (entry_count == 0)
+  {
+    return false;
+  }
+
+  size_t entries_size = entry_count * sizeof (vm_jit_entry_t);
+  vm_jit_entry_t *entries_p = (vm_jit_entry_t *) jerry_port_jit_alloc (entries_size);
+
+  if (entries_p == NULL)
+  {
+    return false;
+  }
+
+  compiler.entries_p = entries_p;
+  compiler.entry_count = entry_count;
+
+  for (uint32_t i = 0; i < entry_count; i++)
+  {
+    vm_jit_instruction_t instr;
+    vm_jit_decode_instruction (&compiler, byte_code_p, &instr);
+
+    entries_p[i].byte_code_offset = (uint32_t) (byte_code_p - (const uint8_t *) bytecode_header_p);
+    entries_p[i].native_offset = vm_jit_is_compiled (&instr) ? 0 : VM_JIT_ENTRY_INTERPRETED;
+    byte_code_p = instr.next_p;
+  }
+
+  /* The first pass computes the code size and the offsets. */
+  vm_jit_emit_function (&compiler);
+
+  uint32_t code_size = compiler.offset;
+  size_t entries_offset = JERRY_ALIGNUP (code_size, sizeof (uint64_t));
+  size_t block_size = entries_offset + entries_size;
+  uint8_t *code_p = (uint8_t *) jerry_port_jit_alloc (block_size);
+
+  if (code_p == NULL)
+  {
+    jerry_port_jit_free (entries_p, entries_size);
+    return false;
+  }
+
+  compiler.buffer_p = code_p;
+  vm_jit_emit_function (&compiler);
+  JERRY_ASSERT (compiler.offset == code_size);
+
+  memcpy (code_p + entries_offset, entries_p, entries_size);
+  jerry_port_jit_free (entries_p, entries_size);
+
+  if (!jerry_port_jit_protect (code_p, block_size))
+  {
+    jerry_port_jit_free (code_p, block_size);
+    return false;
+  }
+
+  function_p->code_p = code_p;
+  function_p->code_size = block_size;
+  function_p->entries_p = (const vm_jit_entry_t *) (code_p + entries_offset);
+  function_p->entry_count = entry_count;
+  return true;
+} /* vm_jit_compile_function */
+
+/**
+ * Get the hash table bucket of a function.
+ *
+ * @return pointer to the bucket
+ */
+static inline vm_jit_function_t ** JERRY_ATTR_ALWAYS_INLINE
+vm_jit_get_bucket (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+  uintptr_t hash = ((uintptr_t) bytecode_header_p) >> JMEM_ALIGNMENT_LOG;
+  return JERRY_CONTEXT (vm_jit_functions) + (hash % VM_JIT_HASH_SIZE);
+} /* vm_jit_get_bucket */
+
+/**
+ * Get the execution counter of a function.
+ *
+ * @return pointer to the counter
+ */
+static inline uint32_t * JERRY_ATTR_ALWAYS_INLINE
+vm_jit_get_counter (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+  uintptr_t hash = ((uintptr_t) bytecode_header_p) >> JMEM_ALIGNMENT_LOG;
+  return JERRY_CONTEXT (vm_jit_counters) + (hash % VM_JIT_COUNTER_SIZE);
+} /* vm_jit_get_counter */
+
+/**
+ * Find the compilation record of a function.
+ *
+ * @return pointer to the record - if the function has been compiled
+ *         NULL - otherwise
+ */
+static vm_jit_function_t *
+vm_jit_find_function (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+  vm_jit_function_t *function_p = *vm_jit_get_bucket (bytecode_header_p);
+
+  while (function_p != NULL && function_p->bytecode_header_p != bytecode_header_p)
+  {
+    function_p = function_p->next_p;
+  }
+
+  return function_p;
+} /* vm_jit_find_function */
+
+/**
+ * Compile a function and record the result.
+ *
+ * @return compiled function - if the compilation is successful
+ *         NULL - otherwise
+ */
+static vm_jit_function_t *
+vm_jit_compile (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION)
+  {
+    /* Static snapshot functions are never freed. */
+    return NULL;
+  }
+
+  vm_jit_function_t *function_p;
+  function_p = (vm_jit_function_t *) jmem_heap_alloc_block_null_on_error (sizeof (vm_jit_function_t));
+
+  if (function_p == NULL)
+  {
+    return NULL;
+  }
+
+  function_p->bytecode_header_p = bytecode_header_p;
+  function_p->code_p = NULL;
+  function_p->code_size = 0;
+  function_p->entries_p = NULL;
+  function_p->entry_count = 0;
+
+  /* Failed compilations are recorded as well, so they are not repeated. */
+  vm_jit_compile_function (frame_ctx_p, function_p);
+
+  vm_jit_function_t **bucket_p = vm_jit_get_bucket (bytecode_header_p);
+  function_p->next_p = *bucket_p;
+  *bucket_p = function_p;
+
+  return (function_p->code_p != NULL) ? function_p : NULL;
+} /* vm_jit_compile */
+
+/**
+ * Count the execution of a function which has not been compiled yet.
+ *
+ * @return compiled function - if the function is compiled
+ *         NULL - otherwise
+ */
+static vm_jit_function_t *
+vm_jit_count (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+#if CONFIG_VM_JIT_THRESHOLD > 0
+  uint32_t *counter_p = vm_jit_get_counter (frame_ctx_p->bytecode_header_p);
+
+  if (++(*counter_p) < CONFIG_VM_JIT_THRESHOLD)
+  {
+    return NULL;
+  }
+
+  *counter_p = 0;
+#endif /* CONFIG_VM_JIT_THRESHOLD > 0 */
+
+  return vm_jit_compile (frame_ctx_p);
+} /* vm_jit_count */
+
+/**
+ * Get the native code of a function before its execution is started.
+ * Functions which are called frequently are compiled.
+ *
+ * @return compiled function - if the function has native code
+ *         NULL - otherwise
+ */
+vm_jit_function_t *
+vm_jit_enter_function (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  vm_jit_function_t *function_p = vm_jit_find_function (frame_ctx_p->bytecode_header_p);
+
+  if (function_p != NULL)
+  {
+    return (function_p->code_p != NULL) ? function_p : NULL;
+  }
+
+  return vm_jit_count (frame_ctx_p);
+} /* vm_jit_enter_function */
+
+/**
+ * Count a backward branch of a function which has no native code.
+ * Functions which contain frequently executed loops are compiled.
+ *
+ * @return true - if the function has native code
+ *         false - otherwise
+ */
+bool
+vm_jit_count_backward_branch (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  JERRY_ASSERT (frame_ctx_p->jit_function_p == NULL);
+
+#if CONFIG_VM_JIT_THRESHOLD > 0
+  uint32_t *counter_p = vm_jit_get_counter (frame_ctx_p->bytecode_header_p);
+
+  if (++(*counter_p) < CONFIG_VM_JIT_THRESHOLD)
+  {
+    return false;
+  }
+
+  *counter_p = 0;
+#endif /* CONFIG_VM_JIT_THRESHOLD > 0 */
+
+  vm_jit_function_t *function_p = vm_jit_find_function (frame_ctx_p->bytecode_header_p);
+
+  if (function_p == NULL)
+  {
+    function_p = vm_jit_compile (frame_ctx_p);
+  }
+  else if (function_p->code_p == NULL)
+  {
+    function_p = NULL;
+  }
+
+  frame_ctx_p->jit_function_p = function_p;
+  return function_p != NULL;
+} /* vm_jit_count_backward_branch */
+
+/**
+ * Find the entry point of an instruction.
+ *
+ * @return pointer to the entry point - if the instruction is part of the compiled code
+ *         NULL - otherwise
+ */
+const vm_jit_entry_t *
+vm_jit_find_entry (const vm_jit_function_t *function_p, /**< compiled function */
+                   const uint8_t *byte_code_p) /**< instruction */
+{
+  uint32_t byte_code_offset = (uint32_t) (byte_code_p - (const uint8_t *) function_p->bytecode_header_p);
+  uint32_t index = vm_jit_find_entry_index (function_p->entries_p, function_p->entry_count, byte_code_offset);
+
+  return (index != UINT32_MAX) ? function_p->entries_p + index : NULL;
+} /* vm_jit_find_entry */
+
+/**
+ * Run the native code from an entry point. The stack top and the block result
+ * are passed in the frame context, and the native code updates them.
+ *
+ * @return ECMA_VALUE_EMPTY - if the execution continues in the interpreter from
+ *                            the instruction stored in frame_ctx_p->byte_code_p
+ *         completion value - otherwise (same as the value passed to the error label of vm_loop)
+ */
+ecma_value_t
+vm_jit_run (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+            const vm_jit_function_t *function_p, /**< compiled function */
+            const vm_jit_entry_t *entry_p) /**< entry point */
+{
+  vm_jit_native_code_t native_code;
+  uint8_t *code_p = function_p->code_p;
+
+  JERRY_ASSERT (!(entry_p->native_offset & VM_JIT_ENTRY_INTERPRETED));
+
+  /* ISO C does not allow casting data pointers to function pointers. */
+  memcpy (&native_code, &code_p, sizeof (native_code));
+  return native_code (frame_ctx_p, code_p + entry_p->native_offset);
+} /* vm_jit_run */
+
+/**
+ * Free the native code of a function.
+ */
+static void
+vm_jit_free_record (vm_jit_function_t *function_p) /**< compiled function */
+{
+  if (function_p->code_p != NULL)
+  {
+    jerry_port_jit_free (function_p->code_p, function_p->code_size);
+  }
+
+  jmem_heap_free_block (function_p, sizeof (vm_jit_function_t));
+} /* vm_jit_free_record */
+
+/**
+ * Free the native code of a function when its byte code is freed.
+ */
+void
+vm_jit_free_function (const ecma_compiled_code_t *bytecode_header_p) /**< byte code */
+{
+  vm_jit_function_t **function_p_p = vm_jit_get_bucket (bytecode_header_p);
+
+  while (*function_p_p != NULL)
+  {
+    vm_jit_function_t *function_p = *function_p_p;
+
+    if (function_p->bytecode_header_p == bytecode_header_p)
+    {
+      *function_p_p = function_p->next_p;
+      vm_jit_free_record (function_p);
+      break;
+    }
+
+    function_p_p = &function_p->next_p;
+  }
+
+  /* The counter may belong to a new function allocated at the same address. */
+  *vm_jit_get_counter (bytecode_header_p) = 0;
+} /* vm_jit_free_function */
+
+/**
+ * Free all native code.
+ */
+void
+vm_jit_finalize (void)
+{
+  for (uint32_t i = 0; i < VM_JIT_HASH_SIZE; i++)
+  {
+    vm_jit_function_t *function_p = JERRY_CONTEXT (vm_jit_functions)[i];
+
+    while (function_p != NULL)
+    {
+      vm_jit_function_t *next_p = function_p->next_p;
+      vm_jit_free_record (function_p);
+      function_p = next_p;
+    }
+
+    JERRY_CONTEXT (vm_jit_functions)[i] = NULL;
+  }
+} /* vm_jit_finalize */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_JIT */
@@ -0,0 +1,93 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_JIT_H
+#define VM_JIT_H
+
+#include "ecma-globals.h"
+#include "vm-defines.h"
+
+#ifdef JERRY_JIT
+
+#if !defined (__x86_64__) || defined (_WIN32)
+#error "The JIT compiler is only supported on x86-64 targets with the System V calling convention."
+#endif /* !__x86_64__ || _WIN32 */
+
+#ifdef JERRY_DEBUGGER
+#error "The JIT compiler cannot be combined with the debugger."
+#endif /* JERRY_DEBUGGER */
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_jit Baseline JIT compiler
+ * @{
+ */
+
+vm_jit_function_t *vm_jit_enter_function (vm_frame_ctx_t *frame_ctx_p);
+bool vm_jit_count_backward_branch (vm_frame_ctx_t *frame_ctx_p);
+const vm_jit_entry_t *vm_jit_find_entry (const vm_jit_function_t *function_p, const uint8_t *byte_code_p);
+ecma_value_t vm_jit_run (vm_frame_ctx_t *frame_ctx_p, const vm_jit_function_t *function_p,
+                         const vm_jit_entry_t *entry_p);
+void vm_jit_free_function (const ecma_compiled_code_t *bytecode_header_p);
+void vm_jit_finalize (void);
+
+/**
+ * Count a backward branch of an interpreted function.
+ *
+ * @return true - if the function has native code, which should be entered
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_jit_backward_branch (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  return frame_ctx_p->jit_function_p != NULL || vm_jit_count_backward_branch (frame_ctx_p);
+} /* vm_jit_backward_branch */
+
+/*
+ * Runtime helpers called by the native code (see vm.c).
+ */
+ecma_value_t vm_jit_resolve_identifier (vm_frame_ctx_t *frame_ctx_p, ecma_value_t name_value);
+ecma_value_t vm_jit_construct_literal_object (vm_frame_ctx_t *frame_ctx_p, ecma_value_t lit_value);
+ecma_value_t vm_jit_create_object (void);
+ecma_value_t vm_jit_set_property (ecma_value_t object, ecma_value_t name, ecma_value_t value);
+void vm_jit_append_array (ecma_value_t *stack_top_p, uint32_t values_length);
+ecma_value_t vm_jit_ident_reference (vm_frame_ctx_t *frame_ctx_p, ecma_value_t name_value);
+ecma_value_t vm_jit_get_value (ecma_value_t object, ecma_value_t property);
+ecma_value_t vm_jit_prop_incr_decr (vm_frame_ctx_t *frame_ctx_p, uint32_t opcode_data);
+ecma_value_t vm_jit_incr_decr (vm_frame_ctx_t *frame_ctx_p, ecma_value_t value, uint32_t opcode_data);
+ecma_value_t vm_jit_put_result (vm_frame_ctx_t *frame_ctx_p, ecma_value_t result, uint32_t put_data);
+ecma_value_t vm_jit_throw (ecma_value_t value);
+void vm_jit_set_direct_eval (void);
+ecma_value_t vm_jit_call (vm_frame_ctx_t *frame_ctx_p);
+ecma_value_t vm_jit_construct (vm_frame_ctx_t *frame_ctx_p);
+ecma_value_t vm_jit_unary_operation (uint32_t vm_oc, ecma_value_t value);
+ecma_value_t vm_jit_binary_operation (uint32_t vm_oc, ecma_value_t left_value, ecma_value_t right_value);
+ecma_value_t vm_jit_compare (uint32_t vm_oc, ecma_value_t left_value, ecma_value_t right_value);
+#if defined (JERRY_VM_EXEC_STOP) || defined (JERRY_QUOTAS)
+ecma_value_t vm_jit_check_backward_branch (void);
+#endif /* JERRY_VM_EXEC_STOP || JERRY_QUOTAS */
+#ifdef JERRY_ENABLE_LINE_INFO
+void vm_jit_set_resource_name (vm_frame_ctx_t *frame_ctx_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_JIT */
+
+#endif /* !VM_JIT_H */
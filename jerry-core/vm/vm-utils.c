@@ -50,37 +50,76 @@ vm_is_direct_eval_form_call (void)
   return (JERRY_CONTEXT (status_flags) & ECMA_STATUS_DIRECT_EVAL) != 0;
 } /* vm_is_direct_eval_form_call */
 
+#ifdef JERRY_ENABLE_LINE_INFO
+
 /**
- * Get backtrace. The backtrace is an array of strings where
- * each string contains the position of the corresponding frame.
- * The array length is zero if the backtrace is not available.
+ * Capture the position of the currently executed frames. Frames without
+ * resource name are skipped.
  *
- * @return array ecma value
+ * @return captured backtrace, which must be freed by vm_free_backtrace
  */
-ecma_value_t
-vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimited */
+ecma_backtrace_t *
+vm_capture_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimited */
 {
-#ifdef JERRY_ENABLE_LINE_INFO
-  ecma_value_t result_array = ecma_op_create_array_object (NULL, 0, false);
-
   if (max_depth == 0)
   {
     max_depth = UINT32_MAX;
   }
 
+  uint32_t frame_count = 0;
   vm_frame_ctx_t *context_p = JERRY_CONTEXT (vm_top_context_p);
-  ecma_object_t *array_p = ecma_get_object_from_value (result_array);
-  uint32_t index = 0;
 
-  while (context_p != NULL)
+  while (context_p != NULL && frame_count < max_depth)
+  {
+    if (context_p->resource_name != ECMA_VALUE_UNDEFINED)
+    {
+      frame_count++;
+    }
+
+    context_p = context_p->prev_context_p;
+  }
+
+  ecma_backtrace_t *backtrace_p;
+  backtrace_p = (ecma_backtrace_t *) jmem_heap_alloc_block (ECMA_BACKTRACE_GET_SIZE (frame_count));
+  backtrace_p->frame_count = frame_count;
+
+  ecma_backtrace_frame_t *frame_p = (ecma_backtrace_frame_t *) (backtrace_p + 1);
+  ecma_backtrace_frame_t *frame_end_p = frame_p + frame_count;
+
+  context_p = JERRY_CONTEXT (vm_top_context_p);
+
+  while (frame_p < frame_end_p)
   {
-    if (context_p->resource_name == ECMA_VALUE_UNDEFINED)
+    if (context_p->resource_name != ECMA_VALUE_UNDEFINED)
     {
-      context_p = context_p->prev_context_p;
-      continue;
+      frame_p->resource_name = context_p->resource_name;
+      frame_p->line = context_p->current_line;
+      frame_p++;
     }
 
-    ecma_string_t *str_p = ecma_get_string_from_value (context_p->resource_name);
+    context_p = context_p->prev_context_p;
+  }
+
+  return backtrace_p;
+} /* vm_capture_backtrace */
+
+/**
+ * Convert a captured backtrace to an array of strings where
+ * each string contains the position of the corresponding frame.
+ *
+ * @return array ecma value
+ */
+ecma_value_t
+vm_backtrace_to_array (const ecma_backtrace_t *backtrace_p) /**< captured backtrace */
+{
+  ecma_value_t result_array = ecma_op_create_array_object (NULL, 0, false);
+  ecma_object_t *array_p = ecma_get_object_from_value (result_array);
+
+  const ecma_backtrace_frame_t *frame_p = (const ecma_backtrace_frame_t *) (backtrace_p + 1);
+
+  for (uint32_t index = 0; index < backtrace_p->frame_count; index++, frame_p++)
+  {
+    ecma_string_t *str_p = ecma_get_string_from_value (frame_p->resource_name);
 
     if (ecma_string_is_empty (str_p))
     {
@@ -94,7 +133,7 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
       str_p = ecma_append_magic_string_to_string (str_p, LIT_MAGIC_STRING_COLON_CHAR);
     }
 
-    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (context_p->current_line);
+    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (frame_p->line);
     str_p = ecma_concat_ecma_strings (str_p, line_str_p);
     ecma_deref_ecma_string (line_str_p);
 
@@ -107,23 +146,44 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
     ecma_deref_ecma_string (index_str_p);
 
     prop_value_p->value = ecma_make_string_value (str_p);
-
-    context_p = context_p->prev_context_p;
-    index++;
-
-    if (index >= max_depth)
-    {
-      break;
-    }
   }
 
-  if (index > 0)
+  if (backtrace_p->frame_count > 0)
   {
     JERRY_ASSERT (ecma_get_object_type (array_p) == ECMA_OBJECT_TYPE_ARRAY);
 
-    ((ecma_extended_object_t *) array_p)->u.array.length = index;
+    ((ecma_extended_object_t *) array_p)->u.array.length = backtrace_p->frame_count;
   }
 
+  return result_array;
+} /* vm_backtrace_to_array */
+
+/**
+ * Free a captured backtrace.
+ */
+void
+vm_free_backtrace (ecma_backtrace_t *backtrace_p) /**< captured backtrace */
+{
+  jmem_heap_free_block (backtrace_p, ECMA_BACKTRACE_GET_SIZE (backtrace_p->frame_count));
+} /* vm_free_backtrace */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+/**
+ * Get backtrace. The backtrace is an array of strings where
+ * each string contains the position of the corresponding frame.
+ * The array length is zero if the backtrace is not available.
+ *
+ * @return array ecma value
+ */
+ecma_value_t
+vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimited */
+{
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_backtrace_t *backtrace_p = vm_capture_backtrace (max_depth);
+  ecma_value_t result_array = vm_backtrace_to_array (backtrace_p);
+  vm_free_backtrace (backtrace_p);
+
   return result_array;
 #else /* !JERRY_ENABLE_LINE_INFO */
   JERRY_UNUSED (max_depth);
@@ -20,6 +20,7 @@
 #include "ecma-builtins.h"
 #include "ecma-comparison.h"
 #include "ecma-conversion.h"
+#include "ecma-element-store.h"
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
@@ -31,10 +32,15 @@
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "jrt-tracepoints.h"
 #include "opcodes.h"
 #include "vm.h"
 #include "vm-stack.h"
 
+#ifdef JERRY_JIT
+#include "vm-jit.h"
+#endif /* JERRY_JIT */
+
 /** \addtogroup vm Virtual machine
  * @{
  *
@@ -42,6 +48,163 @@
  * @{
  */
 
+/**
+ * Get the name of a property reference without converting the property value.
+ *
+ * Note:
+ *   the returned name is not referenced, so it must not be freed
+ *
+ * @return pointer to the property name - if the property is a string or a
+ *                                         direct unsigned integer
+ *         NULL - otherwise
+ */
+static inline ecma_string_t * JERRY_ATTR_ALWAYS_INLINE
+vm_op_get_direct_property_name (ecma_value_t property) /**< property name */
+{
+  if (ecma_is_value_integer_number (property))
+  {
+    ecma_integer_value_t int_value = ecma_get_integer_from_value (property);
+
+    if (int_value >= 0 && int_value <= ECMA_DIRECT_STRING_MAX_IMM)
+    {
+      return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_UINT,
+                                                          (uintptr_t) int_value);
+    }
+
+    return NULL;
+  }
+
+  if (ecma_is_value_string (property))
+  {
+    return ecma_get_string_from_value (property);
+  }
+
+  return NULL;
+} /* vm_op_get_direct_property_name */
+
+/**
+ * Get the array index of a property reference without converting the property value.
+ *
+ * @return array index - if the property is a number which is a valid array index
+ *         ECMA_STRING_NOT_ARRAY_INDEX - otherwise
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+vm_op_get_direct_array_index (ecma_value_t property) /**< property name */
+{
+  if (ecma_is_value_integer_number (property))
+  {
+    ecma_integer_value_t int_value = ecma_get_integer_from_value (property);
+
+    return (int_value >= 0) ? (uint32_t) int_value : ECMA_STRING_NOT_ARRAY_INDEX;
+  }
+
+  if (ecma_is_value_float_number (property))
+  {
+    ecma_number_t num = ecma_get_float_from_value (property);
+    uint32_t index = ecma_number_to_uint32 (num);
+
+    if ((ecma_number_t) index == num)
+    {
+      return index;
+    }
+  }
+
+  return ECMA_STRING_NOT_ARRAY_INDEX;
+} /* vm_op_get_direct_array_index */
+
+/**
+ * Find the value of an element of object[property] without creating a property name.
+ *
+ * @return pointer to the value of the element - if found
+ *         NULL - otherwise
+ */
+static inline ecma_value_t * JERRY_ATTR_ALWAYS_INLINE
+vm_op_find_element (ecma_object_t *object_p, /**< base object */
+                    ecma_value_t property) /**< property name */
+{
+  uint32_t index = vm_op_get_direct_array_index (property);
+
+  if (index == ECMA_STRING_NOT_ARRAY_INDEX)
+  {
+    return NULL;
+  }
+
+  ecma_element_store_t *store_p = ecma_get_element_store (object_p);
+
+  if (store_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ecma_element_store_find (store_p, index);
+} /* vm_op_find_element */
+
+/**
+ * Find the value of an own, writable data property of object[property]
+ * which can be updated in place.
+ *
+ * Note:
+ *   only properties stored in the property list or in the element store of
+ *   ordinary objects are considered, accessors, inherited and exotic properties
+ *   are left to the generic [[Get]] and [[Put]] operations
+ *
+ * @return pointer to the property value - if found
+ *         NULL - otherwise
+ */
+static ecma_property_value_t *
+vm_op_find_writable_data_property (ecma_value_t object, /**< base object */
+                                   ecma_value_t property, /**< property name */
+                                   bool lcache_only) /**< only the lookup cache is searched */
+{
+  if (!ecma_is_value_object (object))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *object_p = ecma_get_object_from_value (object);
+
+  if (ecma_is_lexical_environment (object_p)
+      || ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_PSEUDO_ARRAY)
+  {
+    return NULL;
+  }
+
+  ecma_value_t *element_value_p = vm_op_find_element (object_p, property);
+
+  if (element_value_p != NULL)
+  {
+    /* Elements are always writable data properties. */
+    return (ecma_property_value_t *) element_value_p;
+  }
+
+  ecma_string_t *property_name_p = vm_op_get_direct_property_name (property);
+
+  if (property_name_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *property_p;
+
+  if (lcache_only)
+  {
+    property_p = ecma_lcache_lookup (object_p, property_name_p);
+  }
+  else
+  {
+    property_p = ecma_find_named_property (object_p, property_name_p);
+  }
+
+  if (property_p == NULL
+      || ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+      || !ecma_is_property_writable (*property_p))
+  {
+    return NULL;
+  }
+
+  return ECMA_PROPERTY_VALUE_PTR (property_p);
+} /* vm_op_find_writable_data_property */
+
 /**
  * Get the value of object[property].
  *
@@ -54,23 +217,15 @@ vm_op_get_value (ecma_value_t object, /**< base object */
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
-    ecma_string_t *property_name_p = NULL;
-
-    if (ecma_is_value_integer_number (property))
-    {
-      ecma_integer_value_t int_value = ecma_get_integer_from_value (property);
+    ecma_value_t *element_value_p = vm_op_find_element (object_p, property);
 
-      if (int_value >= 0 && int_value <= ECMA_DIRECT_STRING_MAX_IMM)
-      {
-        property_name_p = (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_UINT,
-                                                                       (uintptr_t) int_value);
-      }
-    }
-    else if (ecma_is_value_string (property))
+    if (element_value_p != NULL)
     {
-      property_name_p = ecma_get_string_from_value (property);
+      return ecma_fast_copy_value (*element_value_p);
     }
 
+    ecma_string_t *property_name_p = vm_op_get_direct_property_name (property);
+
     if (property_name_p != NULL)
     {
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
@@ -129,6 +284,19 @@ vm_op_set_value (ecma_value_t object, /**< base object */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+  /* The read part of compound assignments has already put the
+   * property into the lookup cache, so the store needs no search. */
+  ecma_property_value_t *prop_value_p = vm_op_find_writable_data_property (object, property, true);
+
+  if (prop_value_p != NULL)
+  {
+    ecma_named_data_property_assign_value (ecma_get_object_from_value (object), prop_value_p, value);
+
+    ecma_free_value (object);
+    ecma_fast_free_value (property);
+    return ECMA_VALUE_TRUE;
+  }
+
   if (JERRY_UNLIKELY (!ecma_is_value_object (object)))
   {
     ecma_value_t to_object = ecma_op_to_object (object);
@@ -195,13 +363,125 @@ vm_op_set_value (ecma_value_t object, /**< base object */
   return completion_value;
 } /* vm_op_set_value */
 
+/**
+ * Define a data property of an object literal.
+ *
+ * Note:
+ *  the arguments are not freed
+ *
+ * @return ECMA_VALUE_ERROR - if the name cannot be converted to string
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+vm_op_set_property (ecma_value_t object, /**< object literal */
+                    ecma_value_t name, /**< property name */
+                    ecma_value_t value) /**< property value */
+{
+  ecma_object_t *object_p = ecma_get_object_from_value (object);
+  ecma_string_t *prop_name_p;
+  ecma_property_t *property_p;
+
+  if (ecma_is_value_string (name))
+  {
+    prop_name_p = ecma_get_string_from_value (name);
+  }
+  else
+  {
+    ecma_value_t name_value = ecma_op_to_string (name);
+
+    if (ECMA_IS_VALUE_ERROR (name_value))
+    {
+      return name_value;
+    }
+
+    prop_name_p = ecma_get_string_from_value (name_value);
+  }
+
+  property_p = ecma_find_named_property (object_p, prop_name_p);
+
+  if (property_p != NULL
+      && ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    ecma_delete_property (object_p, ECMA_PROPERTY_VALUE_PTR (property_p));
+    property_p = NULL;
+  }
+
+  ecma_property_value_t *prop_value_p;
+
+  if (property_p == NULL)
+  {
+    prop_value_p = ecma_create_named_data_property (object_p,
+                                                    prop_name_p,
+                                                    ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                    NULL);
+  }
+  else
+  {
+    prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+  }
+
+  ecma_named_data_property_assign_value (object_p, prop_value_p, value);
+
+  if (!ecma_is_value_string (name))
+  {
+    ecma_deref_ecma_string (prop_name_p);
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* vm_op_set_property */
+
+/**
+ * Append the values on the top of the stack to an array literal.
+ *
+ * Note:
+ *  the references of the values are moved to the array
+ */
+static void
+vm_op_append_array (ecma_value_t *stack_top_p, /**< first value, the array is below it */
+                    uint32_t values_length) /**< number of values */
+{
+  ecma_object_t *array_obj_p = ecma_get_object_from_value (stack_top_p[-1]);
+  ecma_extended_object_t *ext_array_obj_p = (ecma_extended_object_t *) array_obj_p;
+
+  uint32_t length_num = ext_array_obj_p->u.array.length;
+
+  for (uint32_t i = 0; i < values_length; i++)
+  {
+    if (!ecma_is_value_array_hole (stack_top_p[i]))
+    {
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length_num);
+
+      ecma_property_value_t *prop_value_p;
+      prop_value_p = ecma_create_named_data_property (array_obj_p,
+                                                      index_str_p,
+                                                      ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                      NULL);
+
+      JERRY_ASSERT (ecma_is_value_undefined (prop_value_p->value));
+      prop_value_p->value = stack_top_p[i];
+
+      /* The reference is moved so no need to free stack_top_p[i] except for objects. */
+      if (ecma_is_value_object (stack_top_p[i]))
+      {
+        ecma_free_value (stack_top_p[i]);
+      }
+
+      ecma_deref_ecma_string (index_str_p);
+    }
+
+    length_num++;
+  }
+
+  ext_array_obj_p->u.array.length = length_num;
+} /* vm_op_append_array */
+
 /** Compact bytecode define */
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
 /**
  * Decode table for both opcodes and extended opcodes.
  */
-static const uint16_t vm_decode_table[] JERRY_CONST_DATA =
+const uint16_t vm_decode_table[] JERRY_CONST_DATA =
 {
   CBC_OPCODE_LIST
   CBC_EXT_OPCODE_LIST
@@ -748,6 +1028,1183 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 } /* vm_init_loop */
 
+/**
+ * Fast paths of the relational and equality operators, which compare
+ * integers, numbers, strings and booleans without creating a result value.
+ *
+ * Note:
+ *   the function is always inlined with a constant vm_oc argument,
+ *   so only the code of the selected operator is kept
+ *
+ * @return true - if the values are compared, and the result is stored into result_p
+ *         false - otherwise, the generic comparison must be used
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_compare_values (uint32_t vm_oc, /**< VM_OC_EQUAL ... VM_OC_GREATER_EQUAL */
+                   ecma_value_t left_value, /**< left operand */
+                   ecma_value_t right_value, /**< right operand */
+                   bool *result_p) /**< [out] result of the comparison */
+{
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+    ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+    switch (vm_oc)
+    {
+      case VM_OC_LESS:
+      {
+        *result_p = (left_integer < right_integer);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = (left_integer > right_integer);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = (left_integer <= right_integer);
+        return true;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        *result_p = (left_integer >= right_integer);
+        return true;
+      }
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = (left_value == right_value);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (vm_oc == VM_OC_NOT_EQUAL || vm_oc == VM_OC_STRICT_NOT_EQUAL);
+        *result_p = (left_value != right_value);
+        return true;
+      }
+    }
+  }
+
+  if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+  {
+    ecma_number_t left_number = ecma_get_number_from_value (left_value);
+    ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+    switch (vm_oc)
+    {
+      case VM_OC_LESS:
+      {
+        *result_p = (left_number < right_number);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = (left_number > right_number);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = (left_number <= right_number);
+        return true;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        *result_p = (left_number >= right_number);
+        return true;
+      }
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = (left_number == right_number);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (vm_oc == VM_OC_NOT_EQUAL || vm_oc == VM_OC_STRICT_NOT_EQUAL);
+        *result_p = (left_number != right_number);
+        return true;
+      }
+    }
+  }
+
+  if (ecma_is_value_string (left_value) && ecma_is_value_string (right_value))
+  {
+    ecma_string_t *left_str_p = ecma_get_string_from_value (left_value);
+    ecma_string_t *right_str_p = ecma_get_string_from_value (right_value);
+
+    switch (vm_oc)
+    {
+      case VM_OC_LESS:
+      {
+        *result_p = ecma_compare_ecma_strings_relational (left_str_p, right_str_p);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = ecma_compare_ecma_strings_relational (right_str_p, left_str_p);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = !ecma_compare_ecma_strings_relational (right_str_p, left_str_p);
+        return true;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        *result_p = !ecma_compare_ecma_strings_relational (left_str_p, right_str_p);
+        return true;
+      }
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = ecma_compare_ecma_strings (left_str_p, right_str_p);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (vm_oc == VM_OC_NOT_EQUAL || vm_oc == VM_OC_STRICT_NOT_EQUAL);
+        *result_p = !ecma_compare_ecma_strings (left_str_p, right_str_p);
+        return true;
+      }
+    }
+  }
+
+  if (ecma_is_value_boolean (left_value) && ecma_is_value_boolean (right_value))
+  {
+    /* The relational operators convert booleans to numbers. */
+    int left_integer = ecma_is_value_true (left_value) ? 1 : 0;
+    int right_integer = ecma_is_value_true (right_value) ? 1 : 0;
+
+    switch (vm_oc)
+    {
+      case VM_OC_LESS:
+      {
+        *result_p = (left_integer < right_integer);
+        return true;
+      }
+      case VM_OC_GREATER:
+      {
+        *result_p = (left_integer > right_integer);
+        return true;
+      }
+      case VM_OC_LESS_EQUAL:
+      {
+        *result_p = (left_integer <= right_integer);
+        return true;
+      }
+      case VM_OC_GREATER_EQUAL:
+      {
+        *result_p = (left_integer >= right_integer);
+        return true;
+      }
+      case VM_OC_EQUAL:
+      case VM_OC_STRICT_EQUAL:
+      {
+        *result_p = (left_value == right_value);
+        return true;
+      }
+      default:
+      {
+        JERRY_ASSERT (vm_oc == VM_OC_NOT_EQUAL || vm_oc == VM_OC_STRICT_NOT_EQUAL);
+        *result_p = (left_value != right_value);
+        return true;
+      }
+    }
+  }
+
+  if ((vm_oc == VM_OC_EQUAL || vm_oc == VM_OC_NOT_EQUAL)
+      && (ecma_is_value_undefined (left_value)
+          || ecma_is_value_null (left_value)
+          || ecma_is_value_undefined (right_value)
+          || ecma_is_value_null (right_value)))
+  {
+    /* Undefined and null are only equal to each other, no conversion is performed. */
+    bool is_equal = ((ecma_is_value_undefined (left_value) || ecma_is_value_null (left_value))
+                     && (ecma_is_value_undefined (right_value) || ecma_is_value_null (right_value)));
+
+    *result_p = (vm_oc == VM_OC_EQUAL) ? is_equal : !is_equal;
+    return true;
+  }
+
+  return false;
+} /* vm_compare_values */
+
+#ifdef JERRY_VM_EXEC_STOP
+
+/**
+ * Call the execution stop callback.
+ *
+ * @return ECMA_VALUE_ERROR - if the execution is aborted
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_call_exec_stop_callback (void)
+{
+  ecma_value_t result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  JERRY_CONTEXT (vm_exec_stop_counter) = 1;
+
+  if (!ecma_is_value_error_reference (result))
+  {
+    JERRY_CONTEXT (error_value) = result;
+  }
+  else
+  {
+    JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
+  }
+
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
+  return ECMA_VALUE_ERROR;
+} /* vm_call_exec_stop_callback */
+
+#endif /* JERRY_VM_EXEC_STOP */
+
+#ifdef JERRY_QUOTAS
+
+/**
+ * Abort the execution because a quota is exceeded.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_raise_quota_abort (const char *msg_p) /**< error message */
+{
+  ecma_raise_range_error (msg_p);
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
+  return ECMA_VALUE_ERROR;
+} /* vm_raise_quota_abort */
+
+/**
+ * Slow path of the quota check: the branch counter is reached zero or the heap usage is above its limit.
+ *
+ * @return ECMA_VALUE_ERROR - if a quota is exceeded
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_check_quotas_slow (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (quota_branch_counter) == 0);
+
+  if (JERRY_CONTEXT (quota_branch_deferred) != 0)
+  {
+    /* The counter was cut short by the allocator to check the heap quota. */
+    JERRY_CONTEXT (quota_branch_counter) = JERRY_CONTEXT (quota_branch_deferred);
+    JERRY_CONTEXT (quota_branch_deferred) = 0;
+  }
+  else if (JERRY_CONTEXT (quota_branch_limit) != 0)
+  {
+    /* The abort is repeated until the quotas are set again. */
+    JERRY_CONTEXT (quota_branch_counter) = 1;
+    return vm_raise_quota_abort (ECMA_ERR_MSG ("Execution quota exceeded."));
+  }
+  else
+  {
+    JERRY_CONTEXT (quota_branch_counter) = UINT32_MAX;
+  }
+
+  if (JERRY_CONTEXT (jmem_heap_allocated_size) > JERRY_CONTEXT (quota_heap_limit))
+  {
+    ecma_free_unused_memory (JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH);
+
+    if (JERRY_CONTEXT (jmem_heap_allocated_size) > JERRY_CONTEXT (quota_heap_limit))
+    {
+      /* The abort is repeated until enough memory is released. */
+      jmem_heap_request_quota_check ();
+      return vm_raise_quota_abort (ECMA_ERR_MSG ("Heap quota exceeded."));
+    }
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* vm_check_quotas_slow */
+
+/**
+ * Count a backward branch or a function call and check the quotas.
+ *
+ * Note:
+ *      the heap quota is checked only by the slow path: the allocator sets the
+ *      counter to one when the heap usage exceeds the quota
+ *
+ * @return ECMA_VALUE_ERROR - if a quota is exceeded
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+vm_check_quotas (void)
+{
+  if (JERRY_UNLIKELY (--JERRY_CONTEXT (quota_branch_counter) == 0))
+  {
+    return vm_check_quotas_slow ();
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* vm_check_quotas */
+
+#endif /* JERRY_QUOTAS */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Get the resource name stored after the byte code of a function.
+ *
+ * @return resource name
+ */
+static ecma_value_t
+vm_get_resource_name (const ecma_compiled_code_t *bytecode_header_p) /**< byte-code data header */
+{
+  ecma_length_t formal_params_number = 0;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
+  {
+    if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+    {
+      cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
+
+      formal_params_number = args_p->argument_end;
+    }
+    else
+    {
+      cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
+
+      formal_params_number = args_p->argument_end;
+    }
+  }
+
+  uint8_t *byte_p = (uint8_t *) bytecode_header_p;
+  byte_p += ecma_compiled_code_get_size (bytecode_header_p);
+
+  ecma_value_t *resource_name_p = (ecma_value_t *) byte_p;
+  resource_name_p -= formal_params_number;
+
+  return resource_name_p[-1];
+} /* vm_get_resource_name */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+#ifdef JERRY_TRACEPOINTS
+
+JERRY_TRACEPOINT_SEMAPHORE (function__entry);
+JERRY_TRACEPOINT_SEMAPHORE (function__exit);
+
+/**
+ * Fire the function entry or exit tracepoint of a frame.
+ *
+ * Note:
+ *      the line of a function is only known after its first statement is
+ *      executed, so only the exit tracepoint has a line argument
+ */
+static void JERRY_ATTR_NOINLINE
+vm_tracepoint_function (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                        bool is_exit) /**< exit tracepoint */
+{
+  ecma_value_t resource_name = ECMA_VALUE_UNDEFINED;
+  uint32_t line = 0;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  if (is_exit)
+  {
+    resource_name = frame_ctx_p->resource_name;
+    line = frame_ctx_p->current_line;
+  }
+  else if (frame_ctx_p->byte_code_start_p[0] == CBC_EXT_OPCODE
+           && frame_ctx_p->byte_code_start_p[1] == CBC_EXT_RESOURCE_NAME)
+  {
+    /* The resource name is set by the first instruction of the function. */
+    resource_name = vm_get_resource_name (frame_ctx_p->bytecode_header_p);
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  ecma_string_t *resource_name_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+  if (ecma_is_value_string (resource_name))
+  {
+    resource_name_p = ecma_get_string_from_value (resource_name);
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (resource_name_p, resource_name_chars_p, resource_name_size);
+
+  if (is_exit)
+  {
+    JERRY_TRACEPOINT_SEMAPHORE4 (function__exit,
+                                 (uintptr_t) frame_ctx_p->bytecode_header_p,
+                                 (uintptr_t) resource_name_chars_p,
+                                 resource_name_size,
+                                 line);
+  }
+  else
+  {
+    JERRY_TRACEPOINT_SEMAPHORE3 (function__entry,
+                                 (uintptr_t) frame_ctx_p->bytecode_header_p,
+                                 (uintptr_t) resource_name_chars_p,
+                                 resource_name_size);
+  }
+
+  ECMA_FINALIZE_UTF8_STRING (resource_name_chars_p, resource_name_size);
+} /* vm_tracepoint_function */
+
+#endif /* JERRY_TRACEPOINTS */
+
+#ifdef JERRY_JIT
+
+/*
+ * Runtime helpers of the native code generated by the JIT compiler. The native
+ * code keeps the block result in frame_ctx_p->call_block_result, and stores the
+ * stack top into the frame context before calling helpers which use the stack.
+ */
+
+/**
+ * Checks whether the code of a frame is strict mode code.
+ *
+ * @return true - if the code is strict mode code
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_jit_is_strict (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  return (frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0;
+} /* vm_jit_is_strict */
+
+/**
+ * Get the value of an identifier which is not a register.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_resolve_identifier (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                           ecma_value_t name_value) /**< identifier name */
+{
+  return ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p,
+                                          ecma_get_string_from_value (name_value));
+} /* vm_jit_resolve_identifier */
+
+/**
+ * Construct a function or regular expression literal.
+ *
+ * @return object value
+ */
+ecma_value_t
+vm_jit_construct_literal_object (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                                 ecma_value_t lit_value) /**< literal */
+{
+  return vm_construct_literal_object (frame_ctx_p, lit_value);
+} /* vm_jit_construct_literal_object */
+
+/**
+ * Create an empty object literal.
+ *
+ * @return object value
+ */
+ecma_value_t
+vm_jit_create_object (void)
+{
+  ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
+  ecma_object_t *obj_p = ecma_create_object (prototype_p,
+                                             0,
+                                             ECMA_OBJECT_TYPE_GENERAL);
+
+  ecma_deref_object (prototype_p);
+  return ecma_make_object_value (obj_p);
+} /* vm_jit_create_object */
+
+/**
+ * Define a data property of an object literal (see vm_op_set_property).
+ *
+ * @return ECMA_VALUE_ERROR - if the name cannot be converted to string
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_set_property (ecma_value_t object, /**< object literal */
+                     ecma_value_t name, /**< property name */
+                     ecma_value_t value) /**< property value */
+{
+  return vm_op_set_property (object, name, value);
+} /* vm_jit_set_property */
+
+/**
+ * Append values to an array literal (see vm_op_append_array).
+ */
+void
+vm_jit_append_array (ecma_value_t *stack_top_p, /**< first value, the array is below it */
+                     uint32_t values_length) /**< number of values */
+{
+  vm_op_append_array (stack_top_p, values_length);
+} /* vm_jit_append_array */
+
+/**
+ * Push the reference and the value of an identifier which is not a register.
+ *
+ * @return ECMA_VALUE_ERROR - if the identifier cannot be resolved
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_ident_reference (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                        ecma_value_t name_value) /**< identifier name */
+{
+  ecma_string_t *name_p = ecma_get_string_from_value (name_value);
+  ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p, name_p);
+
+  ecma_value_t result = ecma_op_get_value_lex_env_base (ref_base_lex_env_p,
+                                                        name_p,
+                                                        vm_jit_is_strict (frame_ctx_p));
+
+  if (ECMA_IS_VALUE_ERROR (result))
+  {
+    return result;
+  }
+
+  ecma_ref_object (ref_base_lex_env_p);
+  ecma_ref_ecma_string (name_p);
+
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p;
+  *stack_top_p++ = ecma_make_object_value (ref_base_lex_env_p);
+  *stack_top_p++ = ecma_make_string_value (name_p);
+  *stack_top_p++ = result;
+  frame_ctx_p->stack_top_p = stack_top_p;
+  return ECMA_VALUE_EMPTY;
+} /* vm_jit_ident_reference */
+
+/**
+ * Get the value of object[property] (see vm_op_get_value).
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_get_value (ecma_value_t object, /**< base object */
+                  ecma_value_t property) /**< property name */
+{
+  return vm_op_get_value (object, property);
+} /* vm_jit_get_value */
+
+/**
+ * Store a result to its destination.
+ *
+ * Note:
+ *   registers are assigned by the native code
+ *
+ * @return ECMA_VALUE_ERROR - if the result cannot be stored
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_put_result (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                   ecma_value_t result, /**< result */
+                   uint32_t put_data) /**< put flags of the opcode data and the literal index
+                                       *   of the identifier shifted left by 16 */
+{
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p;
+
+  if (put_data & VM_OC_PUT_IDENT)
+  {
+    ecma_string_t *var_name_str_p = ecma_get_string_from_value (frame_ctx_p->literal_start_p[put_data >> 16]);
+    ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
+                                                                        var_name_str_p);
+
+    ecma_value_t put_value_result = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
+                                                                    var_name_str_p,
+                                                                    vm_jit_is_strict (frame_ctx_p),
+                                                                    result);
+
+    if (ECMA_IS_VALUE_ERROR (put_value_result))
+    {
+      ecma_free_value (result);
+      return put_value_result;
+    }
+  }
+  else
+  {
+    JERRY_ASSERT (put_data & VM_OC_PUT_REFERENCE);
+
+    ecma_value_t property = *(--stack_top_p);
+    ecma_value_t object = *(--stack_top_p);
+
+    frame_ctx_p->stack_top_p = stack_top_p;
+
+    if (object == ECMA_VALUE_REGISTER_REF)
+    {
+      ecma_fast_free_value (frame_ctx_p->registers_p[property]);
+      frame_ctx_p->registers_p[property] = ecma_fast_copy_value (result);
+    }
+    else
+    {
+      ecma_value_t set_value_result = vm_op_set_value (object,
+                                                       property,
+                                                       result,
+                                                       vm_jit_is_strict (frame_ctx_p));
+
+      if (ECMA_IS_VALUE_ERROR (set_value_result))
+      {
+        ecma_free_value (result);
+        return set_value_result;
+      }
+    }
+  }
+
+  if (put_data & VM_OC_PUT_STACK)
+  {
+    *stack_top_p++ = result;
+    frame_ctx_p->stack_top_p = stack_top_p;
+  }
+  else if (put_data & VM_OC_PUT_BLOCK)
+  {
+    ecma_fast_free_value (frame_ctx_p->call_block_result);
+    frame_ctx_p->call_block_result = result;
+  }
+  else
+  {
+    ecma_fast_free_value (result);
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* vm_jit_put_result */
+
+/**
+ * Generic path of the increment and decrement operators.
+ *
+ * Note:
+ *   the value is freed, and the unmodified number value of
+ *   postfix operators is stored to the stack or block result
+ *
+ * @return new value of the operand
+ */
+ecma_value_t
+vm_jit_incr_decr (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                  ecma_value_t value, /**< value of the operand */
+                  uint32_t opcode_data) /**< opcode data */
+{
+  uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+  ecma_value_t result;
+
+  if (ecma_is_value_number (value))
+  {
+    result = value;
+  }
+  else
+  {
+    result = ecma_op_to_number (value);
+    ecma_free_value (value);
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      return result;
+    }
+  }
+
+  ecma_number_t increase = ECMA_NUMBER_ONE;
+  ecma_number_t result_number = ecma_get_number_from_value (result);
+
+  if (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG)
+  {
+    /* For decrement operators */
+    increase = ECMA_NUMBER_MINUS_ONE;
+  }
+
+  /* Post operators require the unmodifed number value. */
+  if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+  {
+    if (opcode_data & VM_OC_PUT_STACK)
+    {
+      ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p;
+
+      if (opcode_flags & VM_OC_IDENT_INCR_DECR_OPERATOR_FLAG)
+      {
+        *stack_top_p++ = ecma_copy_value (result);
+      }
+      else
+      {
+        /* The parser ensures there is enough space for the
+         * extra value on the stack. See js-parser-expr.c. */
+        stack_top_p++;
+        stack_top_p[-1] = stack_top_p[-2];
+        stack_top_p[-2] = stack_top_p[-3];
+        stack_top_p[-3] = ecma_copy_value (result);
+      }
+
+      frame_ctx_p->stack_top_p = stack_top_p;
+    }
+    else if (opcode_data & VM_OC_PUT_BLOCK)
+    {
+      ecma_free_value (frame_ctx_p->call_block_result);
+      frame_ctx_p->call_block_result = ecma_copy_value (result);
+    }
+  }
+
+  if (ecma_is_value_integer_number (result))
+  {
+    return ecma_make_number_value (result_number + increase);
+  }
+
+  return ecma_update_float_number (result, result_number + increase);
+} /* vm_jit_incr_decr */
+
+/**
+ * Increment and decrement operators of properties. The reference is on the top of the stack.
+ *
+ * @return ECMA_VALUE_ERROR - if an error is occured
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_prop_incr_decr (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                       uint32_t opcode_data) /**< opcode data */
+{
+  ecma_value_t *stack_top_p = frame_ctx_p->stack_top_p;
+  ecma_value_t object = stack_top_p[-2];
+  ecma_value_t property = stack_top_p[-1];
+
+  /* Fast path: small integer own data properties are updated
+   * in place, so the property is searched only once. */
+  ecma_property_value_t *prop_value_p = vm_op_find_writable_data_property (object, property, false);
+
+  if (prop_value_p != NULL && ecma_is_value_integer_number (prop_value_p->value))
+  {
+    uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+    ecma_integer_value_t int_value = (ecma_integer_value_t) prop_value_p->value;
+    ecma_integer_value_t int_increase = 0;
+
+    if (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG)
+    {
+      if (int_value > ECMA_INTEGER_NUMBER_MIN_SHIFTED)
+      {
+        int_increase = -(1 << ECMA_DIRECT_SHIFT);
+      }
+    }
+    else if (int_value < ECMA_INTEGER_NUMBER_MAX_SHIFTED)
+    {
+      int_increase = 1 << ECMA_DIRECT_SHIFT;
+    }
+
+    if (JERRY_LIKELY (int_increase != 0))
+    {
+      ecma_value_t result = (ecma_value_t) (int_value + int_increase);
+      prop_value_p->value = result;
+
+      /* Postfix operators require the unmodifed number value. */
+      if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+      {
+        result = (ecma_value_t) int_value;
+      }
+
+      stack_top_p -= 2;
+
+      if (opcode_data & VM_OC_PUT_STACK)
+      {
+        *stack_top_p++ = result;
+      }
+      else if (opcode_data & VM_OC_PUT_BLOCK)
+      {
+        ecma_fast_free_value (frame_ctx_p->call_block_result);
+        frame_ctx_p->call_block_result = result;
+      }
+
+      frame_ctx_p->stack_top_p = stack_top_p;
+      ecma_fast_free_value (property);
+      ecma_free_value (object);
+      return ECMA_VALUE_EMPTY;
+    }
+  }
+
+  /* The reference is kept on the stack for the put operation. */
+  ecma_value_t result = vm_op_get_value (object, property);
+
+  if (ECMA_IS_VALUE_ERROR (result))
+  {
+    return result;
+  }
+
+  result = vm_jit_incr_decr (frame_ctx_p, result, opcode_data);
+
+  if (ECMA_IS_VALUE_ERROR (result))
+  {
+    return result;
+  }
+
+  if (VM_OC_GROUP_GET_INDEX (opcode_data) >= VM_OC_PROP_POST_INCR)
+  {
+    opcode_data &= (uint32_t) ~(VM_OC_PUT_STACK | VM_OC_PUT_BLOCK);
+  }
+
+  return vm_jit_put_result (frame_ctx_p, result, opcode_data);
+} /* vm_jit_prop_incr_decr */
+
+/**
+ * Throw an exception.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+ecma_value_t
+vm_jit_throw (ecma_value_t value) /**< thrown value */
+{
+  JERRY_CONTEXT (error_value) = value;
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
+  JERRY_TRACEPOINT2 (exception__raise, value, ECMA_ERROR_NONE);
+  return ECMA_VALUE_ERROR;
+} /* vm_jit_throw */
+
+/**
+ * Mark the next call as a direct eval call.
+ */
+void
+vm_jit_set_direct_eval (void)
+{
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
+} /* vm_jit_set_direct_eval */
+
+/**
+ * Call a function. The instruction is stored in frame_ctx_p->byte_code_p.
+ *
+ * @return result of the call
+ */
+ecma_value_t
+vm_jit_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  opfunc_call (frame_ctx_p);
+  return *(--frame_ctx_p->stack_top_p);
+} /* vm_jit_call */
+
+/**
+ * Construct an object. The instruction is stored in frame_ctx_p->byte_code_p.
+ *
+ * @return result of the construction
+ */
+ecma_value_t
+vm_jit_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  opfunc_construct (frame_ctx_p);
+  return *(--frame_ctx_p->stack_top_p);
+} /* vm_jit_construct */
+
+/**
+ * Generic path of the unary operators.
+ *
+ * Note:
+ *   the value is freed
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_unary_operation (uint32_t vm_oc, /**< unary operation */
+                        ecma_value_t value) /**< operand */
+{
+  ecma_value_t result;
+
+  switch (vm_oc)
+  {
+    case VM_OC_PLUS:
+    case VM_OC_MINUS:
+    {
+      result = opfunc_unary_operation (value, vm_oc == VM_OC_PLUS);
+      break;
+    }
+    case VM_OC_NOT:
+    {
+      result = opfunc_logical_not (value);
+      break;
+    }
+    case VM_OC_BIT_NOT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_NOT, value, value);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (vm_oc == VM_OC_TYPEOF);
+      result = opfunc_typeof (value);
+      break;
+    }
+  }
+
+  ecma_fast_free_value (value);
+  return result;
+} /* vm_jit_unary_operation */
+
+/**
+ * Generic path of the binary operators.
+ *
+ * Note:
+ *   the operands are freed
+ *
+ * @return ecma value
+ */
+ecma_value_t
+vm_jit_binary_operation (uint32_t vm_oc, /**< binary operation */
+                         ecma_value_t left_value, /**< left operand */
+                         ecma_value_t right_value) /**< right operand */
+{
+  ecma_value_t result;
+
+  if ((vm_oc == VM_OC_ADD || vm_oc == VM_OC_SUB || vm_oc == VM_OC_MUL || vm_oc == VM_OC_DIV)
+      && ecma_is_value_number (left_value)
+      && ecma_is_value_number (right_value))
+  {
+    ecma_number_t left_number = ecma_get_number_from_value (left_value);
+    ecma_number_t right_number = ecma_get_number_from_value (right_value);
+    ecma_number_t new_value;
+
+    switch (vm_oc)
+    {
+      case VM_OC_ADD:
+      {
+        new_value = left_number + right_number;
+        break;
+      }
+      case VM_OC_SUB:
+      {
+        new_value = left_number - right_number;
+        break;
+      }
+      case VM_OC_MUL:
+      {
+        new_value = left_number * right_number;
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (vm_oc == VM_OC_DIV);
+        new_value = left_number / right_number;
+        break;
+      }
+    }
+
+    /* The float number of an operand is reused for the result. */
+    if (ecma_is_value_float_number (left_value))
+    {
+      ecma_fast_free_value (right_value);
+      return ecma_update_float_number (left_value, new_value);
+    }
+
+    if (ecma_is_value_float_number (right_value))
+    {
+      return ecma_update_float_number (right_value, new_value);
+    }
+
+    return ecma_make_number_value (new_value);
+  }
+
+  switch (vm_oc)
+  {
+    case VM_OC_ADD:
+    {
+      result = opfunc_addition (left_value, right_value);
+      break;
+    }
+    case VM_OC_SUB:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION, left_value, right_value);
+      break;
+    }
+    case VM_OC_MUL:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION, left_value, right_value);
+      break;
+    }
+    case VM_OC_DIV:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
+      break;
+    }
+    case VM_OC_MOD:
+    {
+      result = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER, left_value, right_value);
+      break;
+    }
+    case VM_OC_IN:
+    {
+      result = opfunc_in (left_value, right_value);
+      break;
+    }
+    case VM_OC_INSTANCEOF:
+    {
+      result = opfunc_instanceof (left_value, right_value);
+      break;
+    }
+    case VM_OC_BIT_OR:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR, left_value, right_value);
+      break;
+    }
+    case VM_OC_BIT_XOR:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR, left_value, right_value);
+      break;
+    }
+    case VM_OC_BIT_AND:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND, left_value, right_value);
+      break;
+    }
+    case VM_OC_LEFT_SHIFT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT, left_value, right_value);
+      break;
+    }
+    case VM_OC_RIGHT_SHIFT:
+    {
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT, left_value, right_value);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (vm_oc == VM_OC_UNS_RIGHT_SHIFT);
+      result = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT, left_value, right_value);
+      break;
+    }
+  }
+
+  ecma_fast_free_value (left_value);
+  ecma_fast_free_value (right_value);
+  return result;
+} /* vm_jit_binary_operation */
+
+/**
+ * Generic path of the relational and equality operators.
+ *
+ * Note:
+ *   the operands are freed
+ *
+ * @return ECMA_VALUE_TRUE or ECMA_VALUE_FALSE - if the values are compared
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+ecma_value_t
+vm_jit_compare (uint32_t vm_oc, /**< comparison */
+                ecma_value_t left_value, /**< left operand */
+                ecma_value_t right_value) /**< right operand */
+{
+  bool compare_result = false;
+  ecma_value_t result = ECMA_VALUE_EMPTY;
+
+  switch (vm_oc)
+  {
+    case VM_OC_EQUAL:
+    {
+      if (!vm_compare_values (VM_OC_EQUAL, left_value, right_value, &compare_result))
+      {
+        result = opfunc_equality (left_value, right_value);
+      }
+      break;
+    }
+    case VM_OC_NOT_EQUAL:
+    {
+      if (!vm_compare_values (VM_OC_NOT_EQUAL, left_value, right_value, &compare_result))
+      {
+        result = opfunc_equality (left_value, right_value);
+
+        if (!ECMA_IS_VALUE_ERROR (result))
+        {
+          result = ecma_make_boolean_value (!ecma_is_value_true (result));
+        }
+      }
+      break;
+    }
+    case VM_OC_STRICT_EQUAL:
+    {
+      if (!vm_compare_values (VM_OC_STRICT_EQUAL, left_value, right_value, &compare_result))
+      {
+        compare_result = ecma_op_strict_equality_compare (left_value, right_value);
+      }
+      break;
+    }
+    case VM_OC_STRICT_NOT_EQUAL:
+    {
+      if (!vm_compare_values (VM_OC_STRICT_NOT_EQUAL, left_value, right_value, &compare_result))
+      {
+        compare_result = !ecma_op_strict_equality_compare (left_value, right_value);
+      }
+      break;
+    }
+    case VM_OC_LESS:
+    {
+      if (!vm_compare_values (VM_OC_LESS, left_value, right_value, &compare_result))
+      {
+        result = opfunc_relation (left_value, right_value, true, false);
+      }
+      break;
+    }
+    case VM_OC_GREATER:
+    {
+      if (!vm_compare_values (VM_OC_GREATER, left_value, right_value, &compare_result))
+      {
+        result = opfunc_relation (left_value, right_value, false, false);
+      }
+      break;
+    }
+    case VM_OC_LESS_EQUAL:
+    {
+      if (!vm_compare_values (VM_OC_LESS_EQUAL, left_value, right_value, &compare_result))
+      {
+        result = opfunc_relation (left_value, right_value, false, true);
+      }
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (vm_oc == VM_OC_GREATER_EQUAL);
+
+      if (!vm_compare_values (VM_OC_GREATER_EQUAL, left_value, right_value, &compare_result))
+      {
+        result = opfunc_relation (left_value, right_value, true, true);
+      }
+      break;
+    }
+  }
+
+  if (ecma_is_value_empty (result))
+  {
+    result = ecma_make_boolean_value (compare_result);
+  }
+
+  ecma_fast_free_value (left_value);
+  ecma_fast_free_value (right_value);
+  return result;
+} /* vm_jit_compare */
+
+#if defined (JERRY_VM_EXEC_STOP) || defined (JERRY_QUOTAS)
+
+/**
+ * Call the execution stop callback and check the quotas before a backward branch.
+ *
+ * @return ECMA_VALUE_ERROR - if the execution is aborted
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+ecma_value_t
+vm_jit_check_backward_branch (void)
+{
+#ifdef JERRY_VM_EXEC_STOP
+  if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
+      && --JERRY_CONTEXT (vm_exec_stop_counter) == 0
+      && ECMA_IS_VALUE_ERROR (vm_call_exec_stop_callback ()))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+#endif /* JERRY_VM_EXEC_STOP */
+
+#ifdef JERRY_QUOTAS
+  return vm_check_quotas ();
+#else /* !JERRY_QUOTAS */
+  return ECMA_VALUE_EMPTY;
+#endif /* JERRY_QUOTAS */
+} /* vm_jit_check_backward_branch */
+
+#endif /* JERRY_VM_EXEC_STOP || JERRY_QUOTAS */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Set the resource name of a frame.
+ */
+void
+vm_jit_set_resource_name (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  frame_ctx_p->resource_name = vm_get_resource_name (frame_ctx_p->bytecode_header_p);
+} /* vm_jit_set_resource_name */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+#endif /* JERRY_JIT */
+
 /**
  * Run generic byte code.
  *
@@ -768,11 +2225,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint16_t const_literal_end;
   int32_t branch_offset = 0;
   uint8_t branch_offset_length = 0;
+  bool compare_result = false;
   ecma_value_t left_value;
   ecma_value_t right_value;
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_value_t block_result = ECMA_VALUE_UNDEFINED;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
+#ifdef JERRY_JIT
+  const vm_jit_function_t *jit_function_p = frame_ctx_p->jit_function_p;
+#endif /* JERRY_JIT */
 
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
@@ -809,6 +2270,35 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     /* Internal loop for byte code execution. */
     while (true)
     {
+#ifdef JERRY_JIT
+      /* The instructions of compiled functions are executed by the native code,
+       * except the second part of the call and construct operations. */
+      if (jit_function_p != NULL && frame_ctx_p->call_operation == VM_NO_EXEC_OP)
+      {
+        const vm_jit_entry_t *entry_p = vm_jit_find_entry (jit_function_p, byte_code_p);
+
+        if (entry_p != NULL && !(entry_p->native_offset & VM_JIT_ENTRY_INTERPRETED))
+        {
+          frame_ctx_p->byte_code_p = byte_code_p;
+          frame_ctx_p->stack_top_p = stack_top_p;
+          frame_ctx_p->call_block_result = block_result;
+
+          result = vm_jit_run (frame_ctx_p, jit_function_p, entry_p);
+
+          byte_code_p = frame_ctx_p->byte_code_p;
+          stack_top_p = frame_ctx_p->stack_top_p;
+          block_result = frame_ctx_p->call_block_result;
+
+          if (!ecma_is_value_empty (result))
+          {
+            left_value = ECMA_VALUE_UNDEFINED;
+            right_value = ECMA_VALUE_UNDEFINED;
+            goto error;
+          }
+        }
+      }
+#endif /* JERRY_JIT */
+
       uint8_t *byte_code_start_p = byte_code_p;
       uint8_t opcode = *byte_code_p++;
       uint32_t opcode_data = opcode;
@@ -900,32 +2390,30 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
               && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
           {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+            result = vm_call_exec_stop_callback ();
 
-            if (ecma_is_value_undefined (result))
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
-            }
-            else
+            if (ECMA_IS_VALUE_ERROR (result))
             {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (!ecma_is_value_error_reference (result))
-              {
-                JERRY_CONTEXT (error_value) = result;
-              }
-              else
-              {
-                JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
-              }
-
-              JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
-              result = ECMA_VALUE_ERROR;
               goto error;
             }
           }
 #endif /* JERRY_VM_EXEC_STOP */
 
+#ifdef JERRY_QUOTAS
+          if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (vm_check_quotas ())))
+          {
+            result = ECMA_VALUE_ERROR;
+            goto error;
+          }
+#endif /* JERRY_QUOTAS */
+
+#ifdef JERRY_JIT
+          if (vm_jit_backward_branch (frame_ctx_p))
+          {
+            jit_function_p = frame_ctx_p->jit_function_p;
+          }
+#endif /* JERRY_JIT */
+
           branch_offset = -branch_offset;
         }
       }
@@ -1052,54 +2540,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_SET_PROPERTY:
         {
-          ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-1]);
-          ecma_string_t *prop_name_p;
-          ecma_property_t *property_p;
-
-          if (ecma_is_value_string (right_value))
-          {
-            prop_name_p = ecma_get_string_from_value (right_value);
-          }
-          else
-          {
-            result = ecma_op_to_string (right_value);
-
-            if (ECMA_IS_VALUE_ERROR (result))
-            {
-              goto error;
-            }
+          result = vm_op_set_property (stack_top_p[-1], right_value, left_value);
 
-            prop_name_p = ecma_get_string_from_value (result);
-          }
-
-          property_p = ecma_find_named_property (object_p, prop_name_p);
-
-          if (property_p != NULL
-              && ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
-          {
-            ecma_delete_property (object_p, ECMA_PROPERTY_VALUE_PTR (property_p));
-            property_p = NULL;
-          }
-
-          ecma_property_value_t *prop_value_p;
-
-          if (property_p == NULL)
-          {
-            prop_value_p = ecma_create_named_data_property (object_p,
-                                                            prop_name_p,
-                                                            ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                            NULL);
-          }
-          else
-          {
-            prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
-          }
-
-          ecma_named_data_property_assign_value (object_p, prop_value_p, left_value);
-
-          if (!ecma_is_value_string (right_value))
+          if (ECMA_IS_VALUE_ERROR (result))
           {
-            ecma_deref_ecma_string (prop_name_p);
+            goto error;
           }
 
           goto free_both_values;
@@ -1133,45 +2578,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_APPEND_ARRAY:
         {
-          ecma_object_t *array_obj_p;
-          uint32_t length_num;
           uint32_t values_length = *byte_code_p++;
 
           stack_top_p -= values_length;
-
-          array_obj_p = ecma_get_object_from_value (stack_top_p[-1]);
-          ecma_extended_object_t *ext_array_obj_p = (ecma_extended_object_t *) array_obj_p;
-
-          length_num = ext_array_obj_p->u.array.length;
-
-          for (uint32_t i = 0; i < values_length; i++)
-          {
-            if (!ecma_is_value_array_hole (stack_top_p[i]))
-            {
-              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (length_num);
-
-              ecma_property_value_t *prop_value_p;
-              prop_value_p = ecma_create_named_data_property (array_obj_p,
-                                                              index_str_p,
-                                                              ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                              NULL);
-
-              JERRY_ASSERT (ecma_is_value_undefined (prop_value_p->value));
-              prop_value_p->value = stack_top_p[i];
-
-              /* The reference is moved so no need to free stack_top_p[i] except for objects. */
-              if (ecma_is_value_object (stack_top_p[i]))
-              {
-                ecma_free_value (stack_top_p[i]);
-              }
-
-              ecma_deref_ecma_string (index_str_p);
-            }
-
-            length_num++;
-          }
-
-          ext_array_obj_p->u.array.length = length_num;
+          vm_op_append_array (stack_top_p, values_length);
           continue;
         }
         case VM_OC_PUSH_UNDEFINED_BASE:
@@ -1250,6 +2660,58 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         case VM_OC_PROP_POST_INCR:
         case VM_OC_PROP_POST_DECR:
         {
+          if (opcode >= CBC_PRE_INCR)
+          {
+            /* Fast path: small integer own data properties are updated
+             * in place, so the property is searched only once. */
+            ecma_property_value_t *prop_value_p = vm_op_find_writable_data_property (left_value,
+                                                                                    right_value,
+                                                                                    false);
+
+            if (prop_value_p != NULL && ecma_is_value_integer_number (prop_value_p->value))
+            {
+              uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
+              ecma_integer_value_t int_value = (ecma_integer_value_t) prop_value_p->value;
+              ecma_integer_value_t int_increase = 0;
+
+              if (opcode_flags & VM_OC_DECREMENT_OPERATOR_FLAG)
+              {
+                if (int_value > ECMA_INTEGER_NUMBER_MIN_SHIFTED)
+                {
+                  int_increase = -(1 << ECMA_DIRECT_SHIFT);
+                }
+              }
+              else if (int_value < ECMA_INTEGER_NUMBER_MAX_SHIFTED)
+              {
+                int_increase = 1 << ECMA_DIRECT_SHIFT;
+              }
+
+              if (JERRY_LIKELY (int_increase != 0))
+              {
+                result = (ecma_value_t) (int_value + int_increase);
+                prop_value_p->value = result;
+
+                /* Postfix operators require the unmodifed number value. */
+                if (opcode_flags & VM_OC_POST_INCR_DECR_OPERATOR_FLAG)
+                {
+                  result = (ecma_value_t) int_value;
+                }
+
+                /* The reference has already been popped from the stack. */
+                if (opcode_data & VM_OC_PUT_STACK)
+                {
+                  *stack_top_p++ = result;
+                }
+                else if (opcode_data & VM_OC_PUT_BLOCK)
+                {
+                  ecma_fast_free_value (block_result);
+                  block_result = result;
+                }
+                goto free_both_values;
+              }
+            }
+          }
+
           result = vm_op_get_value (left_value,
                                     right_value);
 
@@ -1458,6 +2920,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           JERRY_CONTEXT (error_value) = left_value;
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
+          JERRY_TRACEPOINT2 (exception__raise, left_value, ECMA_ERROR_NONE);
 
           result = ECMA_VALUE_ERROR;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -1936,45 +3399,53 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_EQUAL:
         {
-          result = opfunc_equality (left_value, right_value);
-
-          if (ECMA_IS_VALUE_ERROR (result))
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_EQUAL, left_value, right_value, &compare_result)))
           {
-            goto error;
+            result = opfunc_equality (left_value, right_value);
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            compare_result = ecma_is_value_true (result);
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_and_branch;
         }
         case VM_OC_NOT_EQUAL:
         {
-          result = opfunc_equality (left_value, right_value);
-
-          if (ECMA_IS_VALUE_ERROR (result))
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_NOT_EQUAL, left_value, right_value, &compare_result)))
           {
-            goto error;
+            result = opfunc_equality (left_value, right_value);
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            compare_result = !ecma_is_value_true (result);
           }
 
-          *stack_top_p++ = ecma_invert_boolean_value (result);
-          goto free_both_values;
+          goto compare_and_branch;
         }
         case VM_OC_STRICT_EQUAL:
         {
-          bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
-
-          result = ecma_make_boolean_value (is_equal);
+          if (!vm_compare_values (VM_OC_STRICT_EQUAL, left_value, right_value, &compare_result))
+          {
+            compare_result = ecma_op_strict_equality_compare (left_value, right_value);
+          }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_and_branch;
         }
         case VM_OC_STRICT_NOT_EQUAL:
         {
-          bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
-
-          result = ecma_make_boolean_value (!is_equal);
+          if (!vm_compare_values (VM_OC_STRICT_NOT_EQUAL, left_value, right_value, &compare_result))
+          {
+            compare_result = !ecma_op_strict_equality_compare (left_value, right_value);
+          }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_and_branch;
         }
         case VM_OC_BIT_OR:
         {
@@ -2110,155 +3581,141 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         case VM_OC_LESS:
         {
-          if (ecma_are_values_integer_numbers (left_value, right_value))
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_LESS, left_value, right_value, &compare_result)))
           {
-            bool is_less = (ecma_integer_value_t) left_value < (ecma_integer_value_t) right_value;
+            result = opfunc_relation (left_value, right_value, true, false);
 
-            /* This is a lookahead to the next opcode to improve performance.
-             * If it is CBC_BRANCH_IF_TRUE_BACKWARD, execute it. */
-            if (*byte_code_p <= CBC_BRANCH_IF_TRUE_BACKWARD_3 && *byte_code_p >= CBC_BRANCH_IF_TRUE_BACKWARD)
+            if (ECMA_IS_VALUE_ERROR (result))
             {
-              byte_code_start_p = byte_code_p++;
-              branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
-              JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
-
-              if (is_less)
-              {
-                branch_offset = *(byte_code_p++);
-
-                if (JERRY_UNLIKELY (branch_offset_length != 1))
-                {
-                  branch_offset <<= 8;
-                  branch_offset |= *(byte_code_p++);
-                  if (JERRY_UNLIKELY (branch_offset_length == 3))
-                  {
-                    branch_offset <<= 8;
-                    branch_offset |= *(byte_code_p++);
-                  }
-                }
-
-                /* Note: The opcode is a backward branch. */
-                byte_code_p = byte_code_start_p - branch_offset;
-              }
-              else
-              {
-                byte_code_p += branch_offset_length;
-              }
-
-              continue;
+              goto error;
             }
 
-            *stack_top_p++ = ecma_make_boolean_value (is_less);
-            continue;
+            compare_result = ecma_is_value_true (result);
           }
 
-          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          goto compare_and_branch;
+        }
+        case VM_OC_GREATER:
+        {
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_GREATER, left_value, right_value, &compare_result)))
           {
-            ecma_number_t left_number = ecma_get_number_from_value (left_value);
-            ecma_number_t right_number = ecma_get_number_from_value (right_value);
-
-            *stack_top_p++ = ecma_make_boolean_value (left_number < right_number);
-            goto free_both_values;
-          }
+            result = opfunc_relation (left_value, right_value, false, false);
 
-          result = opfunc_relation (left_value, right_value, true, false);
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
 
-          if (ECMA_IS_VALUE_ERROR (result))
-          {
-            goto error;
+            compare_result = ecma_is_value_true (result);
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_and_branch;
         }
-        case VM_OC_GREATER:
+        case VM_OC_LESS_EQUAL:
         {
-          if (ecma_are_values_integer_numbers (left_value, right_value))
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_LESS_EQUAL, left_value, right_value, &compare_result)))
           {
-            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
-            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+            result = opfunc_relation (left_value, right_value, false, true);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer > right_integer);
-            continue;
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            compare_result = ecma_is_value_true (result);
           }
 
-          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          goto compare_and_branch;
+        }
+        case VM_OC_GREATER_EQUAL:
+        {
+          if (JERRY_UNLIKELY (!vm_compare_values (VM_OC_GREATER_EQUAL, left_value, right_value, &compare_result)))
           {
-            ecma_number_t left_number = ecma_get_number_from_value (left_value);
-            ecma_number_t right_number = ecma_get_number_from_value (right_value);
-
-            *stack_top_p++ = ecma_make_boolean_value (left_number > right_number);
-            goto free_both_values;
-          }
+            result = opfunc_relation (left_value, right_value, true, true);
 
-          result = opfunc_relation (left_value, right_value, false, false);
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
 
-          if (ECMA_IS_VALUE_ERROR (result))
-          {
-            goto error;
+            compare_result = ecma_is_value_true (result);
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
+          goto compare_and_branch;
         }
-        case VM_OC_LESS_EQUAL:
+compare_and_branch:
         {
-          if (ecma_are_values_integer_numbers (left_value, right_value))
-          {
-            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
-            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+          /* This is a lookahead to the next opcode to improve performance. If it is
+           * a conditional branch, it is executed without creating the boolean result. */
+          uint16_t branch_opcode_data = vm_decode_table[*byte_code_p];
+          uint32_t branch_opcode_group = VM_OC_GROUP_GET_INDEX (branch_opcode_data);
+          bool is_fused_branch = (branch_opcode_group == VM_OC_BRANCH_IF_TRUE
+                                  || branch_opcode_group == VM_OC_BRANCH_IF_FALSE);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_integer <= right_integer);
-            continue;
+#ifdef JERRY_VM_EXEC_STOP
+          /* Backward branches must call the execution stop callback. */
+          if ((branch_opcode_data & VM_OC_BACKWARD_BRANCH) && JERRY_CONTEXT (vm_exec_stop_cb) != NULL)
+          {
+            is_fused_branch = false;
           }
+#endif /* JERRY_VM_EXEC_STOP */
 
-          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+#ifdef JERRY_QUOTAS
+          /* Backward branches must check the quotas. */
+          if (branch_opcode_data & VM_OC_BACKWARD_BRANCH)
           {
-            ecma_number_t left_number = ecma_get_number_from_value (left_value);
-            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+            is_fused_branch = false;
+          }
+#endif /* JERRY_QUOTAS */
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number <= right_number);
+          if (!is_fused_branch)
+          {
+            *stack_top_p++ = ecma_make_boolean_value (compare_result);
             goto free_both_values;
           }
 
-          result = opfunc_relation (left_value, right_value, false, true);
+          byte_code_start_p = byte_code_p++;
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
+          JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
 
-          if (ECMA_IS_VALUE_ERROR (result))
+          if (branch_opcode_group == VM_OC_BRANCH_IF_FALSE)
           {
-            goto error;
+            compare_result = !compare_result;
           }
 
-          *stack_top_p++ = result;
-          goto free_both_values;
-        }
-        case VM_OC_GREATER_EQUAL:
-        {
-          if (ecma_are_values_integer_numbers (left_value, right_value))
+          if (!compare_result)
           {
-            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
-            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
-
-            *stack_top_p++ = ecma_make_boolean_value (left_integer >= right_integer);
-            continue;
+            byte_code_p += branch_offset_length;
+            goto free_both_values;
           }
 
-          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          branch_offset = *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length != 1))
           {
-            ecma_number_t left_number = ecma_get_number_from_value (left_value);
-            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
 
-            *stack_top_p++ = ecma_make_boolean_value (left_number >= right_number);
-            goto free_both_values;
+            if (JERRY_UNLIKELY (branch_offset_length == 3))
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
           }
 
-          result = opfunc_relation (left_value, right_value, true, true);
-
-          if (ECMA_IS_VALUE_ERROR (result))
+          if (branch_opcode_data & VM_OC_BACKWARD_BRANCH)
           {
-            goto error;
+#ifdef JERRY_JIT
+            if (vm_jit_backward_branch (frame_ctx_p))
+            {
+              jit_function_p = frame_ctx_p->jit_function_p;
+            }
+#endif /* JERRY_JIT */
+
+            branch_offset = -branch_offset;
           }
 
-          *stack_top_p++ = result;
+          byte_code_p = byte_code_start_p + branch_offset;
           goto free_both_values;
         }
         case VM_OC_IN:
@@ -2635,31 +4092,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #ifdef JERRY_ENABLE_LINE_INFO
         case VM_OC_RESOURCE_NAME:
         {
-          ecma_length_t formal_params_number = 0;
-
-          if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_NON_STRICT_ARGUMENTS_NEEDED)
-          {
-            if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
-            {
-              cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
-
-              formal_params_number = args_p->argument_end;
-            }
-            else
-            {
-              cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
-
-              formal_params_number = args_p->argument_end;
-            }
-          }
-
-          uint8_t *byte_p = (uint8_t *) bytecode_header_p;
-          byte_p += ((size_t) bytecode_header_p->size) << JMEM_ALIGNMENT_LOG;
-
-          ecma_value_t *resource_name_p = (ecma_value_t *) byte_p;
-          resource_name_p -= formal_params_number;
-
-          frame_ctx_p->resource_name = resource_name_p[-1];
+          frame_ctx_p->resource_name = vm_get_resource_name (bytecode_header_p);
           continue;
         }
         case VM_OC_LINE:
@@ -2987,8 +4420,19 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
   JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 
+#ifdef JERRY_TRACEPOINTS
+  if (JERRY_TRACEPOINT_ENABLED (function__entry))
+  {
+    vm_tracepoint_function (frame_ctx_p, false);
+  }
+#endif /* JERRY_TRACEPOINTS */
+
   vm_init_loop (frame_ctx_p);
 
+#ifdef JERRY_JIT
+  frame_ctx_p->jit_function_p = vm_jit_enter_function (frame_ctx_p);
+#endif /* JERRY_JIT */
+
   while (true)
   {
     completion_value = vm_loop (frame_ctx_p);
@@ -3015,6 +4459,13 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     ecma_fast_free_value (frame_ctx_p->registers_p[i]);
   }
 
+#ifdef JERRY_TRACEPOINTS
+  if (JERRY_TRACEPOINT_ENABLED (function__exit))
+  {
+    vm_tracepoint_function (frame_ctx_p, true);
+  }
+#endif /* JERRY_TRACEPOINTS */
+
 #ifdef JERRY_DEBUGGER
   if (JERRY_CONTEXT (debugger_stop_context) == JERRY_CONTEXT (vm_top_context_p))
   {
@@ -3084,7 +4535,24 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   JERRY_VLA (ecma_value_t, stack, JERRY_MAX (call_stack_size, 1));
   frame_ctx.registers_p = stack;
 
+#ifdef JERRY_QUOTAS
+  if (JERRY_CONTEXT (vm_call_depth) >= JERRY_CONTEXT (quota_call_depth_limit))
+  {
+    return vm_raise_quota_abort (ECMA_ERR_MSG ("Call depth quota exceeded."));
+  }
+
+  if (JERRY_UNLIKELY (ECMA_IS_VALUE_ERROR (vm_check_quotas ())))
+  {
+    return ECMA_VALUE_ERROR;
+  }
+
+  JERRY_CONTEXT (vm_call_depth)++;
+  ecma_value_t completion_value = vm_execute (&frame_ctx, arg_list_p, arg_list_len);
+  JERRY_CONTEXT (vm_call_depth)--;
+  return completion_value;
+#else /* !JERRY_QUOTAS */
   return vm_execute (&frame_ctx, arg_list_p, arg_list_len);
+#endif /* JERRY_QUOTAS */
 } /* vm_run */
 
 /**
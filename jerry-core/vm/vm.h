@@ -281,6 +281,8 @@ typedef enum
   VM_EXEC_CONSTRUCT,             /**< construct a new object */
 } vm_call_operation;
 
+extern const uint16_t vm_decode_table[];
+
 ecma_value_t vm_run_global (const ecma_compiled_code_t *bytecode_p);
 ecma_value_t vm_run_eval (ecma_compiled_code_t *bytecode_data_p, bool is_direct);
 
@@ -291,6 +293,11 @@ ecma_value_t vm_run (const ecma_compiled_code_t *bytecode_header_p, ecma_value_t
 bool vm_is_strict_mode (void);
 bool vm_is_direct_eval_form_call (void);
 
+#ifdef JERRY_ENABLE_LINE_INFO
+ecma_backtrace_t *vm_capture_backtrace (uint32_t max_depth);
+ecma_value_t vm_backtrace_to_array (const ecma_backtrace_t *backtrace_p);
+void vm_free_backtrace (ecma_backtrace_t *backtrace_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
 /**
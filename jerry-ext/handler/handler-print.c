@@ -20,7 +20,7 @@
  * Provide a 'print' implementation for scripts.
  *
  * The routine converts all of its arguments to strings and outputs them
- * char-by-char using jerryx_port_handler_print_char.
+ * in chunks using jerryx_port_handler_print_buffer.
  *
  * The NUL character is output as "\u0000", other characters are output
  * bytewise.
@@ -30,7 +30,7 @@
  *      output. This allows more flexibility but also extends the core
  *      JerryScript engine port API. Applications that want to use
  *      `jerryx_handler_print` must ensure that their port implementation also
- *      provides `jerryx_port_handler_print_char`.
+ *      provides `jerryx_port_handler_print_buffer`.
  *
  * @return undefined - if all arguments could be converted to strings,
  *         error - otherwise.
@@ -44,7 +44,7 @@ jerryx_handler_print (const jerry_value_t func_obj_val, /**< function object */
   (void) func_obj_val; /* unused */
   (void) this_p; /* unused */
 
-  static const char *null_str = "\\u0000";
+  static const char null_str[] = "\\u0000";
 
   jerry_value_t ret_val = jerry_create_undefined ();
 
@@ -58,39 +58,40 @@ jerryx_handler_print (const jerry_value_t func_obj_val, /**< function object */
     {
       if (arg_index != 0)
       {
-        jerryx_port_handler_print_char (' ');
+        jerryx_port_handler_print_buffer ((const jerry_char_t *) " ", 1);
       }
 
+      jerry_string_cursor_t cursor;
       jerry_size_t substr_size;
-      jerry_length_t substr_pos = 0;
       jerry_char_t substr_buf[256];
 
-      while ((substr_size = jerry_substring_to_char_buffer (str_val,
-                                                            substr_pos,
-                                                            substr_pos + 256,
-                                                            substr_buf,
-                                                            256)) != 0)
+      jerry_string_cursor_init (&cursor, str_val);
+
+      while ((substr_size = jerry_string_cursor_next (&cursor, substr_buf, sizeof (substr_buf))) != 0)
       {
 #ifdef JERRY_DEBUGGER
         jerry_debugger_send_output (substr_buf, substr_size, JERRY_DEBUGGER_OUTPUT_OK);
 #endif /* JERRY_DEBUGGER */
+        jerry_size_t start_index = 0;
+
         for (jerry_size_t chr_index = 0; chr_index < substr_size; chr_index++)
         {
-          char chr = (char) substr_buf[chr_index];
-          if (chr == '\0')
+          if (substr_buf[chr_index] == '\0')
           {
-            for (jerry_size_t null_index = 0; null_str[null_index] != 0; null_index++)
+            if (start_index < chr_index)
             {
-              jerryx_port_handler_print_char (null_str[null_index]);
+              jerryx_port_handler_print_buffer (substr_buf + start_index, chr_index - start_index);
             }
-          }
-          else
-          {
-            jerryx_port_handler_print_char (chr);
+
+            jerryx_port_handler_print_buffer ((const jerry_char_t *) null_str, sizeof (null_str) - 1);
+            start_index = chr_index + 1;
           }
         }
 
-        substr_pos += substr_size;
+        if (start_index < substr_size)
+        {
+          jerryx_port_handler_print_buffer (substr_buf + start_index, substr_size - start_index);
+        }
       }
 
       jerry_release_value (str_val);
@@ -101,7 +102,7 @@ jerryx_handler_print (const jerry_value_t func_obj_val, /**< function object */
     }
   }
 
-  jerryx_port_handler_print_char ('\n');
+  jerryx_port_handler_print_buffer ((const jerry_char_t *) "\n", 1);
 
   return ret_val;
 } /* jerryx_handler_print */
@@ -52,6 +52,14 @@ jerry_value_t jerryx_handler_print (const jerry_value_t func_obj_val, const jerr
  */
 void jerryx_port_handler_print_char (char c);
 
+/**
+ * Print a buffer of characters.
+ *
+ * @param buffer_p the characters to print.
+ * @param buffer_size the number of characters to print.
+ */
+void jerryx_port_handler_print_buffer (const jerry_char_t *buffer_p, jerry_size_t buffer_size);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -27,6 +27,21 @@
  */
 #define JERRY_BUFFER_SIZE (1048576)
 
+/**
+ * Maximum number of functions in an execution profile
+ */
+#define JERRY_MAX_PROFILE_SIZE (4096)
+
+/**
+ * Maximum size of an execution profile file
+ */
+#define JERRY_MAX_PROFILE_FILE_SIZE (JERRY_MAX_PROFILE_SIZE * 12)
+
+/**
+ * Number of times the entry functions are loaded when the load time is measured
+ */
+#define JERRY_LOAD_TIME_ITERATIONS (100)
+
 /**
  * Standalone Jerry exit codes
  */
@@ -501,6 +516,375 @@ process_merge (cli_state_t *cli_state_p, /**< cli state */
   return JERRY_STANDALONE_EXIT_CODE_OK;
 } /* process_merge */
 
+/**
+ * Optimize command line option IDs
+ */
+typedef enum
+{
+  OPT_OPTIMIZE_HELP,
+  OPT_OPTIMIZE_ENTRY,
+  OPT_OPTIMIZE_PROFILE,
+  OPT_OPTIMIZE_OUT,
+} optimize_opt_id_t;
+
+/**
+ * Optimize command line options
+ */
+static const cli_opt_t optimize_opts[] =
+{
+  CLI_OPT_DEF (.id = OPT_OPTIMIZE_HELP, .opt = "h", .longopt = "help",
+               .help = "print this help and exit"),
+  CLI_OPT_DEF (.id = OPT_OPTIMIZE_ENTRY, .opt = "e", .longopt = "entry", .meta = "NUM",
+               .help = "keep the function with the given index and the functions reachable from it "
+                       "(can be repeated, default: all functions)"),
+  CLI_OPT_DEF (.id = OPT_OPTIMIZE_PROFILE, .opt = "p", .longopt = "profile", .meta = "FILE",
+               .help = "order the functions by an execution profile (function indices in order of execution)"),
+  CLI_OPT_DEF (.id = OPT_OPTIMIZE_OUT, .opt = "o", .meta = "FILE",
+               .help = "specify output file name (default: js.snapshot)"),
+  CLI_OPT_DEF (.id = CLI_OPT_DEFAULT, .meta = "FILE",
+               .help = "input snapshot files")
+};
+
+/**
+ * Read an execution profile: a list of function indices separated by white spaces.
+ *
+ * @return number of function indices - if loading is successful
+ *         -1 - otherwise
+ */
+static int
+read_profile (const char *file_name, /**< file name */
+              uint32_t *profile_p) /**< [out] function indices */
+{
+  FILE *file = fopen (file_name, "r");
+
+  if (file == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name);
+    return -1;
+  }
+
+  static char profile_text[JERRY_MAX_PROFILE_FILE_SIZE];
+
+  size_t text_size = fread (profile_text, 1u, sizeof (profile_text), file);
+  fclose (file);
+
+  if (text_size == sizeof (profile_text))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: profile too large: %s\n", file_name);
+    return -1;
+  }
+
+  int profile_size = 0;
+  size_t pos = 0;
+
+  while (true)
+  {
+    while (pos < text_size
+           && (profile_text[pos] == ' ' || profile_text[pos] == '\t'
+               || profile_text[pos] == '\r' || profile_text[pos] == '\n'))
+    {
+      pos++;
+    }
+
+    if (pos == text_size)
+    {
+      break;
+    }
+
+    if (profile_text[pos] < '0' || profile_text[pos] > '9')
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: invalid profile: %s\n", file_name);
+      return -1;
+    }
+
+    uint32_t func_index = 0;
+
+    while (pos < text_size && profile_text[pos] >= '0' && profile_text[pos] <= '9')
+    {
+      uint32_t digit = (uint32_t) (profile_text[pos++] - '0');
+
+      if (func_index > (UINT32_MAX - digit) / 10)
+      {
+        jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: invalid profile: %s\n", file_name);
+        return -1;
+      }
+
+      func_index = func_index * 10 + digit;
+    }
+
+    if (profile_size == JERRY_MAX_PROFILE_SIZE)
+    {
+      jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: profile too large: %s\n", file_name);
+      return -1;
+    }
+
+    profile_p[profile_size++] = func_index;
+  }
+
+  return profile_size;
+} /* read_profile */
+
+/**
+ * Measure the time of loading the entry functions of snapshots. The function
+ * indices are in the merged index space of the snapshots.
+ *
+ * @return load time in microseconds - if all functions are loaded successfully
+ *         -1 - otherwise
+ */
+static long
+measure_load_time (const uint32_t **buffers_p, /**< snapshot buffers */
+                   size_t *buffer_sizes_p, /**< snapshot buffer sizes */
+                   size_t number_of_buffers, /**< number of snapshot buffers */
+                   const uint32_t *entry_funcs_p, /**< entry function indices, NULL means all functions */
+                   size_t number_of_entry_funcs) /**< number of entry functions */
+{
+  const uint32_t exec_flags = JERRY_SNAPSHOT_EXEC_ALLOW_STATIC;
+  size_t func_counts[number_of_buffers];
+  size_t number_of_funcs = 0;
+
+  /* The number of functions is the index of the first function which cannot be loaded. */
+  for (size_t i = 0; i < number_of_buffers; i++)
+  {
+    func_counts[i] = 0;
+
+    while (true)
+    {
+      jerry_value_t func = jerry_load_function_snapshot (buffers_p[i], buffer_sizes_p[i], func_counts[i], exec_flags);
+      bool is_error = jerry_value_is_error (func);
+      jerry_release_value (func);
+
+      if (is_error)
+      {
+        break;
+      }
+
+      func_counts[i]++;
+    }
+
+    number_of_funcs += func_counts[i];
+  }
+
+  if (entry_funcs_p == NULL)
+  {
+    number_of_entry_funcs = number_of_funcs;
+  }
+
+  double start_time = jerry_port_get_current_time ();
+
+  for (int iteration = 0; iteration < JERRY_LOAD_TIME_ITERATIONS; iteration++)
+  {
+    for (size_t i = 0; i < number_of_entry_funcs; i++)
+    {
+      size_t func_index = (entry_funcs_p != NULL) ? entry_funcs_p[i] : i;
+      size_t buffer_index = 0;
+
+      while (buffer_index < number_of_buffers && func_index >= func_counts[buffer_index])
+      {
+        func_index -= func_counts[buffer_index];
+        buffer_index++;
+      }
+
+      if (buffer_index == number_of_buffers)
+      {
+        return -1;
+      }
+
+      jerry_value_t func = jerry_load_function_snapshot (buffers_p[buffer_index],
+                                                         buffer_sizes_p[buffer_index],
+                                                         func_index,
+                                                         exec_flags);
+      bool is_error = jerry_value_is_error (func);
+      jerry_release_value (func);
+
+      if (is_error)
+      {
+        return -1;
+      }
+    }
+  }
+
+  double load_time = (jerry_port_get_current_time () - start_time) / JERRY_LOAD_TIME_ITERATIONS;
+
+  /* Loaded functions may refer to the snapshot buffers. */
+  jerry_gc ();
+  return (long) (load_time * 1000.0);
+} /* measure_load_time */
+
+/**
+ * Process 'optimize' command.
+ *
+ * @return error code (0 - no error)
+ */
+static int
+process_optimize (cli_state_t *cli_state_p, /**< cli state */
+                  int argc, /**< number of arguments */
+                  char *prog_name_p) /**< program name */
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  uint8_t *input_pos_p = input_buffer;
+
+  cli_change_opts (cli_state_p, optimize_opts);
+
+  const uint32_t *optimize_buffers[argc];
+  size_t optimize_buffer_sizes[argc];
+  uint32_t number_of_files = 0;
+  size_t input_size = 0;
+
+  uint32_t entry_funcs[argc];
+  uint32_t number_of_entry_funcs = 0;
+
+  static uint32_t profile[JERRY_MAX_PROFILE_SIZE];
+  int profile_size = 0;
+
+  for (int id = cli_consume_option (cli_state_p); id != CLI_OPT_END; id = cli_consume_option (cli_state_p))
+  {
+    switch (id)
+    {
+      case OPT_OPTIMIZE_HELP:
+      {
+        cli_help (prog_name_p, "optimize", optimize_opts);
+        return JERRY_STANDALONE_EXIT_CODE_OK;
+      }
+      case OPT_OPTIMIZE_ENTRY:
+      {
+        int func_index = cli_consume_int (cli_state_p);
+
+        if (cli_state_p->error == NULL && func_index < 0)
+        {
+          cli_state_p->error = "Function index must be positive";
+        }
+
+        entry_funcs[number_of_entry_funcs++] = (uint32_t) func_index;
+        break;
+      }
+      case OPT_OPTIMIZE_PROFILE:
+      {
+        const char *profile_file_name_p = cli_consume_string (cli_state_p);
+
+        if (cli_state_p->error == NULL)
+        {
+          profile_size = read_profile (profile_file_name_p, profile);
+
+          if (profile_size < 0)
+          {
+            return JERRY_STANDALONE_EXIT_CODE_FAIL;
+          }
+        }
+        break;
+      }
+      case OPT_OPTIMIZE_OUT:
+      {
+        output_file_name_p = cli_consume_string (cli_state_p);
+        break;
+      }
+      case CLI_OPT_DEFAULT:
+      {
+        const char *file_name_p = cli_consume_string (cli_state_p);
+
+        if (cli_state_p->error == NULL)
+        {
+          size_t size = read_file (input_pos_p, file_name_p);
+
+          if (size == 0)
+          {
+            return JERRY_STANDALONE_EXIT_CODE_FAIL;
+          }
+
+          optimize_buffers[number_of_files] = (const uint32_t *) input_pos_p;
+          optimize_buffer_sizes[number_of_files] = size;
+          input_size += size;
+
+          number_of_files++;
+          const uintptr_t mask = sizeof (uint32_t) - 1;
+          input_pos_p = (uint8_t *) ((((uintptr_t) input_pos_p) + size + mask) & ~mask);
+        }
+        break;
+      }
+      default:
+      {
+        cli_state_p->error = "Internal error";
+        break;
+      }
+    }
+  }
+
+  if (check_cli_error (cli_state_p))
+  {
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  if (number_of_files < 1)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: at least one input file must be passed.\n");
+
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  const uint32_t *entry_funcs_p = (number_of_entry_funcs > 0) ? entry_funcs : NULL;
+  bool measure_load = jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC);
+  long input_load_time = -1;
+
+  /* The optimizer resolves the literals of the input buffers, so they must be loaded before. */
+  if (measure_load)
+  {
+    input_load_time = measure_load_time (optimize_buffers,
+                                         optimize_buffer_sizes,
+                                         number_of_files,
+                                         entry_funcs_p,
+                                         number_of_entry_funcs);
+  }
+
+  const char *error_p;
+  size_t size = jerry_optimize_snapshots (optimize_buffers,
+                                          optimize_buffer_sizes,
+                                          number_of_files,
+                                          entry_funcs_p,
+                                          number_of_entry_funcs,
+                                          profile,
+                                          (size_t) profile_size,
+                                          output_buffer,
+                                          JERRY_BUFFER_SIZE,
+                                          &error_p);
+
+  if (size == 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: %s\n", error_p);
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  FILE *file_p = fopen (output_file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: cannot open file: '%s'\n", output_file_name_p);
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  fwrite (output_buffer, 1u, size, file_p);
+  fclose (file_p);
+
+  printf ("Created snapshot file: '%s' (%lu bytes, %+ld bytes compared to the input)\n",
+          output_file_name_p,
+          (unsigned long) size,
+          (long) size - (long) input_size);
+
+  if (measure_load)
+  {
+    const uint32_t *output_buffer_p = output_buffer;
+    long output_load_time = measure_load_time (&output_buffer_p, &size, 1, NULL, 0);
+
+    if (input_load_time >= 0 && output_load_time >= 0)
+    {
+      printf ("Load time of the entry functions: %ld us (%+ld us compared to the input)\n",
+              output_load_time,
+              output_load_time - input_load_time);
+    }
+  }
+
+  return JERRY_STANDALONE_EXIT_CODE_OK;
+} /* process_optimize */
+
 /**
  * Command line option IDs
  */
@@ -531,6 +915,7 @@ print_commands (char *prog_name_p) /**< program name */
   printf ("\nAvailable commands:\n"
           "  generate\n"
           "  merge\n"
+          "  optimize\n"
           "\nPassing -h or --help after a command displays its help.\n");
 } /* print_commands */
 
@@ -571,6 +956,10 @@ main (int argc, /**< number of arguments */
         {
           return process_generate (&cli_state, argc, argv[0]);
         }
+        else if (!strcmp ("optimize", command_p))
+        {
+          return process_optimize (&cli_state, argc, argv[0]);
+        }
 
         jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: unknown command: %s\n\n", command_p);
         print_commands (argv[0]);
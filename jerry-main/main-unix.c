@@ -46,6 +46,11 @@
  */
 #define SYNTAX_ERROR_CONTEXT_SIZE 2
 
+/**
+ * Size of the chunks in which the source context of a syntax error is logged
+ */
+#define SYNTAX_ERROR_CONTEXT_CHUNK_SIZE 128
+
 static uint8_t buffer[ JERRY_BUFFER_SIZE ];
 
 static const uint32_t *
@@ -81,6 +86,29 @@ read_file (const char *file_name,
   return (const uint32_t *) buffer;
 } /* read_file */
 
+/**
+ * Log a part of the source code in chunks. A precision field would limit
+ * the length of the output, but jerry-libc's printf does not support it.
+ */
+static void
+log_source_part (const jerry_char_t *source_p, /**< source code */
+                 size_t size) /**< number of bytes to log */
+{
+  char chunk[SYNTAX_ERROR_CONTEXT_CHUNK_SIZE + 1];
+
+  while (size > 0)
+  {
+    size_t chunk_size = (size < SYNTAX_ERROR_CONTEXT_CHUNK_SIZE) ? size : SYNTAX_ERROR_CONTEXT_CHUNK_SIZE;
+
+    memcpy (chunk, source_p, chunk_size);
+    chunk[chunk_size] = '\0';
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "%s", chunk);
+
+    source_p += chunk_size;
+    size -= chunk_size;
+  }
+} /* log_source_part */
+
 /**
  * Print error value
  */
@@ -207,6 +235,7 @@ print_unhandled_exception (jerry_value_t error_value) /**< error value */
 
         bool is_printing_context = false;
         unsigned int pos = 0;
+        unsigned int context_start = 0;
 
         /* 2. seek and print */
         while (buffer[pos] != '\0')
@@ -221,6 +250,11 @@ print_unhandled_exception (jerry_value_t error_value) /**< error value */
                   && (err_line - curr_line) <= SYNTAX_ERROR_CONTEXT_SIZE))
           {
             /* context must be printed */
+            if (!is_printing_context)
+            {
+              context_start = pos;
+            }
+
             is_printing_context = true;
           }
 
@@ -229,14 +263,15 @@ print_unhandled_exception (jerry_value_t error_value) /**< error value */
             break;
           }
 
-          if (is_printing_context)
-          {
-            jerry_port_log (JERRY_LOG_LEVEL_ERROR, "%c", buffer[pos]);
-          }
-
           pos++;
         }
 
+        if (is_printing_context)
+        {
+          /* print the context in chunks instead of one character at a time */
+          log_source_part (buffer + context_start, pos - context_start);
+        }
+
         jerry_port_log (JERRY_LOG_LEVEL_ERROR, "\n");
 
         while (--err_col)
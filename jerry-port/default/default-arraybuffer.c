@@ -0,0 +1,46 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+
+#include <stdlib.h>
+
+/**
+ * Default implementation of jerry_port_arraybuffer_alloc. Uses 'malloc'.
+ *
+ * @return pointer to the allocated block - if success,
+ *         NULL - otherwise
+ */
+void *
+jerry_port_arraybuffer_alloc (size_t size) /**< size of the block */
+{
+  return malloc (size);
+} /* jerry_port_arraybuffer_alloc */
+
+/**
+ * Default implementation of jerry_port_arraybuffer_free. Uses 'free'.
+ */
+void
+jerry_port_arraybuffer_free (void *buffer_p, /**< block to free */
+                             size_t size) /**< size of the block */
+{
+  (void) size;
+  free (buffer_p);
+} /* jerry_port_arraybuffer_free */
+
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
@@ -16,19 +16,32 @@
 #include "jerryscript-port.h"
 #include "jerryscript-port-default.h"
 
+#ifdef JERRY_ENABLE_EXTERNAL_CONTEXT_TLS
+/**
+ * The current instance pointer is read directly by jerry-core.
+ */
+#define JERRY_PORT_INSTANCE_STORAGE
+#else /* !JERRY_ENABLE_EXTERNAL_CONTEXT_TLS */
+/**
+ * The current instance pointer is only accessed by this file.
+ */
+#define JERRY_PORT_INSTANCE_STORAGE static
+#endif /* JERRY_ENABLE_EXTERNAL_CONTEXT_TLS */
+
 /**
  * Pointer to the current instance.
- * Note that it is a global variable, and is not a thread safe implementation.
+ * Note that it is thread local when the compiler supports it, so each thread can
+ * run (or compile scripts in, see jerry_compile_snapshot) its own instance.
  */
-static jerry_instance_t *current_instance_p = NULL;
+JERRY_PORT_INSTANCE_STORAGE JERRY_ATTR_THREAD_LOCAL jerry_instance_t *jerry_port_current_instance_p = NULL;
 
 /**
- * Set the current_instance_p as the passed pointer.
+ * Set the jerry_port_current_instance_p as the passed pointer for the calling thread.
  */
 void
 jerry_port_default_set_instance (jerry_instance_t *instance_p) /**< points to the created instance */
 {
-  current_instance_p = instance_p;
+  jerry_port_current_instance_p = instance_p;
 } /* jerry_port_default_set_instance */
 
 /**
@@ -39,5 +52,5 @@ jerry_port_default_set_instance (jerry_instance_t *instance_p) /**< points to th
 jerry_instance_t *
 jerry_port_get_current_instance (void)
 {
-  return current_instance_p;
+  return jerry_port_current_instance_p;
 } /* jerry_port_get_current_instance */
@@ -0,0 +1,62 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+#ifdef JERRY_JIT
+
+#include <sys/mman.h>
+
+/**
+ * Default implementation of jerry_port_jit_alloc. Maps anonymous
+ * read-write pages with 'mmap'.
+ *
+ * @return pointer to the allocated block - if success,
+ *         NULL - otherwise
+ */
+void *
+jerry_port_jit_alloc (size_t size) /**< size of the block */
+{
+  void *code_p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+  return (code_p != MAP_FAILED) ? code_p : NULL;
+} /* jerry_port_jit_alloc */
+
+/**
+ * Default implementation of jerry_port_jit_protect. Changes the protection
+ * of the pages to read-execute with 'mprotect'.
+ *
+ * @return true - if success,
+ *         false - otherwise
+ */
+bool
+jerry_port_jit_protect (void *code_p, /**< block to protect */
+                        size_t size) /**< size of the block */
+{
+  return mprotect (code_p, size, PROT_READ | PROT_EXEC) == 0;
+} /* jerry_port_jit_protect */
+
+/**
+ * Default implementation of jerry_port_jit_free. Unmaps the pages with 'munmap'.
+ */
+void
+jerry_port_jit_free (void *code_p, /**< block to free */
+                     size_t size) /**< size of the block */
+{
+  munmap (code_p, size);
+} /* jerry_port_jit_free */
+
+#endif /* JERRY_JIT */
@@ -26,3 +26,14 @@ jerryx_port_handler_print_char (char c) /**< the character to print */
 {
   printf ("%c", c);
 } /* jerryx_port_handler_print_char */
+
+/**
+ * Default implementation of jerryx_port_handler_print_buffer. Uses 'fwrite' to
+ * print the characters to standard output.
+ */
+void
+jerryx_port_handler_print_buffer (const jerry_char_t *buffer_p, /**< the characters to print */
+                                  jerry_size_t buffer_size) /**< the number of characters to print */
+{
+  fwrite (buffer_p, 1, buffer_size, stdout);
+} /* jerryx_port_handler_print_buffer */
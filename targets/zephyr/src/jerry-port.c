@@ -82,3 +82,14 @@ jerryx_port_handler_print_char (char c) /**< the character to print */
 {
   printf ("%c", c);
 } /* jerryx_port_handler_print_char */
+
+/**
+ * Provide the implementation of jerryx_port_handler_print_buffer.
+ * Uses 'printf' to print the characters to standard output.
+ */
+void
+jerryx_port_handler_print_buffer (const jerry_char_t *buffer_p, /**< the characters to print */
+                                  jerry_size_t buffer_size) /**< the number of characters to print */
+{
+  printf ("%.*s", (int) buffer_size, (const char *) buffer_p);
+} /* jerryx_port_handler_print_buffer */
@@ -0,0 +1,114 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var values = [
+  0, -0, 1, -1, 7, 2147483647, -2147483648, 1.5, -2.25, 1e300, NaN, Infinity, -Infinity,
+  "", "0", "1", "a", "ab", "b", "á", "𝌆", "10", "9",
+  true, false, null, undefined,
+  { valueOf: function () { return 1; } },
+  { toString: function () { return "a"; } }
+];
+
+// The result of a comparison which is stored is compared against the result of the
+// same comparison when it is followed by a conditional branch.
+function check (a, b) {
+  var less = a < b;
+  var greater = a > b;
+  var less_equal = a <= b;
+  var greater_equal = a >= b;
+  var equal = a == b;
+  var not_equal = a != b;
+  var strict_equal = a === b;
+  var strict_not_equal = a !== b;
+
+  assert (typeof less === "boolean");
+  assert (not_equal === !equal);
+  assert (strict_not_equal === !strict_equal);
+
+  if (a < b) { assert (less); } else { assert (!less); }
+  if (a > b) { assert (greater); } else { assert (!greater); }
+  if (a <= b) { assert (less_equal); } else { assert (!less_equal); }
+  if (a >= b) { assert (greater_equal); } else { assert (!greater_equal); }
+  if (a == b) { assert (equal); } else { assert (!equal); }
+  if (a != b) { assert (not_equal); } else { assert (!not_equal); }
+  if (a === b) { assert (strict_equal); } else { assert (!strict_equal); }
+  if (a !== b) { assert (strict_not_equal); } else { assert (!strict_not_equal); }
+
+  if (!(a < b)) { assert (!less); } else { assert (less); }
+  if (!(a == b)) { assert (!equal); } else { assert (equal); }
+
+  var count = 0;
+  while (a < b && count < 2) { count++; }
+  assert (count === (less ? 2 : 0));
+
+  count = 0;
+  do { count++; } while (a >= b && count < 2);
+  assert (count === (greater_equal ? 2 : 1));
+
+  count = 0;
+  for (var i = 0; a !== b && i < 3; i++) { count++; }
+  assert (count === (strict_not_equal ? 3 : 0));
+}
+
+for (var i = 0; i < values.length; i++) {
+  for (var j = 0; j < values.length; j++) {
+    check (values[i], values[j]);
+  }
+}
+
+// Fast path results.
+assert (1 < 2 && !(2 < 1) && 2 <= 2 && 3 >= 3 && 3 > -3);
+assert (!(NaN < 1) && !(NaN >= 1) && !(NaN == NaN) && NaN != NaN);
+assert (0 === -0 && 0 == -0 && !(0 < -0));
+assert ("a" < "b" && "ab" > "a" && "10" < "9" && "a" <= "a" && !("b" <= "a"));
+assert ("á" > "z" && "ab" === "a" + "b");
+assert (false < true && true >= true && !(true > true) && true == true && true != false);
+assert (null == undefined && undefined == null && null != 0 && undefined != false);
+assert (!(null === undefined) && null !== undefined);
+assert ("" != null && !({} == null) && !(null == {}));
+
+// Generic comparisons: conversions are performed in order.
+var log = "";
+var left = { valueOf: function () { log += "l"; return 2; } };
+var right = { valueOf: function () { log += "r"; return 3; } };
+
+if (left < right) { log += "<"; }
+if (left > right) { log += ">"; }
+if (left == 2) { log += "="; }
+assert (log === "lr<lrl=");
+
+// Mixed types are converted.
+assert (1 == "1" && 1 == true && "1" == true && !(1 === "1"));
+assert ("2" > 1 && "a" < 1 === false && 2 >= "2");
+
+// Exceptions thrown during the comparison are not lost by the branch.
+var thrower = { valueOf: function () { throw new Error ("compare"); } };
+
+try {
+  if (thrower < 1) {
+    assert (false);
+  }
+  assert (false);
+} catch (e) {
+  assert (e.message === "compare");
+}
+
+try {
+  while (1 == thrower) {
+    assert (false);
+  }
+  assert (false);
+} catch (e) {
+  assert (e.message === "compare");
+}
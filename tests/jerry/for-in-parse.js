@@ -42,3 +42,13 @@ var forIn =
   "foreach (var prop in obj)" +
   "   obj[prop] += 4;"
 parse (forIn)
+
+var forIn =
+  "for (var prop, other in obj)" +
+  "   obj[prop] += 4;"
+parse (forIn)
+
+var forIn =
+  "for (prop in obj; ;)" +
+  "   obj[prop] += 4;"
+parse (forIn)
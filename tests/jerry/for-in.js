@@ -281,3 +281,31 @@ assert(count == 1
            || 'base_prop2' in log
            || 'derived_prop1' in log
            || 'derived_prop2' in log));
+
+// 18.
+log = [];
+var target = {};
+var index = 0;
+
+for (target[index++] in { a: 1, b: 2 }) {
+  log.push(target[index - 1]);
+}
+
+assert(log.join() == "a,b" && index == 2);
+
+// 19.
+log = [];
+
+for (var init_prop = ("a" in base_obj) ? "x" : "y" in { c: 1 }) {
+  log.push(init_prop);
+}
+
+for (var in_prop = 0, in_result = ("c" in { c: 1 }); in_prop < 1; in_prop++) {
+  log.push(in_result);
+}
+
+for (("c" in { c: 1 }) ? log.push("t") : log.push("f"); log.length < 4;) {
+  log.push(index);
+}
+
+assert(log.join() == "c,true,t,2");
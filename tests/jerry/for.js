@@ -81,3 +81,39 @@ a = [];
 for (; a[0]; ) {
   assert (false);
 }
+
+/* The update and condition parts are evaluated after the body. */
+var log = '';
+for (var i = 0, j = 3; (log += 'c', i < j); log += 'u', i++) {
+  log += 'b';
+}
+assert (log === 'cbucbucbuc');
+
+var n = 0;
+for (;!(n >= 5);) {
+  n++;
+}
+assert (n === 5);
+
+n = 0;
+for (;; n++) {
+  if (n == 7) {
+    break;
+  }
+}
+assert (n === 7);
+
+n = 0;
+while (!(n == 3)) {
+  n++;
+  while (true) {
+    break;
+  }
+}
+assert (n === 3);
+
+n = 0;
+do {
+  n++;
+} while (n < 4 && (function () { var k = 0; while (k < 2) k++; return k == 2; }) ());
+assert (n === 4);
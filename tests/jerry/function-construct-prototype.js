@@ -0,0 +1,111 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The prototype of new instances must follow the changes of the prototype property.
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+var proto1 = Point.prototype;
+var p1 = new Point (1, 2);
+var p2 = new Point (3, 4);
+assert (Object.getPrototypeOf (p1) === proto1);
+assert (Object.getPrototypeOf (p2) === proto1);
+
+var proto2 = { sum: function () { return this.x + this.y; } };
+Point.prototype = proto2;
+var p3 = new Point (5, 6);
+assert (Object.getPrototypeOf (p3) === proto2);
+assert (p3.sum () === 11);
+assert (!(p1 instanceof Point));
+assert (p3 instanceof Point);
+
+Point.prototype = 5;
+var p4 = new Point (7, 8);
+assert (Object.getPrototypeOf (p4) === Object.prototype);
+
+Object.defineProperty (Point, "prototype", { value: proto1 });
+var p5 = new Point (9, 10);
+assert (Object.getPrototypeOf (p5) === proto1);
+
+Object.defineProperty (Point, "prototype", { writable: false });
+Point.prototype = proto2;
+assert (Object.getPrototypeOf (new Point (0, 0)) === proto1);
+
+// Constructors which are used alternately.
+function A () { this.a = 1; }
+function B () { this.b = 2; }
+
+for (var i = 0; i < 20; i++) {
+  var a = new A ();
+  var b = new B ();
+  assert (a instanceof A && !(a instanceof B) && a.a === 1);
+  assert (b instanceof B && !(b instanceof A) && b.b === 2);
+
+  if (i == 10) {
+    A.prototype = { c: 3 };
+  }
+
+  assert ((new A ()).c === (i >= 10 ? 3 : undefined));
+}
+
+// Large instances must keep the property order.
+function Big (n) {
+  for (var i = 0; i < n; i++) {
+    this["p" + i] = i;
+  }
+}
+
+function checkBig (obj, n) {
+  var keys = Object.keys (obj);
+  assert (keys.length === n);
+
+  for (var i = 0; i < n; i++) {
+    assert (keys[i] === "p" + i);
+    assert (obj["p" + i] === i);
+  }
+
+  var i = 0;
+  for (var name in obj) {
+    assert (name === "p" + i);
+    i++;
+  }
+  assert (i === n);
+}
+
+checkBig (new Big (50), 50);
+checkBig (new Big (50), 50);
+checkBig (new Big (51), 51);
+checkBig (new Big (80), 80);
+checkBig (new Big (3), 3);
+checkBig (new Big (40), 40);
+
+var big = new Big (40);
+delete big.p10;
+assert (!big.hasOwnProperty ("p10"));
+big.p10 = "x";
+assert (big.p10 === "x" && big.p39 === 39);
+
+// Constructors returning another object.
+function Other (n) {
+  Big.call (this, n);
+  return { other: true };
+}
+
+for (var i = 0; i < 3; i++) {
+  var o = new Other (40);
+  assert (o.other === true);
+  assert (Object.keys (o).length === 1);
+}
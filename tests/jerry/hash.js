@@ -22,3 +22,111 @@ assert (a[12345] === 1);
 assert (a[1] === 2);
 assert (a[13345] === 3);
 assert (a['sss45'] === 4);
+
+/* Objects with property hashmap: deleted entries and enumeration order. */
+var cache = {};
+var i, j;
+
+for (i = 0; i < 64; i++) {
+  cache['key' + i] = i;
+}
+
+for (j = 0; j < 8; j++) {
+  for (i = j; i < 64; i += 2) {
+    assert (delete cache['key' + i]);
+    assert (!cache.hasOwnProperty ('key' + i));
+  }
+
+  for (i = j; i < 64; i += 2) {
+    cache['key' + i] = i * j;
+    assert (cache['key' + i] === i * j);
+  }
+}
+
+assert (Object.keys (cache).length === 64);
+
+for (i = 0; i < 64; i++) {
+  assert (delete cache['key' + i]);
+}
+
+assert (Object.keys (cache).length === 0);
+
+for (i = 0; i < 200; i++) {
+  cache['new' + i] = i;
+  Object.defineProperty (cache, 'acc' + i, { get: function () { return 5; }, configurable: true });
+  assert (cache['new' + i] === i);
+  assert (cache['acc' + i] === 5);
+  if (i % 3 == 0) {
+    assert (delete cache['acc' + i]);
+  }
+}
+
+var count = 0;
+for (var name in cache) {
+  count++;
+}
+assert (count === 200);
+assert (Object.getOwnPropertyNames (cache).length === 200 + 133);
+
+var arr = [];
+for (i = 0; i < 100; i++) {
+  arr[i] = i;
+  arr['p' + i] = i;
+}
+
+arr.length = 10;
+assert (arr[9] === 9);
+assert (arr[10] === undefined);
+assert (arr.p99 === 99);
+
+for (i = 10; i < 100; i++) {
+  arr['q' + i] = i;
+  assert (arr['q' + i] === i);
+}
+assert (Object.keys (arr).length === 10 + 100 + 90);
+
+function check_keys (obj, expected) {
+  var keys = Object.keys (obj);
+  assert (keys.length === expected.length);
+  for (var k = 0; k < keys.length; k++) {
+    assert (keys[k] === expected[k]);
+  }
+}
+
+var d = {};
+var expected = [];
+for (i = 0; i < 60; i++) {
+  d['p' + i] = i;
+  if (i != 10) {
+    expected.push ('p' + i);
+  }
+}
+
+delete d.p10;
+d.zz = 1;
+d.p10 = 2;
+expected.push ('zz', 'p10');
+check_keys (d, expected);
+
+for (i = 20; i < 25; i++) {
+  assert (delete d['p' + i]);
+  expected.splice (expected.indexOf ('p' + i), 1);
+}
+
+d.a = 1;
+d.b = 2;
+expected.push ('a', 'b');
+check_keys (d, expected);
+
+/* Enough deletes to rehash the hashmap several times. */
+for (j = 0; j < 400; j++) {
+  var name = expected[j % 7];
+  assert (delete d[name]);
+  expected.splice (j % 7, 1);
+  d[name] = j;
+  expected.push (name);
+  d['n' + j] = j;
+  assert (delete d['n' + j]);
+}
+
+check_keys (d, expected);
@@ -0,0 +1,69 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Small integers are stored directly in the values, the operations
+ * must continue with numbers when the result leaves that range. */
+
+function add (a, b) { return a + b; }
+function sub (a, b) { return a - b; }
+function mul (a, b) { return a * b; }
+function mod (a, b) { return a % b; }
+
+for (var i = 0; i < 3; i++) {
+  var big = 134217727;
+
+  assert (add (big, 1) === 134217728);
+  assert (add (-big, -2) === -134217729);
+  assert (sub (-big, 2) === -134217729);
+  assert (sub (big, -1) === 134217728);
+  assert (mul (big, 8) === 1073741816);
+  assert (mul (65536, 65536) === 4294967296);
+  assert (1 / mul (0, -5) === -Infinity);
+  assert (1 / mul (-3, 0) === -Infinity);
+  assert (1 / mod (-4, 2) === -Infinity);
+  assert (mod (7, -3) === 1);
+  assert (isNaN (mod (7, 0)));
+  assert (add (1, 0.5) === 1.5);
+  assert (add ("1", 2) === "12");
+
+  assert ((big | 1) === big);
+  assert ((-1 >>> 0) === 4294967295);
+  assert ((1 << 31) === -2147483648);
+  assert ((1 << 32) === 1);
+  assert ((-big >> 28) === -1);
+  assert ((5 ^ 3) === 6);
+  assert (~big === -134217728);
+  assert (~-1 === 0);
+
+  var n = big;
+  n++;
+  assert (n === 134217728);
+  n = -big - 1;
+  n--;
+  assert (n === -134217729);
+
+  var o = { v: big };
+  assert (o.v++ === big);
+  assert (o.v === 134217728);
+  assert (++o.v === 134217729);
+  o.v = "5";
+  assert (o.v-- === 5);
+  assert (o.v === 4);
+
+  var s = 0;
+  for (var k = 0; k < 1000; k++) {
+    s += k;
+  }
+  assert (s === 499500);
+}
@@ -0,0 +1,223 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Small and large integer keys, accessed with numbers and strings.
+var obj = {};
+var keys = [0, 7, 65535, 65536, 100000, 5000000, 134217728, 4294967294];
+
+for (var i = 0; i < keys.length; i++) {
+  obj[keys[i]] = i;
+}
+
+for (var i = 0; i < keys.length; i++) {
+  assert (obj[keys[i]] === i);
+  assert (obj[String (keys[i])] === i);
+  assert (obj.hasOwnProperty (keys[i]));
+}
+
+assert (obj[4294967295] === undefined);
+obj[4294967295] = "not an index";
+obj[1.5] = "fraction";
+obj[-1] = "negative";
+obj.name = "string";
+
+assert (obj["4294967295"] === "not an index");
+assert (obj["1.5"] === "fraction");
+assert (obj["-1"] === "negative");
+
+// Index names are enumerated in ascending order, followed by the other names.
+assert (JSON.stringify (Object.keys (obj)) ===
+        '["0","7","65535","65536","100000","5000000","134217728","4294967294",' +
+        '"4294967295","1.5","-1","name"]');
+
+var names = [];
+for (var name in obj) {
+  names.push (name);
+}
+assert (names.join () === Object.keys (obj).join ());
+
+// Update, increment and compound assignment.
+obj[5000000] = "five million";
+assert (obj[5000000] === "five million");
+obj[100000]++;
+++obj[100000];
+obj[100000] += 10;
+obj[5e6] += "!";
+assert (obj[100000] === 16);
+assert (obj[5000000] === "five million!");
+
+// Delete.
+assert (delete obj[65536]);
+assert (!obj.hasOwnProperty (65536));
+assert (obj[65536] === undefined);
+assert (delete obj[65536]);
+
+for (var i = 0; i < keys.length; i++) {
+  delete obj[keys[i]];
+}
+
+assert (JSON.stringify (Object.keys (obj)) === '["4294967295","1.5","-1","name"]');
+obj[65536] = "again";
+assert (obj[65536] === "again");
+
+// Many keys, with deletes which move other keys.
+var table = {};
+for (var i = 0; i < 2000; i++) {
+  table[i * 7919] = i;
+}
+for (var i = 0; i < 2000; i += 2) {
+  delete table[i * 7919];
+}
+for (var i = 0; i < 2000; i++) {
+  assert (table[i * 7919] === ((i & 1) ? i : undefined));
+}
+assert (Object.keys (table).length === 1000);
+assert (Object.keys (table)[0] === "7919");
+
+// Property descriptors.
+var desc = Object.getOwnPropertyDescriptor (obj, 65536);
+assert (desc.value === "again" && desc.writable && desc.enumerable && desc.configurable);
+
+Object.defineProperty (obj, 65536, { value: "defined" });
+assert (obj[65536] === "defined");
+desc = Object.getOwnPropertyDescriptor (obj, 65536);
+assert (desc.writable && desc.enumerable && desc.configurable);
+
+Object.defineProperty (obj, 65536, { enumerable: false });
+desc = Object.getOwnPropertyDescriptor (obj, 65536);
+assert (desc.value === "defined" && desc.writable && !desc.enumerable && desc.configurable);
+assert (Object.keys (obj).indexOf ("65536") === -1);
+
+Object.defineProperty (obj, 200000, { value: 1, writable: true });
+obj[200000] = 2;
+assert (obj[200000] === 2);
+assert (!obj.propertyIsEnumerable (200000));
+assert (!delete obj[200000]);
+
+var value = 0;
+Object.defineProperty (obj, 300000, { get: function () { return value; },
+                                      set: function (v) { value = v * 2; },
+                                      configurable: true });
+obj[300000] = 21;
+assert (obj[300000] === 42);
+
+obj[400000] = "data";
+Object.defineProperty (obj, 400000, { get: function () { return "accessor"; } });
+assert (obj[400000] === "accessor");
+
+// Frozen, sealed and non-extensible objects.
+var frozen = { };
+frozen[123456] = 1;
+frozen[3] = 2;
+Object.freeze (frozen);
+assert (Object.isFrozen (frozen));
+frozen[123456] = 5;
+frozen[654321] = 6;
+assert (frozen[123456] === 1 && frozen[654321] === undefined);
+assert (!delete frozen[3]);
+
+var sealed = { };
+sealed[123456] = 1;
+Object.seal (sealed);
+assert (Object.isSealed (sealed) && !Object.isFrozen (sealed));
+sealed[123456] = 5;
+assert (sealed[123456] === 5);
+assert (!delete sealed[123456]);
+
+var fixed = { };
+fixed[123456] = 1;
+Object.preventExtensions (fixed);
+fixed[123456] = 2;
+fixed[654321] = 3;
+assert (fixed[123456] === 2 && !fixed.hasOwnProperty (654321));
+assert (delete fixed[123456]);
+
+try {
+  (function () { "use strict"; fixed[654321] = 3; }) ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+// Inherited properties.
+var proto = { };
+proto[500000] = "inherited";
+Object.defineProperty (proto, 600000, { value: "read only" });
+Object.defineProperty (proto, 700000, { set: function (v) { this.seen = v; } });
+
+var child = Object.create (proto);
+assert (child[500000] === "inherited" && !child.hasOwnProperty (500000));
+child[500000] = "own";
+assert (child[500000] === "own" && proto[500000] === "inherited");
+child[600000] = "changed";
+assert (child[600000] === "read only" && !child.hasOwnProperty (600000));
+child[700000] = "value";
+assert (child.seen === "value" && !child.hasOwnProperty (700000));
+
+names = [];
+for (var name in child) {
+  names.push (name);
+}
+assert (names.join () === "500000,seen");
+
+// Literal index properties and stored index properties.
+var literal = { 5: "five", 100000: "literal" };
+literal[6] = "six";
+literal[100001] = "stored";
+assert (JSON.stringify (Object.keys (literal)) === '["5","6","100000","100001"]');
+assert (JSON.stringify (literal) === '{"5":"five","6":"six","100000":"literal","100001":"stored"}');
+literal[100000] = "updated";
+assert (literal[100000] === "updated");
+assert (delete literal[100000] && literal[100000] === undefined);
+
+// Object values are kept alive by the garbage collector.
+var holder = { };
+for (var i = 0; i < 100; i++) {
+  holder[1000000 + i] = { id: i };
+}
+gc ();
+for (var i = 0; i < 100; i++) {
+  assert (holder[1000000 + i].id === i);
+}
+
+// Small keys of large objects.
+var small = { };
+for (var i = 0; i < 500; i++) {
+  small[(i * 37) % 1000] = i;
+}
+for (var i = 0; i < 500; i++) {
+  assert (small[(i * 37) % 1000] === i);
+  assert (small[String ((i * 37) % 1000)] === i);
+}
+for (var i = 0; i < 500; i += 3) {
+  assert (delete small[(i * 37) % 1000]);
+}
+small.name = "name";
+
+var small_keys = Object.keys (small);
+assert (small_keys.length === 334 && small_keys[333] === "name");
+for (var i = 1; i < 333; i++) {
+  assert (+small_keys[i - 1] < +small_keys[i]);
+}
+
+Object.defineProperty (small, 37, { writable: false });
+small[37] = "changed";
+assert (small[37] === 1);
+Object.defineProperty (small, 74, { enumerable: false });
+assert (Object.keys (small).indexOf ("74") === -1 && small[74] === 2);
+assert (small.hasOwnProperty (74) && !small.propertyIsEnumerable (74));
+
+Object.freeze (small);
+small[999] = "frozen";
+assert (small[999] === undefined && small[148] === 4);
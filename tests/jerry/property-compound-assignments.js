@@ -0,0 +1,100 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Own data properties. */
+var o = { total: 0, flags: 0, name: "a" };
+
+for (var i = 0; i < 10; i++)
+{
+  o.total += i;
+  o.flags |= 1 << i;
+  o.name += i;
+}
+
+assert(o.total === 45);
+assert(o.flags === 1023);
+assert(o.name === "a0123456789");
+
+assert(o.total++ === 45);
+assert(++o.total === 47);
+assert(o.total-- === 47);
+assert(--o.total === 45);
+
+/* Integer limits and floats. */
+o.big = 0x7ffffff;
+o.big++;
+assert(o.big === 0x8000000);
+o.big = -0x8000000;
+o.big--;
+assert(o.big === -0x8000001);
+o.big = 0x7fffffff;
+assert(o.big++ === 0x7fffffff);
+assert(o.big === 0x80000000);
+o.big = 1.5;
+assert(++o.big === 2.5);
+
+/* Indexed properties. */
+var a = [1, 2, 3];
+a[1] |= 4;
+a[2]++;
+assert(a[1] === 6 && a[2] === 4 && a.length === 3);
+
+/* Inherited properties are not modified. */
+var proto = { count: 5 };
+var child = Object.create(proto);
+child.count++;
+child.count += 2;
+assert(proto.count === 5);
+assert(child.count === 8);
+
+/* Non-writable properties. */
+var ro = {};
+Object.defineProperty(ro, "value", { value: 1, writable: false });
+ro.value++;
+ro.value += 1;
+assert(ro.value === 1);
+
+(function () {
+  "use strict";
+  try {
+    ro.value++;
+    assert(false);
+  } catch (e) {
+    assert(e instanceof TypeError);
+  }
+})();
+
+/* Accessors. */
+var log = [];
+var acc = {
+  get v () { log.push("get"); return 10; },
+  set v (x) { log.push("set " + x); }
+};
+acc.v++;
+acc.v += 5;
+assert(log.join() === "get,set 11,get,set 15");
+
+/* Mapped arguments. */
+function f (x)
+{
+  arguments[0]++;
+  arguments[0] += 2;
+  return x;
+}
+assert(f(1) === 4);
+
+/* Primitive base values. */
+var s = "str";
+s.length++;
+assert(s.length === 3);
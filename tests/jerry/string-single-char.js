@@ -0,0 +1,81 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Single character strings created in different ways must be equal.
+var all = "";
+for (var i = 0; i < 0x110; i++) {
+  all += String.fromCharCode (i);
+}
+
+assert (all.length === 0x110);
+
+for (var i = 0; i < 0x110; i++) {
+  var c = String.fromCharCode (i);
+  assert (c.length === 1);
+  assert (c.charCodeAt (0) === i);
+  assert (c === all.charAt (i));
+  assert (c === all[i]);
+  assert (c === all.slice (i, i + 1));
+  assert (c === all.substring (i, i + 1));
+  assert (c === ("x" + c).substr (1));
+  assert (c === "" + c);
+  assert (c.concat ("") === c);
+  assert (JSON.parse (JSON.stringify (c)) === c);
+  assert (c < String.fromCharCode (i + 1));
+}
+
+assert ("é" === String.fromCharCode (0xe9));
+assert ("\xff" === "ÿ");
+assert ("\x80" === all.charAt (0x80));
+assert ("Ā" === all.charAt (0x100));
+assert ("," === all.charAt (44));
+assert ("7" === all.charAt (55));
+assert ("\0" === all.charAt (0));
+
+// Single character property names.
+var obj = {};
+for (var i = 0; i < 0x110; i++) {
+  obj[String.fromCharCode (i)] = i;
+}
+
+for (var i = 0; i < 0x110; i++) {
+  assert (obj[all.charAt (i)] === i);
+  assert (obj.hasOwnProperty (all[i]));
+}
+
+assert (obj.a === 97);
+assert (obj["é"] === 0xe9);
+assert (obj[5] === 53);
+assert (Object.keys (obj).length === 0x110);
+
+delete obj["ÿ"];
+assert (!obj.hasOwnProperty (String.fromCharCode (0xff)));
+
+// Concatenation, case conversion and splitting.
+assert ("a" + "b" === "ab");
+assert ("é" + "è" === "éè");
+assert ("a".toUpperCase () === "A");
+assert ("é".toUpperCase () === "É");
+assert ("É".toLowerCase () === all.charAt (0xe9));
+assert ("a,b,é".split (",")[2] === "é");
+assert ("abc".split ("").join ("-") === "a-b-c");
+assert ("xéy".indexOf ("é") === 1);
+assert ("xéy".replace ("é", "e") === "xey");
+
+switch (String.fromCharCode (0xe9)) {
+  case "é":
+    break;
+  default:
+    assert (false);
+}
@@ -103,3 +103,59 @@ switch ("var") {
 }
 
 assert (flow === '123a4');
+
+/* Case expressions are evaluated in source order until one matches. */
+var order = '';
+function tag (s, v) { order += s; return v; }
+
+switch (3) {
+  case tag ('a', 1):
+    order += 'A';
+  default:
+    order += 'D';
+  case tag ('b', 3):
+    order += 'B';
+  case tag ('c', 3):
+    order += 'C';
+}
+
+assert (order === 'abBC');
+
+order = '';
+switch (5) {
+  case tag ('a', 1):
+    order += 'A';
+  default:
+    order += 'D';
+  case tag ('b', 2):
+    order += 'B';
+    break;
+  case tag ('c', 3):
+    order += 'C';
+}
+
+assert (order === 'abcDB');
+
+order = '';
+switch (5) {
+  case tag ('a', 1):
+  case tag ('b', 2):
+}
+
+assert (order === 'ab');
+
+/* Nested switch statements inside case expressions and loops. */
+var count = 0;
+for (var i = 0; i < 4; i++) {
+  switch (i) {
+    case (function () { switch (i) { case 0: return 1; default: return 2; } }) ():
+      count += 10;
+      continue;
+    case 3:
+      count += 100;
+      break;
+  }
+  count++;
+}
+
+assert (count === 113);
@@ -343,6 +343,46 @@ main (void)
     jerry_release_value (buffer);
   }
 
+#ifdef JERRY_ARRAYBUFFER_PORT_ALLOCATOR
+  /* Test ArrayBuffers larger than the heap, allocated by the port */
+  {
+    const char *eval_large_arraybuffer_src_p = (
+      "var sum = 0;"
+      "for (var i = 0; i < 8; i++)"
+      "{"
+      "  var large = new Uint8Array (1024 * 1024);"
+      "  large[0] = i; large[large.length - 1] = i;"
+      "  sum += large[0] + large[large.length - 1] + large[12345];"
+      "};"
+      "sum");
+    jerry_value_t res = jerry_eval ((jerry_char_t *) eval_large_arraybuffer_src_p,
+                                    strlen (eval_large_arraybuffer_src_p),
+                                    true);
+    TEST_ASSERT (jerry_value_is_number (res));
+    TEST_ASSERT (jerry_get_number_value (res) == 56);
+    jerry_release_value (res);
+
+    jerry_value_t buffer = jerry_create_arraybuffer (64 * 1024);
+    TEST_ASSERT (jerry_value_is_arraybuffer (buffer));
+
+    uint8_t *const data = jerry_get_arraybuffer_pointer (buffer);
+    TEST_ASSERT (data != NULL && data[0] == 0 && data[64 * 1024 - 1] == 0);
+
+    jerry_heap_stats_t stats;
+    memset (&stats, 0, sizeof (stats));
+
+    if (jerry_get_memory_stats (&stats))
+    {
+      TEST_ASSERT (stats.external_bytes >= 64 * 1024);
+      TEST_ASSERT (stats.peak_external_bytes >= 1024 * 1024);
+    }
+
+    /* One release for jerry_get_arraybuffer_pointer. */
+    jerry_release_value (buffer);
+    jerry_release_value (buffer);
+  }
+#endif /* JERRY_ARRAYBUFFER_PORT_ALLOCATOR */
+
   /* Test ArrayBuffer external with invalid arguments */
   {
     jerry_value_t input_buffer = jerry_create_arraybuffer_external (0, NULL, NULL);
@@ -196,6 +196,50 @@ main (void)
 
   jerry_release_value (backtrace);
 
+  /* The backtrace of errors is limited to CONFIG_ECMA_ERROR_BACKTRACE_DEPTH frames. */
+  source = ("function f(n) {\n"
+            "  return n > 0 ? f(n - 1) : new Error();\n"
+            "}\n"
+            "f(100).stack\n");
+
+  backtrace = run ("deep.js", source);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  uint32_t expected_length = CONFIG_ECMA_ERROR_BACKTRACE_DEPTH;
+
+  if (expected_length == 0 || expected_length > 102)
+  {
+    expected_length = 102;
+  }
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == expected_length);
+
+  compare (backtrace, 0, "deep.js:2");
+  compare (backtrace, 1, "deep.js:2");
+
+  jerry_release_value (backtrace);
+
+  /* The lazy "stack" property behaves as a non-enumerable own data property. */
+  source = ("var e = new TypeError();\n"
+            "var desc = Object.getOwnPropertyDescriptor(e, 'stack');\n"
+            "var ok = desc.writable && desc.configurable && !desc.enumerable;\n"
+            "ok = ok && Object.keys(new Error()).length === 0;\n"
+            "ok = ok && Object.getOwnPropertyNames(new Error()).indexOf('stack') >= 0;\n"
+            "e = new Error(); e.stack = 5;\n"
+            "ok = ok && e.stack === 5 && !e.propertyIsEnumerable('stack');\n"
+            "e = new Error(); delete e.stack;\n"
+            "ok = ok && !e.hasOwnProperty('stack') && e.stack === undefined;\n"
+            "ok = ok && Object.getOwnPropertyNames(e).indexOf('stack') === -1;\n"
+            "ok\n");
+
+  jerry_value_t ok = run ("props.js", source);
+
+  TEST_ASSERT (jerry_value_is_boolean (ok) && jerry_get_boolean_value (ok));
+
+  jerry_release_value (ok);
+
   jerry_cleanup ();
 
   return 0;
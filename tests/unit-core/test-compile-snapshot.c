@@ -0,0 +1,135 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+#include "test-common.h"
+
+#define SNAPSHOT_BUFFER_SIZE (256)
+
+static void *
+instance_alloc (size_t size, /**< size of the instance */
+                void *cb_data_p) /**< callback data */
+{
+  JERRY_UNUSED (cb_data_p);
+  return malloc (size);
+} /* instance_alloc */
+
+static const char *source_p = "var a = 'compiled'; a + ' snapshot'";
+
+/**
+ * Compile the test source with jerry_compile_snapshot.
+ *
+ * @return error type returned by jerry_compile_snapshot
+ */
+static jerry_error_t
+compile (const char *code_p, /**< source */
+         uint32_t *buffer_p, /**< snapshot buffer */
+         size_t buffer_size, /**< size of the buffer */
+         size_t *snapshot_size_p) /**< [out] snapshot size */
+{
+  return jerry_compile_snapshot ((const jerry_char_t *) code_p,
+                                 strlen (code_p),
+                                 0,
+                                 buffer_p,
+                                 buffer_size,
+                                 snapshot_size_p);
+} /* compile */
+
+/**
+ * Execute the compiled test source in the current context.
+ */
+static void
+check_snapshot (const uint32_t *buffer_p, /**< snapshot buffer */
+                size_t snapshot_size) /**< snapshot size */
+{
+  jerry_value_t res = jerry_exec_snapshot (buffer_p, snapshot_size, 0, JERRY_SNAPSHOT_EXEC_COPY_DATA);
+  TEST_ASSERT (jerry_value_is_string (res));
+
+  jerry_char_t str_buf[32];
+  jerry_size_t sz = jerry_string_to_char_buffer (res, str_buf, sizeof (str_buf));
+  TEST_ASSERT (sz == 17 && memcmp (str_buf, "compiled snapshot", sz) == 0);
+  jerry_release_value (res);
+} /* check_snapshot */
+
+int
+main (void)
+{
+  static uint32_t snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  size_t snapshot_size;
+
+  TEST_INIT ();
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      || !jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    /* The missing feature is reported instead of an empty snapshot. */
+    snapshot_size = 1;
+    TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_COMMON);
+    TEST_ASSERT (snapshot_size == 0);
+    return 0;
+  }
+
+  jerry_instance_t *instance_p = jerry_create_instance (512 * 1024, instance_alloc, NULL);
+
+  if (instance_p != NULL)
+  {
+    /* The script is compiled in a second instance while the first one is running. */
+    jerry_instance_t *compile_instance_p = jerry_create_instance (256 * 1024, instance_alloc, NULL);
+    TEST_ASSERT (compile_instance_p != NULL);
+
+    jerry_port_default_set_instance (instance_p);
+    jerry_init (JERRY_INIT_EMPTY);
+
+    jerry_port_default_set_instance (compile_instance_p);
+    TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_NONE);
+    TEST_ASSERT (snapshot_size > 0);
+    TEST_ASSERT (compile ("var 1a", snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_SYNTAX);
+    TEST_ASSERT (snapshot_size == 0);
+    TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_NONE);
+
+    jerry_port_default_set_instance (instance_p);
+    check_snapshot (snapshot_buffer, snapshot_size);
+
+    /* The context of the running instance cannot be used. */
+    TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_COMMON);
+    TEST_ASSERT (snapshot_size == 0);
+
+    jerry_cleanup ();
+
+    jerry_port_default_set_instance (NULL);
+    free (compile_instance_p);
+    free (instance_p);
+    return 0;
+  }
+
+  /* Without external context the script is compiled before the engine is initialized. */
+  TEST_ASSERT (compile ("var 1a", snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_SYNTAX);
+  TEST_ASSERT (snapshot_size == 0);
+  TEST_ASSERT (compile (source_p, snapshot_buffer, 16, &snapshot_size) == JERRY_ERROR_RANGE);
+  TEST_ASSERT (snapshot_size == 0);
+  TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_NONE);
+  TEST_ASSERT (snapshot_size > 0);
+
+  jerry_init (JERRY_INIT_EMPTY);
+  check_snapshot (snapshot_buffer, snapshot_size);
+
+  TEST_ASSERT (compile (source_p, snapshot_buffer, sizeof (snapshot_buffer), &snapshot_size) == JERRY_ERROR_COMMON);
+  TEST_ASSERT (snapshot_size == 0);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
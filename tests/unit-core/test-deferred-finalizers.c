@@ -0,0 +1,136 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+#define TEST_OBJECT_COUNT 20
+
+static int freed_count;
+static int freed_order[TEST_OBJECT_COUNT * 2];
+
+static void
+native_free_cb (void *native_p) /**< native pointer */
+{
+  TEST_ASSERT (freed_count < TEST_OBJECT_COUNT * 2);
+  freed_order[freed_count++] = *(int *) native_p;
+} /* native_free_cb */
+
+static const jerry_object_native_info_t native_info =
+{
+  .free_cb = native_free_cb
+};
+
+static int ids[TEST_OBJECT_COUNT];
+static uint8_t buffer_data[16];
+
+/**
+ * Create garbage objects with native free callbacks.
+ */
+static void
+create_garbage (int first_id, /**< id of the first object */
+                int count) /**< number of objects */
+{
+  for (int i = 0; i < count; i++)
+  {
+    ids[first_id + i] = first_id + i;
+
+    jerry_value_t object = jerry_create_object ();
+    jerry_set_object_native_pointer (object, &ids[first_id + i], &native_info);
+    jerry_release_value (object);
+  }
+} /* create_garbage */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  /* Without the init flag the callbacks are called by the garbage collector. */
+  jerry_init (JERRY_INIT_EMPTY);
+
+  create_garbage (0, 4);
+  jerry_gc ();
+  TEST_ASSERT (freed_count == 4);
+  TEST_ASSERT (jerry_run_deferred_finalizers (0, 0) == 0);
+
+  jerry_cleanup ();
+
+  freed_count = 0;
+
+  jerry_init (JERRY_INIT_DEFERRED_FINALIZERS);
+
+  create_garbage (0, TEST_OBJECT_COUNT);
+
+  jerry_value_t object = jerry_create_native_object (&ids[0], &native_info);
+  jerry_release_value (object);
+
+  /* Number of queued finalizers. */
+  uint32_t queued_count = TEST_OBJECT_COUNT + 1;
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_TYPEDARRAY))
+  {
+    buffer_data[0] = 0;
+    object = jerry_create_arraybuffer_external (sizeof (buffer_data), buffer_data, native_free_cb);
+    jerry_release_value (object);
+    queued_count++;
+  }
+
+  jerry_gc ();
+
+  /* Nothing is called during garbage collection. */
+  TEST_ASSERT (freed_count == 0);
+
+  /* Count budget. */
+  TEST_ASSERT (jerry_run_deferred_finalizers (5, 0) == queued_count - 5);
+  TEST_ASSERT (freed_count == 5);
+
+  /* A generous time budget runs at least one finalizer. */
+  uint32_t pending = jerry_run_deferred_finalizers (1, 1000);
+  TEST_ASSERT (pending == queued_count - 6);
+  TEST_ASSERT (freed_count == 6);
+
+  /* Finalizers queued by a later garbage collection run after the earlier ones. */
+  create_garbage (0, 2);
+  jerry_gc ();
+  TEST_ASSERT (freed_count == 6);
+
+  TEST_ASSERT (jerry_run_deferred_finalizers (0, 0) == 0);
+  TEST_ASSERT (freed_count == (int) queued_count + 2);
+  TEST_ASSERT (freed_order[freed_count - 2] == 0 || freed_order[freed_count - 2] == 1);
+  TEST_ASSERT (freed_order[freed_count - 1] == 0 || freed_order[freed_count - 1] == 1);
+  TEST_ASSERT (freed_order[freed_count - 1] != freed_order[freed_count - 2]);
+
+  /* Pending finalizers and the finalizers of live objects are called by jerry_cleanup. */
+  create_garbage (0, 3);
+  jerry_gc ();
+
+  jerry_value_t global = jerry_get_global_object ();
+  object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, &ids[5], &native_info);
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "live");
+  jerry_release_value (jerry_set_property (global, name, object));
+  jerry_release_value (name);
+  jerry_release_value (object);
+  jerry_release_value (global);
+
+  freed_count = 0;
+  jerry_cleanup ();
+
+  TEST_ASSERT (freed_count == 4);
+  TEST_ASSERT (freed_order[3] == 5);
+
+  return 0;
+} /* main */
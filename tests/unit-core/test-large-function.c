@@ -0,0 +1,139 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "jerryscript-port.h"
+#include "test-common.h"
+
+/**
+ * Number of statements in the loop body.
+ */
+#define TEST_STATEMENT_COUNT 200000
+
+/**
+ * Byte code size limit of the compact byte code header.
+ */
+#define TEST_COMPACT_CODE_SIZE_LIMIT (512 * 1024)
+
+/**
+ * Minimum heap size required by the test.
+ */
+#define TEST_MINIMUM_HEAP_SIZE (4 * 1024 * 1024)
+
+static const char source_prefix[] = "(function () { var a = 0, b = 0; for (var i = 0; i < 2; i++) {";
+static const char source_statement[] = "a++;b=a;";
+static const char source_suffix[] = "} return a + b; }) ()";
+
+/**
+ * Create the source of a function whose byte code is larger than the compact header allows.
+ *
+ * @return source code, which must be freed by the caller
+ */
+static char *
+create_source (size_t *source_size_p) /**< [out] size of the source */
+{
+  size_t statement_size = sizeof (source_statement) - 1;
+  size_t size = sizeof (source_prefix) - 1 + TEST_STATEMENT_COUNT * statement_size + sizeof (source_suffix) - 1;
+  char *source_p = (char *) malloc (size);
+  TEST_ASSERT (source_p != NULL);
+
+  char *dst_p = source_p;
+  memcpy (dst_p, source_prefix, sizeof (source_prefix) - 1);
+  dst_p += sizeof (source_prefix) - 1;
+
+  for (int i = 0; i < TEST_STATEMENT_COUNT; i++)
+  {
+    memcpy (dst_p, source_statement, statement_size);
+    dst_p += statement_size;
+  }
+
+  memcpy (dst_p, source_suffix, sizeof (source_suffix) - 1);
+  *source_size_p = size;
+  return source_p;
+} /* create_source */
+
+/**
+ * Check the result of the function.
+ */
+static void
+check_result (jerry_value_t result) /**< result */
+{
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_get_number_value (result) == 4.0 * TEST_STATEMENT_COUNT);
+  jerry_release_value (result);
+} /* check_result */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_heap_stats_t stats;
+
+  if (!jerry_get_memory_stats (&stats) || stats.size < TEST_MINIMUM_HEAP_SIZE)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Memory statistics are disabled or the heap is too small!\n");
+    jerry_cleanup ();
+    return 0;
+  }
+
+  size_t source_size;
+  char *source_p = create_source (&source_size);
+  size_t allocated_bytes = stats.allocated_bytes;
+
+  jerry_value_t parse_result = jerry_parse (NULL, 0, (const jerry_char_t *) source_p, source_size, 0);
+  TEST_ASSERT (!jerry_value_is_error (parse_result));
+
+  TEST_ASSERT (jerry_get_memory_stats (&stats));
+  TEST_ASSERT (stats.allocated_bytes - allocated_bytes > TEST_COMPACT_CODE_SIZE_LIMIT);
+
+  check_result (jerry_run (parse_result));
+  jerry_release_value (parse_result);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    size_t buffer_size = 2 * 1024 * 1024;
+    uint32_t *snapshot_buffer_p = (uint32_t *) malloc (buffer_size);
+    TEST_ASSERT (snapshot_buffer_p != NULL);
+
+    jerry_value_t generate_result = jerry_generate_snapshot (NULL,
+                                                             0,
+                                                             (const jerry_char_t *) source_p,
+                                                             source_size,
+                                                             0,
+                                                             snapshot_buffer_p,
+                                                             buffer_size);
+    TEST_ASSERT (jerry_value_is_number (generate_result));
+
+    size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
+    jerry_release_value (generate_result);
+    TEST_ASSERT (snapshot_size > TEST_COMPACT_CODE_SIZE_LIMIT);
+
+    jerry_cleanup ();
+    jerry_init (JERRY_INIT_EMPTY);
+
+    check_result (jerry_exec_snapshot (snapshot_buffer_p, snapshot_size, 0, 0));
+    check_result (jerry_exec_snapshot (snapshot_buffer_p, snapshot_size, 0, JERRY_SNAPSHOT_EXEC_COPY_DATA));
+
+    free (snapshot_buffer_p);
+  }
+
+  free (source_p);
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -45,7 +45,7 @@ int main (void)
   bool get_stats_ret = jerry_get_memory_stats (&stats);
   TEST_ASSERT (get_stats_ret);
   TEST_ASSERT (stats.version == 1);
-  TEST_ASSERT (stats.size == 524280);
+  TEST_ASSERT (stats.size == CONFIG_MEM_HEAP_AREA_SIZE - 8);
 
   TEST_ASSERT (!jerry_get_memory_stats (NULL));
 
@@ -28,6 +28,31 @@ static const jerry_object_native_info_t test_info =
   .free_cb = free_test_data
 };
 
+static int registered_data = 2;
+static int registered_free_count = 0;
+
+static void free_registered_data (void *data_p)
+{
+  TEST_ASSERT ((int *) data_p == &registered_data);
+  registered_free_count++;
+} /* free_registered_data */
+
+static const jerry_object_native_info_t registered_info =
+{
+  .free_cb = free_registered_data
+};
+
+static bool
+count_objects (const jerry_value_t candidate,
+               void *object_data_p,
+               void *context_p)
+{
+  TEST_ASSERT (jerry_value_is_object (candidate));
+  TEST_ASSERT (object_data_p == &registered_data);
+  (*(int *) context_p)++;
+  return true;
+} /* count_objects */
+
 static const char *strict_equal_source = "var x = function(a, b) {return a === b;}; x";
 
 static bool
@@ -130,8 +155,83 @@ main (void)
   args[0] = property_name;
   TEST_ASSERT (!jerry_objects_foreach (find_test_object_by_property, args));
 
+  /* Objects with a reserved native pointer slot. */
+  object = jerry_create_native_object (&test_data, &test_info);
+
+  void *native_p;
+  const jerry_object_native_info_t *native_info_p;
+  TEST_ASSERT (jerry_get_object_native_pointer (object, &native_p, &native_info_p));
+  TEST_ASSERT (native_p == &test_data && native_info_p == &test_info);
+
+  TEST_ASSERT (jerry_objects_foreach_by_native_info (&test_info, find_test_object_by_data, &found_object));
+  args[0] = object;
+  args[1] = found_object;
+  strict_equal_result = jerry_call_function (strict_equal, undefined, args, 2);
+  TEST_ASSERT (jerry_value_is_boolean (strict_equal_result) && jerry_get_boolean_value (strict_equal_result));
+  jerry_release_value (strict_equal_result);
+  jerry_release_value (found_object);
+
+  jerry_set_object_native_pointer (object, &registered_data, &registered_info);
+  TEST_ASSERT (jerry_get_object_native_pointer (object, &native_p, &native_info_p));
+  TEST_ASSERT (native_p == &registered_data && native_info_p == &registered_info);
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&test_info, find_test_object_by_data, &found_object));
+
+  /* Registering a type info collects the existing objects. */
+  jerry_register_object_native_info (&registered_info);
+
+  jerry_value_t objects[4];
+  objects[0] = object;
+  objects[1] = jerry_create_native_object (&registered_data, &registered_info);
+  objects[2] = jerry_create_object ();
+  jerry_set_object_native_pointer (objects[2], &registered_data, &registered_info);
+  objects[3] = jerry_create_object ();
+  jerry_set_object_native_pointer (objects[3], &test_data, &test_info);
+
+  int count = 0;
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&registered_info, count_objects, &count));
+  TEST_ASSERT (count == 3);
+
+  /* Changing the type info back and forth must not duplicate objects. */
+  jerry_set_object_native_pointer (objects[2], &test_data, &test_info);
+  jerry_set_object_native_pointer (objects[2], &registered_data, &registered_info);
+  jerry_set_object_native_pointer (objects[3], &registered_data, &registered_info);
+  jerry_set_object_native_pointer (objects[0], &test_data, &test_info);
+
+  count = 0;
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&registered_info, count_objects, &count));
+  TEST_ASSERT (count == 3);
+
+  /* Clearing the type info removes the object from the list. */
+  jerry_set_object_native_pointer (objects[1], &registered_data, NULL);
+  jerry_set_object_native_pointer (objects[3], &registered_data, NULL);
+
+  count = 0;
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&registered_info, count_objects, &count));
+  TEST_ASSERT (count == 1);
+
+  jerry_set_object_native_pointer (objects[1], &registered_data, &registered_info);
+  jerry_set_object_native_pointer (objects[3], &registered_data, &registered_info);
+
+  count = 0;
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&registered_info, count_objects, &count));
+  TEST_ASSERT (count == 3);
+
+  jerry_release_value (objects[1]);
+  jerry_release_value (objects[2]);
+  jerry_gc ();
+  TEST_ASSERT (registered_free_count == 2);
+
+  count = 0;
+  TEST_ASSERT (!jerry_objects_foreach_by_native_info (&registered_info, count_objects, &count));
+  TEST_ASSERT (count == 1);
+
+  jerry_release_value (objects[0]);
+  jerry_release_value (objects[3]);
+
   jerry_release_value (property_name);
   jerry_release_value (undefined);
   jerry_release_value (strict_equal);
   jerry_cleanup ();
+
+  TEST_ASSERT (registered_free_count == 3);
 } /* main */
@@ -0,0 +1,191 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for releasing the empty property pairs of objects with property hashmap.
+ */
+
+#include "ecma-helpers.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Number of properties which are alive at the same time.
+ */
+#define TEST_LIVE_COUNT 100
+
+/**
+ * Number of properties created (and deleted) by a loop.
+ */
+#define TEST_LOOP_COUNT 20000
+
+/**
+ * Upper limit of the property pairs of the test object: the pairs emptied by
+ * deletes must not accumulate beyond the size of the hashmap.
+ */
+#define TEST_PAIR_LIMIT (4 * TEST_LIVE_COUNT)
+
+/**
+ * Set or delete the property "k<index>" of an object.
+ */
+static void
+set_or_delete_property (jerry_value_t object, /**< object */
+                        uint32_t index, /**< index of the property name */
+                        bool is_set) /**< set the property if true, delete it otherwise */
+{
+  jerry_char_t buffer[16];
+  jerry_char_t *name_p = buffer + sizeof (buffer);
+
+  do
+  {
+    *(--name_p) = (jerry_char_t) ('0' + (index % 10));
+    index /= 10;
+  }
+  while (index > 0);
+
+  *(--name_p) = 'k';
+
+  jerry_value_t name = jerry_create_string_sz (name_p, (jerry_size_t) (buffer + sizeof (buffer) - name_p));
+
+  if (is_set)
+  {
+    jerry_value_t result = jerry_set_property (object, name, name);
+    TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+    jerry_release_value (result);
+  }
+  else
+  {
+    TEST_ASSERT (jerry_delete_property (object, name));
+  }
+
+  jerry_release_value (name);
+} /* set_or_delete_property */
+
+/**
+ * Count the property pairs of an object.
+ *
+ * @return number of property pairs
+ */
+static uint32_t
+count_property_pairs (jerry_value_t object) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (ecma_get_object_from_value (object));
+  uint32_t count = 0;
+
+  TEST_ASSERT (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP);
+  prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+
+  while (prop_iter_p != NULL)
+  {
+    TEST_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+    count++;
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return count;
+} /* count_property_pairs */
+
+/**
+ * Check that the property names of an object are "k<first>" ... "k<first + TEST_LIVE_COUNT - 1>",
+ * in this order.
+ */
+static void
+check_enumeration_order (jerry_value_t object, /**< object */
+                         uint32_t first) /**< index of the first property name */
+{
+  jerry_value_t keys = jerry_get_object_keys (object);
+  TEST_ASSERT (jerry_get_array_length (keys) == TEST_LIVE_COUNT);
+
+  for (uint32_t i = 0; i < TEST_LIVE_COUNT; i++)
+  {
+    jerry_value_t key = jerry_get_property_by_index (keys, i);
+    jerry_value_t value = jerry_get_property (object, key);
+
+    /* Each property holds its own name. */
+    TEST_ASSERT (jerry_value_is_string (value));
+
+    jerry_char_t buffer[16];
+    jerry_size_t size = jerry_string_to_char_buffer (key, buffer, sizeof (buffer) - 1);
+    uint32_t index = 0;
+
+    TEST_ASSERT (size >= 2 && buffer[0] == 'k');
+
+    for (jerry_size_t j = 1; j < size; j++)
+    {
+      index = index * 10 + (uint32_t) (buffer[j] - '0');
+    }
+
+    TEST_ASSERT (index == first + i);
+
+    jerry_release_value (value);
+    jerry_release_value (key);
+  }
+
+  jerry_release_value (keys);
+} /* check_enumeration_order */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t object = jerry_create_object ();
+
+  for (uint32_t i = 0; i < TEST_LIVE_COUNT; i++)
+  {
+    set_or_delete_property (object, i, true);
+  }
+
+  TEST_ASSERT (count_property_pairs (object) <= TEST_PAIR_LIMIT);
+
+  /* Queue: the oldest property is deleted after each insertion. */
+  for (uint32_t i = TEST_LIVE_COUNT; i < TEST_LIVE_COUNT + TEST_LOOP_COUNT; i++)
+  {
+    set_or_delete_property (object, i, true);
+    set_or_delete_property (object, i - TEST_LIVE_COUNT, false);
+    TEST_ASSERT (count_property_pairs (object) <= TEST_PAIR_LIMIT);
+  }
+
+  check_enumeration_order (object, TEST_LOOP_COUNT);
+
+  /* Stack: the newest properties are deleted and created again. The empty pairs
+   * left at the start of the list are released by the insertions. */
+  for (uint32_t i = 0; i < TEST_LOOP_COUNT / TEST_LIVE_COUNT; i++)
+  {
+    uint32_t pair_count = count_property_pairs (object);
+
+    for (uint32_t j = TEST_LIVE_COUNT / 2; j < TEST_LIVE_COUNT; j++)
+    {
+      set_or_delete_property (object, TEST_LOOP_COUNT + j, false);
+    }
+
+    for (uint32_t j = TEST_LIVE_COUNT / 2; j < TEST_LIVE_COUNT; j++)
+    {
+      set_or_delete_property (object, TEST_LOOP_COUNT + j, true);
+    }
+
+    TEST_ASSERT (count_property_pairs (object) <= pair_count);
+  }
+
+  check_enumeration_order (object, TEST_LOOP_COUNT);
+
+  jerry_release_value (object);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,180 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static jerry_value_t
+run_source (const char *source_p) /**< source code */
+{
+  jerry_value_t parsed_code_val = jerry_parse (NULL,
+                                               0,
+                                               (jerry_char_t *) source_p,
+                                               strlen (source_p),
+                                               JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t res = jerry_run (parsed_code_val);
+  jerry_release_value (parsed_code_val);
+  return res;
+} /* run_source */
+
+static void
+set_quotas (uint32_t heap_limit, /**< heap limit */
+            uint32_t branch_limit, /**< branch limit */
+            uint32_t call_depth_limit) /**< call depth limit */
+{
+  jerry_quotas_t quotas;
+  quotas.heap_limit = heap_limit;
+  quotas.branch_limit = branch_limit;
+  quotas.call_depth_limit = call_depth_limit;
+  jerry_set_quotas (&quotas);
+} /* set_quotas */
+
+static void
+assert_quota_abort (const char *source_p) /**< source code */
+{
+  jerry_value_t res = run_source (source_p);
+
+  TEST_ASSERT (jerry_value_is_error (res));
+  TEST_ASSERT (jerry_value_is_abort (res));
+  jerry_release_value (res);
+} /* assert_quota_abort */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_QUOTAS))
+  {
+    return 0;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Without quotas the code runs to completion. */
+  jerry_value_t res = run_source ("var i = 0; while (i < 100000) { i++; } i");
+  TEST_ASSERT (jerry_get_number_value (res) == 100000);
+  jerry_release_value (res);
+
+  /* Branch quota: an infinite loop is aborted. */
+  set_quotas (0, 1000, 0);
+  assert_quota_abort ("while (true) {}");
+
+  /* The quota remains exceeded until it is set again. */
+  assert_quota_abort ("var j = 0; while (j < 2) { j++; }");
+
+  /* The abort cannot be caught by the script. */
+  set_quotas (0, 1000, 0);
+  assert_quota_abort ("function f () { for (;;) ; }\n"
+                      "var caught = false;\n"
+                      "try { f (); } catch (e) { caught = true; } finally { caught = true; }\n"
+                      "for (;;) ;");
+
+  set_quotas (0, 0, 0);
+  res = run_source ("caught");
+  TEST_ASSERT (jerry_value_is_boolean (res) && !jerry_get_boolean_value (res));
+  jerry_release_value (res);
+
+  /* Code which stays below the quota is not aborted. */
+  set_quotas (0, 1000, 0);
+  res = run_source ("var k = 0; while (k < 100) { k++; } k");
+  TEST_ASSERT (jerry_get_number_value (res) == 100);
+  jerry_release_value (res);
+
+  /* The branch limit is inclusive: running the script and the nine calls
+   * of f take ten branches, and the tenth call of f is aborted. */
+  set_quotas (0, 10, 0);
+  res = run_source ("var c = 0; function f () { c++; }\n"
+                    "f (); f (); f (); f (); f (); f (); f (); f (); f (); c");
+  TEST_ASSERT (jerry_get_number_value (res) == 9);
+  jerry_release_value (res);
+
+  set_quotas (0, 10, 0);
+  assert_quota_abort ("c = 0; f (); f (); f (); f (); f (); f (); f (); f (); f (); f (); c");
+
+  set_quotas (0, 0, 0);
+  res = run_source ("c");
+  TEST_ASSERT (jerry_get_number_value (res) == 9);
+  jerry_release_value (res);
+
+  /* Function calls are counted as well. */
+  set_quotas (0, 1000, 0);
+  assert_quota_abort ("function g () {}\n"
+                      "g (); g (); g (); g (); g (); g (); g (); g (); g (); g ();\n"
+                      "for (var n = 0; n < 1000; n++) g ();");
+
+  /* Call depth quota. */
+  set_quotas (0, 0, 32);
+  res = run_source ("function depth (n) { return n == 0 ? 0 : 1 + depth (n - 1); } depth (16)");
+  TEST_ASSERT (jerry_get_number_value (res) == 16);
+  jerry_release_value (res);
+
+  assert_quota_abort ("function rec () { try { return rec (); } catch (e) { return 0; } } rec ()");
+
+  /* The call depth is restored after the abort. */
+  res = run_source ("depth (16)");
+  TEST_ASSERT (jerry_get_number_value (res) == 16);
+  jerry_release_value (res);
+
+#ifndef JERRY_SYSTEM_ALLOCATOR
+  /* Heap quota: growing data is aborted, garbage is collected. */
+  set_quotas (64 * 1024, 0, 0);
+  res = run_source ("for (var m = 0; m < 10000; m++) { var tmp = [m, m + 1, m + 2]; } m");
+  TEST_ASSERT (jerry_get_number_value (res) == 10000);
+  jerry_release_value (res);
+
+  assert_quota_abort ("var data = []; while (true) { data.push ({}); }");
+
+  /* The memory can be released after the abort. */
+  set_quotas (0, 0, 0);
+  jerry_release_value (run_source ("data = undefined;"));
+  jerry_gc ();
+
+  set_quotas (64 * 1024, 0, 0);
+  res = run_source ("var small = []; for (var p = 0; p < 10; p++) { small.push ({}); } small.length");
+  TEST_ASSERT (jerry_get_number_value (res) == 10);
+  jerry_release_value (res);
+
+  /* The branches counted while the heap quota is checked are not lost. */
+  set_quotas (64 * 1024, 1000, 0);
+  res = run_source ("for (var q = 0; q < 900; q++) { var tmp = new Array (100).join ('x') + q; } q");
+  TEST_ASSERT (jerry_get_number_value (res) == 900);
+  jerry_release_value (res);
+
+  set_quotas (64 * 1024, 1000, 0);
+  assert_quota_abort ("for (var r = 0; r < 1100; r++) { var tmp = new Array (100).join ('x') + r; }");
+
+  set_quotas (0, 0, 0);
+  res = run_source ("r");
+  TEST_ASSERT (jerry_get_number_value (res) < 1000);
+  jerry_release_value (res);
+
+  /* A heap quota which is already exceeded is reported at the next check. */
+  set_quotas (0, 0, 0);
+  jerry_release_value (run_source ("var big = []; for (var t = 0; t < 2000; t++) { big.push ({}); }"));
+  set_quotas (16 * 1024, 0, 0);
+  assert_quota_abort ("var u = 0; while (u < 2) { u++; }");
+
+  set_quotas (0, 0, 0);
+  jerry_release_value (run_source ("big = undefined;"));
+  jerry_gc ();
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
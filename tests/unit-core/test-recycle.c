@@ -0,0 +1,137 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for recycling freed property pairs and extended objects.
+ */
+
+#include "ecma-alloc.h"
+#include "jcontext.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+
+/**
+ * Maximum number of recycled property pairs.
+ */
+#define TEST_PROPERTY_PAIRS_LIMIT (CONFIG_ECMA_RECYCLE_LIMIT / sizeof (ecma_property_pair_t))
+
+/**
+ * Number of extended objects allocated by the test.
+ */
+#define TEST_OBJECT_COUNT 16
+
+/**
+ * Size of the heap blocks of a property pair.
+ */
+#define TEST_PROPERTY_PAIR_SIZE JERRY_ALIGNUP (sizeof (ecma_property_pair_t), JMEM_ALIGNMENT)
+
+/**
+ * Size of the heap blocks of an extended object.
+ */
+#define TEST_OBJECT_SIZE JERRY_ALIGNUP (sizeof (ecma_extended_object_t), JMEM_ALIGNMENT)
+
+static ecma_property_pair_t *pairs[TEST_PROPERTY_PAIRS_LIMIT + 1];
+static ecma_extended_object_t *objects[TEST_OBJECT_COUNT];
+
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+#if CONFIG_ECMA_RECYCLE_LIMIT > 0
+  jerry_gc ();
+  ecma_free_recycled_blocks ();
+
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_property_pairs_p) == NULL);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_extended_objects_p) == NULL);
+
+  size_t allocated_size = JERRY_CONTEXT (jmem_heap_allocated_size);
+  size_t used_size = (TEST_PROPERTY_PAIRS_LIMIT + 1) * TEST_PROPERTY_PAIR_SIZE + TEST_OBJECT_COUNT * TEST_OBJECT_SIZE;
+
+  /* The lists are empty, so the blocks are allocated from the heap. */
+  for (size_t i = 0; i <= TEST_PROPERTY_PAIRS_LIMIT; i++)
+  {
+    pairs[i] = ecma_alloc_property_pair ();
+  }
+
+  for (size_t i = 0; i < TEST_OBJECT_COUNT; i++)
+  {
+    objects[i] = ecma_alloc_extended_object (sizeof (ecma_extended_object_t));
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size + used_size);
+
+  /* The freed blocks are kept until the lists are full. */
+  for (size_t i = 0; i <= TEST_PROPERTY_PAIRS_LIMIT; i++)
+  {
+    ecma_dealloc_property_pair (pairs[i]);
+  }
+
+  for (size_t i = 0; i < TEST_OBJECT_COUNT; i++)
+  {
+    ecma_dealloc_extended_object ((ecma_object_t *) objects[i], sizeof (ecma_extended_object_t));
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_property_pairs_count) == TEST_PROPERTY_PAIRS_LIMIT);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_extended_objects_count) == TEST_OBJECT_COUNT);
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size + used_size - TEST_PROPERTY_PAIR_SIZE);
+
+  /* The kept blocks are reused in reverse order without allocating from the heap. */
+  for (size_t i = 0; i < TEST_OBJECT_COUNT; i++)
+  {
+    ecma_extended_object_t *object_p = ecma_alloc_extended_object (sizeof (ecma_extended_object_t));
+    TEST_ASSERT (object_p == objects[TEST_OBJECT_COUNT - 1 - i]);
+  }
+
+  for (size_t i = 0; i < TEST_PROPERTY_PAIRS_LIMIT; i++)
+  {
+    ecma_property_pair_t *pair_p = ecma_alloc_property_pair ();
+    TEST_ASSERT (pair_p == pairs[TEST_PROPERTY_PAIRS_LIMIT - 1 - i]);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_property_pairs_count) == 0);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_extended_objects_count) == 0);
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size + used_size - TEST_PROPERTY_PAIR_SIZE);
+
+  /* A garbage collection returns the blocks which were not reused to the heap. */
+  for (size_t i = 0; i < TEST_PROPERTY_PAIRS_LIMIT; i++)
+  {
+    ecma_dealloc_property_pair (pairs[i]);
+  }
+
+  for (size_t i = 0; i < TEST_OBJECT_COUNT; i++)
+  {
+    ecma_dealloc_extended_object ((ecma_object_t *) objects[i], sizeof (ecma_extended_object_t));
+  }
+
+  jerry_gc ();
+
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_property_pairs_p) == NULL);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_extended_objects_p) == NULL);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_property_pairs_count) == 0);
+  TEST_ASSERT (JERRY_CONTEXT (ecma_recycled_extended_objects_count) == 0);
+  TEST_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == allocated_size);
+#endif /* CONFIG_ECMA_RECYCLE_LIMIT > 0 */
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
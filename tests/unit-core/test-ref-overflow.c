@@ -0,0 +1,166 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-function-object.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Number of references taken from each target. All counters overflow many times.
+ */
+#define TEST_REF_COUNT 100000
+
+static int cleared_count;
+
+static void
+weak_ref_cleared (void *user_p) /**< user pointer */
+{
+  JERRY_UNUSED (user_p);
+  cleared_count++;
+} /* weak_ref_cleared */
+
+/**
+ * Acquire a value many times, then release it the same number of times.
+ * The references are also released and acquired around the refill limit.
+ */
+static void
+acquire_and_release (jerry_value_t value) /**< value */
+{
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    TEST_ASSERT (jerry_acquire_value (value) == value);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) != NULL);
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    jerry_release_value (value);
+
+    if ((i % 1000) == 0)
+    {
+      jerry_acquire_value (value);
+      jerry_release_value (value);
+    }
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) == NULL);
+} /* acquire_and_release */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Object reference counter. */
+  jerry_value_t object = jerry_create_object ();
+  jerry_weak_ref_t *weak_ref_p = jerry_create_weak_ref (object, weak_ref_cleared, NULL);
+
+  acquire_and_release (object);
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    jerry_acquire_value (object);
+  }
+
+  jerry_release_value (object);
+
+  /* The object is alive while its references are in the overflow table. */
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 0);
+
+  for (int i = 1; i < TEST_REF_COUNT; i++)
+  {
+    jerry_release_value (object);
+  }
+
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 0);
+
+  jerry_release_value (object);
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) == NULL);
+
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 1);
+  jerry_free_weak_ref (weak_ref_p);
+
+  /* String reference counter. */
+  jerry_value_t string = jerry_create_string ((const jerry_char_t *) "a string which is shared many times");
+  acquire_and_release (string);
+
+  jerry_size_t size = jerry_get_string_size (string);
+  TEST_ASSERT (size == 35);
+  jerry_release_value (string);
+
+  /* Several targets can be in the overflow table at the same time. */
+  jerry_value_t targets[3];
+  targets[0] = jerry_create_object ();
+  targets[1] = jerry_create_string ((const jerry_char_t *) "another shared string");
+  targets[2] = jerry_create_object ();
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    jerry_acquire_value (targets[i % 3]);
+  }
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    jerry_release_value (targets[(i * 7) % 3]);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) == NULL);
+
+  jerry_release_value (targets[0]);
+  jerry_release_value (targets[1]);
+  jerry_release_value (targets[2]);
+
+  /* Byte code reference counter, which is increased by each closure of a function. */
+  static const jerry_char_t source[] = "(function (a) { return a * 2; })";
+  jerry_value_t function = jerry_eval (source, sizeof (source) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_function (function));
+
+  ecma_object_t *function_p = ecma_get_object_from_value (function);
+  ecma_compiled_code_t *bytecode_p;
+  bytecode_p = (ecma_compiled_code_t *) ecma_op_function_get_compiled_code ((ecma_extended_object_t *) function_p);
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    ecma_bytecode_ref (bytecode_p);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) != NULL);
+
+  jerry_value_t arg = jerry_create_number (21);
+  jerry_value_t result = jerry_call_function (function, jerry_create_undefined (), &arg, 1);
+  TEST_ASSERT (jerry_get_number_value (result) == 42);
+  jerry_release_value (result);
+  jerry_release_value (arg);
+
+  for (int i = 0; i < TEST_REF_COUNT; i++)
+  {
+    ecma_bytecode_deref (bytecode_p);
+  }
+
+  TEST_ASSERT (JERRY_CONTEXT (ref_overflow_p) == NULL);
+  jerry_release_value (function);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,112 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+/**
+ * Evaluate a script and check that it does not throw.
+ *
+ * @return result of the script
+ */
+static jerry_value_t
+eval (const char *source_p) /**< source */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), false);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t number = jerry_create_number (3.5);
+  TEST_ASSERT (jerry_get_retained_size (&number, 1) == 0);
+  TEST_ASSERT (jerry_get_retained_size (NULL, 0) == 0);
+  jerry_release_value (number);
+
+  /* An object which is referenced by the global object retains nothing. */
+  jerry_value_t global_state = eval ("var state = { list: [1, 2, 3], name: 'state' }; state");
+  TEST_ASSERT (jerry_get_retained_size (&global_state, 1) == 0);
+
+  jerry_release_value (eval ("state = undefined"));
+  size_t state_size = jerry_get_retained_size (&global_state, 1);
+  TEST_ASSERT (state_size > 0);
+
+  /* Objects shared by two roots are retained only by the set of both roots. */
+  jerry_value_t roots[2];
+  roots[0] = eval ("var shared = { payload: new Array (100).join ('x') };"
+                   "var a = { shared: shared, own: { value: 1.5 } }; a");
+  roots[1] = eval ("var b = { shared: shared }; shared = undefined; b");
+  jerry_release_value (eval ("a = undefined; b = undefined"));
+
+  size_t a_size = jerry_get_retained_size (roots + 0, 1);
+  size_t b_size = jerry_get_retained_size (roots + 1, 1);
+  size_t ab_size = jerry_get_retained_size (roots, 2);
+
+  TEST_ASSERT (a_size > b_size);
+  TEST_ASSERT (ab_size > a_size + b_size + 100);
+
+  /* A string is retained if all of its references are held by the retained objects. */
+  jerry_value_t strings[2];
+  strings[0] = eval ("var s = new Array (200).join ('y'); var c = { p: s, q: [s, s] }; s = undefined; c");
+  strings[1] = eval ("var kept = new Array (200).join ('z'); var d = { p: kept, q: [kept, kept] }; d");
+  jerry_release_value (eval ("c = undefined; d = undefined"));
+
+  size_t c_size = jerry_get_retained_size (strings + 0, 1);
+  size_t d_size = jerry_get_retained_size (strings + 1, 1);
+
+  TEST_ASSERT (c_size >= d_size + 199);
+  TEST_ASSERT (d_size < 199);
+
+  /* The references of the strings are restored. */
+  TEST_ASSERT (jerry_get_retained_size (strings + 0, 1) == c_size);
+  TEST_ASSERT (jerry_get_retained_size (strings + 1, 1) == d_size);
+
+  jerry_release_value (strings[0]);
+  jerry_release_value (strings[1]);
+  jerry_gc ();
+
+  /* A larger object graph retains more memory. */
+  jerry_value_t big = eval ("var big = []; for (var i = 0; i < 100; i++) { big.push ({ index: i }) }; big");
+  jerry_release_value (eval ("big = undefined"));
+
+  size_t big_size = jerry_get_retained_size (&big, 1);
+  TEST_ASSERT (big_size > 10 * state_size);
+
+  /* The computation must leave the heap intact. */
+  jerry_gc ();
+  TEST_ASSERT (jerry_get_retained_size (&big, 1) == big_size);
+  TEST_ASSERT (jerry_get_retained_size (&global_state, 1) == state_size);
+
+  jerry_value_t length_name = jerry_create_string ((const jerry_char_t *) "length");
+  jerry_value_t length = jerry_get_property (big, length_name);
+  jerry_release_value (length_name);
+  TEST_ASSERT (jerry_value_is_number (length));
+  TEST_ASSERT (jerry_get_number_value (length) == 100);
+  jerry_release_value (length);
+
+  jerry_release_value (big);
+  jerry_release_value (roots[0]);
+  jerry_release_value (roots[1]);
+  jerry_release_value (global_state);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -110,6 +110,111 @@ static void test_function_snapshot (void)
   jerry_cleanup ();
 } /* test_function_snapshot */
 
+static size_t generate_test_snapshot (const char *code_to_snapshot_p, uint32_t *snapshot_buffer_p)
+{
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t generate_result;
+  generate_result = jerry_generate_snapshot (NULL,
+                                             0,
+                                             (const jerry_char_t *) code_to_snapshot_p,
+                                             strlen (code_to_snapshot_p),
+                                             0,
+                                             snapshot_buffer_p,
+                                             SNAPSHOT_BUFFER_SIZE);
+  TEST_ASSERT (!jerry_value_is_error (generate_result)
+               && jerry_value_is_number (generate_result));
+
+  size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
+  jerry_release_value (generate_result);
+
+  jerry_cleanup ();
+  return snapshot_size;
+} /* generate_test_snapshot */
+
+static void test_optimize_snapshot (void)
+{
+  static uint32_t snapshot_buffer_0[SNAPSHOT_BUFFER_SIZE];
+  static uint32_t snapshot_buffer_1[SNAPSHOT_BUFFER_SIZE];
+  static uint32_t snapshot_buffer_2[SNAPSHOT_BUFFER_SIZE];
+  static uint32_t optimized_snapshot_buffer[SNAPSHOT_BUFFER_SIZE];
+  size_t snapshot_sizes[3];
+
+  snapshot_sizes[0] = generate_test_snapshot ("function f (x) { return x * 2; } f (10) + 1", snapshot_buffer_0);
+  snapshot_sizes[1] = generate_test_snapshot ("function f (x) { return x * 2; } f (5)", snapshot_buffer_1);
+  snapshot_sizes[2] = generate_test_snapshot ("'this string is only used by an unreachable function'",
+                                              snapshot_buffer_2);
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  const char *error_p;
+  const uint32_t *snapshot_buffers[3] = { snapshot_buffer_0, snapshot_buffer_1, snapshot_buffer_2 };
+  const uint32_t entry_funcs[2] = { 1, 0 };
+  const uint32_t invalid_entry_funcs[1] = { 3 };
+  const uint32_t profile[2] = { 2, 0 };
+
+  size_t optimized_size = jerry_optimize_snapshots (snapshot_buffers,
+                                                    snapshot_sizes,
+                                                    3,
+                                                    invalid_entry_funcs,
+                                                    1,
+                                                    NULL,
+                                                    0,
+                                                    optimized_snapshot_buffer,
+                                                    sizeof (optimized_snapshot_buffer),
+                                                    &error_p);
+  TEST_ASSERT (optimized_size == 0 && error_p != NULL);
+
+  optimized_size = jerry_optimize_snapshots (snapshot_buffers,
+                                             snapshot_sizes,
+                                             3,
+                                             entry_funcs,
+                                             2,
+                                             profile,
+                                             2,
+                                             optimized_snapshot_buffer,
+                                             sizeof (optimized_snapshot_buffer),
+                                             &error_p);
+  TEST_ASSERT (optimized_size > 0 && error_p == NULL);
+  jerry_cleanup ();
+
+  /* The inputs are modified by the optimizer, so they are generated again for merging. */
+  snapshot_sizes[0] = generate_test_snapshot ("function f (x) { return x * 2; } f (10) + 1", snapshot_buffer_0);
+  snapshot_sizes[1] = generate_test_snapshot ("function f (x) { return x * 2; } f (5)", snapshot_buffer_1);
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  size_t merged_size = jerry_merge_snapshots (snapshot_buffers,
+                                              snapshot_sizes,
+                                              2,
+                                              snapshot_buffer_2,
+                                              sizeof (snapshot_buffer_2),
+                                              &error_p);
+
+  /* Function 'f' is stored only once. */
+  TEST_ASSERT (merged_size > 0 && optimized_size < merged_size);
+
+  jerry_cleanup ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t res = jerry_exec_snapshot (optimized_snapshot_buffer, optimized_size, 0, 0);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  TEST_ASSERT (jerry_get_number_value (res) == 10);
+  jerry_release_value (res);
+
+  res = jerry_exec_snapshot (optimized_snapshot_buffer, optimized_size, 1, JERRY_SNAPSHOT_EXEC_COPY_DATA);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  TEST_ASSERT (jerry_get_number_value (res) == 21);
+  jerry_release_value (res);
+
+  res = jerry_exec_snapshot (optimized_snapshot_buffer, optimized_size, 2, 0);
+  TEST_ASSERT (jerry_value_is_error (res));
+  jerry_release_value (res);
+
+  jerry_cleanup ();
+} /* test_optimize_snapshot */
+
 static void arguments_test_exec_snapshot (uint32_t *snapshot_p, size_t snapshot_size, uint32_t exec_snapshot_flags)
 {
   jerry_init (JERRY_INIT_EMPTY);
@@ -214,9 +319,9 @@ main (void)
     jerry_release_value (generate_result);
 
     /* Check the snapshot data. Unused bytes should be filled with zeroes */
-    const uint8_t expected_data[] =
+    uint8_t expected_data[] =
     {
-      0x4A, 0x52, 0x52, 0x59, 0x0D, 0x00, 0x00, 0x00,
+      0x4A, 0x52, 0x52, 0x59, 0x12, 0x00, 0x00, 0x00,
       0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
       0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
       0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
@@ -229,6 +334,13 @@ main (void)
       0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x6E,
       0x61, 0x70, 0x73, 0x68, 0x6F, 0x74
     };
+
+    if (jerry_is_feature_enabled (JERRY_FEATURE_CPOINTER_32_BIT))
+    {
+      /* Global flags: the snapshot uses four byte compressed pointers. */
+      expected_data[9] = 0x01;
+    }
+
     TEST_ASSERT (sizeof (expected_data) == snapshot_size);
     TEST_ASSERT (0 == memcmp (expected_data, snapshot_buffer, sizeof (expected_data)));
 
@@ -277,6 +389,90 @@ main (void)
     test_exec_snapshot (snapshot_buffer, snapshot_size, JERRY_SNAPSHOT_EXEC_ALLOW_STATIC);
   }
 
+  /* Regular expression literals are saved in compiled form */
+  if (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC)
+      && jerry_is_feature_enabled (JERRY_FEATURE_REGEXP))
+  {
+    const char *code_to_snapshot_p = ("var re = /a(b+)c/gi;"
+                                      "var m = 'xABBBCx'.match (/a(b+)c/i);"
+                                      "re.source + ':' + m[1] + ':' + re.global + ':' + /a/.test ('cab');");
+
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_value_t generate_result;
+    generate_result = jerry_generate_snapshot (NULL,
+                                               0,
+                                               (const jerry_char_t *) code_to_snapshot_p,
+                                               strlen (code_to_snapshot_p),
+                                               0,
+                                               snapshot_buffer,
+                                               sizeof (snapshot_buffer));
+    TEST_ASSERT (!jerry_value_is_error (generate_result)
+                 && jerry_value_is_number (generate_result));
+
+    size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
+    jerry_release_value (generate_result);
+
+    jerry_cleanup ();
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      jerry_init (JERRY_INIT_EMPTY);
+
+      uint32_t exec_snapshot_flags = (i == 0) ? 0 : JERRY_SNAPSHOT_EXEC_COPY_DATA;
+      jerry_value_t res = jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, exec_snapshot_flags);
+      TEST_ASSERT (jerry_value_is_string (res));
+
+      char string_data[32];
+      jerry_size_t sz = jerry_string_to_char_buffer (res, (jerry_char_t *) string_data, sizeof (string_data));
+      TEST_ASSERT (sz == 20);
+      TEST_ASSERT (!strncmp (string_data, "a(b+)c:BBB:true:true", (size_t) sz));
+      jerry_release_value (res);
+
+      jerry_cleanup ();
+    }
+
+    /* Static snapshots cannot contain regular expression literals. The
+     * other literals of these sources are magic strings. */
+    static const char *static_code_to_snapshot_p[] =
+    {
+      "/a(b+)c/gi.test;",
+      "(function () { return /a/.exec; }).call;"
+    };
+
+    for (uint32_t i = 0; i < sizeof (static_code_to_snapshot_p) / sizeof (static_code_to_snapshot_p[0]); i++)
+    {
+      jerry_init (JERRY_INIT_EMPTY);
+
+      generate_result = jerry_generate_snapshot (NULL,
+                                                 0,
+                                                 (const jerry_char_t *) static_code_to_snapshot_p[i],
+                                                 strlen (static_code_to_snapshot_p[i]),
+                                                 JERRY_SNAPSHOT_SAVE_STATIC,
+                                                 snapshot_buffer,
+                                                 sizeof (snapshot_buffer));
+      TEST_ASSERT (jerry_value_is_error (generate_result));
+      TEST_ASSERT (jerry_get_error_type (generate_result) == JERRY_ERROR_RANGE);
+
+      jerry_value_t error_value = jerry_get_value_without_error_flag (generate_result);
+      jerry_value_t error_string = jerry_value_to_string (error_value);
+
+      char error_data[64];
+      const char *expected_error_p = "RangeError: Regular expression literals are not supported.";
+      jerry_size_t error_size = jerry_string_to_char_buffer (error_string,
+                                                             (jerry_char_t *) error_data,
+                                                             sizeof (error_data));
+      TEST_ASSERT (error_size == strlen (expected_error_p));
+      TEST_ASSERT (!strncmp (error_data, expected_error_p, (size_t) error_size));
+
+      jerry_release_value (error_string);
+      jerry_release_value (error_value);
+      jerry_release_value (generate_result);
+
+      jerry_cleanup ();
+    }
+  }
+
   /* Merge snapshot */
   if (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
       && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
@@ -417,5 +613,11 @@ main (void)
 
   test_function_arguments_snapshot ();
 
+  if (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    test_optimize_snapshot ();
+  }
+
   return 0;
 } /* main */
@@ -0,0 +1,146 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+/**
+ * Export a string with the cursor API and compare the concatenated chunks
+ * against the result of the whole-string export functions.
+ */
+static void
+check_string_chunks (jerry_value_t value, /**< string value */
+                     jerry_size_t chunk_size, /**< size of the chunk buffer */
+                     bool is_utf8) /**< export utf-8 or cesu-8 chunks */
+{
+  jerry_char_t expected[256];
+  jerry_char_t result[256];
+  jerry_char_t chunk[256];
+  jerry_size_t expected_size;
+  jerry_size_t result_size = 0;
+  jerry_size_t size;
+
+  TEST_ASSERT (chunk_size <= sizeof (chunk));
+
+  if (is_utf8)
+  {
+    expected_size = jerry_string_to_utf8_char_buffer (value, expected, sizeof (expected));
+  }
+  else
+  {
+    expected_size = jerry_string_to_char_buffer (value, expected, sizeof (expected));
+  }
+
+  jerry_string_cursor_t cursor;
+  jerry_string_cursor_init (&cursor, value);
+
+  while (true)
+  {
+    if (is_utf8)
+    {
+      size = jerry_string_cursor_next_utf8 (&cursor, chunk, chunk_size);
+    }
+    else
+    {
+      size = jerry_string_cursor_next (&cursor, chunk, chunk_size);
+    }
+
+    if (size == 0)
+    {
+      break;
+    }
+
+    TEST_ASSERT (size <= chunk_size);
+    TEST_ASSERT (result_size + size <= sizeof (result));
+
+    /* A chunk never starts with a continuation byte. */
+    TEST_ASSERT ((chunk[0] & 0xc0) != 0x80);
+
+    memcpy (result + result_size, chunk, size);
+    result_size += size;
+  }
+
+  TEST_ASSERT (result_size == expected_size);
+  TEST_ASSERT (memcmp (result, expected, expected_size) == 0);
+} /* check_string_chunks */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* ASCII, two and three byte characters, and a surrogate pair. */
+  static const jerry_char_t utf8_str[] = "ascii \xc3\xa1rv\xc3\xadzt\xc5\xb1r\xc5\x91 \xe2\x82\xac \xf0\x9d\x8c\x86 end";
+  static const jerry_char_t ascii_str[] = "The quick brown fox jumps over the lazy dog";
+
+  jerry_value_t values[2];
+  values[0] = jerry_create_string_from_utf8 (utf8_str);
+  values[1] = jerry_create_string (ascii_str);
+
+  for (size_t i = 0; i < sizeof (values) / sizeof (values[0]); i++)
+  {
+    for (jerry_size_t chunk_size = 4; chunk_size <= 64; chunk_size++)
+    {
+      check_string_chunks (values[i], chunk_size, false);
+      check_string_chunks (values[i], chunk_size, true);
+    }
+  }
+
+  /* The buffer is too small for the next character: no progress is made. */
+  jerry_string_cursor_t cursor;
+  jerry_char_t buffer[8];
+
+  jerry_string_cursor_init (&cursor, values[0]);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 6) == 6);
+  TEST_ASSERT (memcmp (buffer, "ascii ", 6) == 0);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 1) == 0);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 2) == 2);
+  TEST_ASSERT (buffer[0] == 0xc3 && buffer[1] == 0xa1);
+
+  /* Surrogate pairs are not split in utf-8 mode. */
+  jerry_value_t pair = jerry_create_string_from_utf8 ((const jerry_char_t *) "\xf0\x9d\x8c\x86");
+  jerry_string_cursor_init (&cursor, pair);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 3) == 0);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 4) == 4);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, 4) == 0);
+
+  /* In cesu-8 mode the halves of the pair are separate characters. */
+  jerry_string_cursor_init (&cursor, pair);
+  TEST_ASSERT (jerry_string_cursor_next (&cursor, buffer, 5) == 3);
+  TEST_ASSERT (jerry_string_cursor_next (&cursor, buffer, 5) == 3);
+  TEST_ASSERT (jerry_string_cursor_next (&cursor, buffer, 5) == 0);
+  jerry_release_value (pair);
+
+  /* Non-string values export nothing. */
+  jerry_value_t number = jerry_create_number (42);
+  jerry_string_cursor_init (&cursor, number);
+  TEST_ASSERT (jerry_string_cursor_next (&cursor, buffer, sizeof (buffer)) == 0);
+  TEST_ASSERT (jerry_string_cursor_next_utf8 (&cursor, buffer, sizeof (buffer)) == 0);
+  jerry_release_value (number);
+
+  /* Empty string. */
+  jerry_value_t empty = jerry_create_string ((const jerry_char_t *) "");
+  jerry_string_cursor_init (&cursor, empty);
+  TEST_ASSERT (jerry_string_cursor_next (&cursor, buffer, sizeof (buffer)) == 0);
+  jerry_release_value (empty);
+
+  jerry_release_value (values[0]);
+  jerry_release_value (values[1]);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
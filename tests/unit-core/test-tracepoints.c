@@ -0,0 +1,218 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/*
+ * The test reads its own executable and checks that the SDT notes of the
+ * tracepoints are present, since this is what the tracers look for. Only
+ * the notes of the linked objects are present, so the test executes a
+ * snapshot to link the snapshot tracepoint as well.
+ */
+
+/**
+ * Maximum size of the .note.stapsdt section.
+ */
+#define MAX_NOTES_SIZE (64 * 1024)
+
+static uint8_t notes[MAX_NOTES_SIZE];
+static size_t notes_size = 0;
+
+/**
+ * Read a little endian value from a buffer.
+ *
+ * @return value
+ */
+static uint64_t
+read_value (const uint8_t *buffer_p, /**< buffer */
+            size_t size) /**< size of the value */
+{
+  uint64_t value = 0;
+
+  while (size > 0)
+  {
+    size--;
+    value = (value << 8) | buffer_p[size];
+  }
+
+  return value;
+} /* read_value */
+
+/**
+ * Read a block of the file.
+ */
+static void
+read_block (FILE *file_p, /**< file */
+            uint64_t offset, /**< offset of the block */
+            uint8_t *buffer_p, /**< [out] buffer */
+            size_t size) /**< size of the block */
+{
+  TEST_ASSERT (fseek (file_p, (long) offset, SEEK_SET) == 0);
+  TEST_ASSERT (fread (buffer_p, 1, size, file_p) == size);
+} /* read_block */
+
+/**
+ * Load the .note.stapsdt section of the ELF64 executable.
+ */
+static void
+load_notes (const char *file_name_p) /**< executable */
+{
+  FILE *file_p = fopen (file_name_p, "rb");
+  TEST_ASSERT (file_p != NULL);
+
+  uint8_t header[64];
+  read_block (file_p, 0, header, sizeof (header));
+  TEST_ASSERT (header[0] == 0x7f && header[1] == 'E' && header[2] == 'L' && header[3] == 'F');
+  TEST_ASSERT (header[4] == 2 /* ELFCLASS64 */ && header[5] == 1 /* ELFDATA2LSB */);
+
+  uint64_t section_offset = read_value (header + 40, 8);
+  size_t section_entry_size = (size_t) read_value (header + 58, 2);
+  size_t section_count = (size_t) read_value (header + 60, 2);
+  size_t string_section_index = (size_t) read_value (header + 62, 2);
+
+  TEST_ASSERT (section_entry_size == 64);
+
+  uint8_t section[64];
+  read_block (file_p, section_offset + string_section_index * section_entry_size, section, sizeof (section));
+
+  uint64_t string_offset = read_value (section + 24, 8);
+
+  for (size_t i = 0; i < section_count; i++)
+  {
+    read_block (file_p, section_offset + i * section_entry_size, section, sizeof (section));
+
+    char name[sizeof (".note.stapsdt")];
+    read_block (file_p, string_offset + read_value (section, 4), (uint8_t *) name, sizeof (name));
+
+    if (memcmp (name, ".note.stapsdt", sizeof (name)) == 0)
+    {
+      notes_size = (size_t) read_value (section + 32, 8);
+      TEST_ASSERT (notes_size <= MAX_NOTES_SIZE);
+      read_block (file_p, read_value (section + 24, 8), notes, notes_size);
+      break;
+    }
+  }
+
+  fclose (file_p);
+} /* load_notes */
+
+/**
+ * Check whether a tracepoint of the engine is described by a note.
+ *
+ * @return true - if the note is found
+ *         false - otherwise
+ */
+static bool
+find_tracepoint (const char *name_p) /**< name of the tracepoint */
+{
+  size_t offset = 0;
+
+  while (offset + 12 <= notes_size)
+  {
+    size_t name_size = (size_t) read_value (notes + offset, 4);
+    size_t desc_size = (size_t) read_value (notes + offset + 4, 4);
+    uint32_t type = (uint32_t) read_value (notes + offset + 8, 4);
+    const uint8_t *desc_p = notes + offset + 12 + ((name_size + 3) & ~(size_t) 3);
+
+    /* The descriptor starts with three addresses: the location, the base and the semaphore. */
+    if (type == 3
+        && name_size == sizeof ("stapsdt")
+        && memcmp (notes + offset + 12, "stapsdt", name_size) == 0
+        && desc_size > 3 * 8 + sizeof ("jerry")
+        && memcmp (desc_p + 3 * 8, "jerry", sizeof ("jerry")) == 0
+        && strcmp ((const char *) desc_p + 3 * 8 + sizeof ("jerry"), name_p) == 0)
+    {
+      return true;
+    }
+
+    offset = (size_t) (desc_p - notes) + ((desc_size + 3) & ~(size_t) 3);
+  }
+
+  return false;
+} /* find_tracepoint */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_TRACEPOINTS))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Static tracepoints are disabled!\n");
+    jerry_cleanup ();
+    return 0;
+  }
+
+  /* Run some code which passes all the tracepoints. */
+  const char *source_p = "function f () { throw new TypeError () } try { f () } catch (e) {}";
+  jerry_value_t parsed_code_val = jerry_parse (NULL,
+                                               0,
+                                               (const jerry_char_t *) source_p,
+                                               strlen (source_p),
+                                               JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t res = jerry_run (parsed_code_val);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+
+  bool has_snapshot = (jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+                       && jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC));
+
+  if (has_snapshot)
+  {
+    static uint32_t snapshot_buffer[256];
+
+    res = jerry_generate_snapshot (NULL,
+                                   0,
+                                   (const jerry_char_t *) source_p,
+                                   strlen (source_p),
+                                   0,
+                                   snapshot_buffer,
+                                   sizeof (snapshot_buffer));
+    TEST_ASSERT (jerry_value_is_number (res));
+
+    size_t snapshot_size = (size_t) jerry_get_number_value (res);
+    jerry_release_value (res);
+
+    res = jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, 0);
+    TEST_ASSERT (!jerry_value_is_error (res));
+    jerry_release_value (res);
+  }
+
+  jerry_gc ();
+
+  load_notes ("/proc/self/exe");
+
+  TEST_ASSERT (find_tracepoint ("parse__begin"));
+  TEST_ASSERT (find_tracepoint ("parse__end"));
+  TEST_ASSERT (find_tracepoint ("function__entry"));
+  TEST_ASSERT (find_tracepoint ("function__exit"));
+  TEST_ASSERT (find_tracepoint ("exception__raise"));
+  TEST_ASSERT (find_tracepoint ("gc__begin"));
+  TEST_ASSERT (find_tracepoint ("gc__end"));
+  TEST_ASSERT (find_tracepoint ("heap__limit"));
+  TEST_ASSERT (find_tracepoint ("snapshot__load") == has_snapshot);
+  TEST_ASSERT (!find_tracepoint ("unknown"));
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,372 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "lit-char-helpers.h"
+#include "lit-strings.h"
+
+#include "test-common.h"
+
+/*
+ * The interval based tables below are generated by tools/gen-unicode.py from the same
+ * unicode data as the two-level tables of the engine. The reference functions search
+ * these tables, and their results are compared to the engine for every code unit.
+ */
+#include "test-unicode-ranges.inc.h"
+
+#ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
+#include "test-unicode-conversions.inc.h"
+#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
+
+#define NUM_OF_ELEMENTS(array) (sizeof (array) / sizeof ((array)[0]))
+
+/**
+ * Search a character in a sorted character array.
+ *
+ * @return true - if the character is in the array
+ *         false - otherwise
+ */
+static bool
+reference_search_char (ecma_char_t c, /**< code unit */
+                       const uint16_t *array_p, /**< array */
+                       size_t size) /**< length of the array */
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (array_p[i] == c)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* reference_search_char */
+
+/**
+ * Search a character in intervals specified by their starting points and (inclusive) lengths.
+ *
+ * @return true - if the character is in one of the intervals
+ *         false - otherwise
+ */
+static bool
+reference_search_interval (ecma_char_t c, /**< code unit */
+                           const uint16_t *starting_points_p, /**< interval starting points */
+                           const uint8_t *lengths_p, /**< interval lengths */
+                           size_t size) /**< number of intervals */
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (starting_points_p[i] <= c && c <= starting_points_p[i] + lengths_p[i])
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* reference_search_interval */
+
+/**
+ * Reference implementation of lit_char_is_white_space.
+ *
+ * @return true - if the character is a white space
+ *         false - otherwise
+ */
+static bool
+reference_is_white_space (ecma_char_t c) /**< code unit */
+{
+  if (c <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    return (c == LIT_CHAR_TAB || c == LIT_CHAR_VTAB || c == LIT_CHAR_FF || c == LIT_CHAR_SP);
+  }
+
+  return (c == LIT_CHAR_NBSP
+          || c == LIT_CHAR_BOM
+          || reference_search_interval (c,
+                                        lit_unicode_separator_char_interval_sps,
+                                        lit_unicode_separator_char_interval_lengths,
+                                        NUM_OF_ELEMENTS (lit_unicode_separator_char_interval_sps))
+          || reference_search_char (c, lit_unicode_separator_chars, NUM_OF_ELEMENTS (lit_unicode_separator_chars)));
+} /* reference_is_white_space */
+
+/**
+ * Reference check for unicode letters.
+ *
+ * @return true - if the character is a unicode letter
+ *         false - otherwise
+ */
+static bool
+reference_is_unicode_letter (ecma_char_t c) /**< code unit */
+{
+  return (reference_search_interval (c,
+                                     lit_unicode_letter_interval_sps,
+                                     lit_unicode_letter_interval_lengths,
+                                     NUM_OF_ELEMENTS (lit_unicode_letter_interval_sps))
+          || reference_search_char (c, lit_unicode_letter_chars, NUM_OF_ELEMENTS (lit_unicode_letter_chars)));
+} /* reference_is_unicode_letter */
+
+/**
+ * Reference check for non-letter identifier parts.
+ *
+ * @return true - if the character is a non-letter identifier part
+ *         false - otherwise
+ */
+static bool
+reference_is_unicode_non_letter_ident_part (ecma_char_t c) /**< code unit */
+{
+  return (reference_search_interval (c,
+                                     lit_unicode_non_letter_ident_part_interval_sps,
+                                     lit_unicode_non_letter_ident_part_interval_lengths,
+                                     NUM_OF_ELEMENTS (lit_unicode_non_letter_ident_part_interval_sps))
+          || reference_search_char (c,
+                                    lit_unicode_non_letter_ident_part_chars,
+                                    NUM_OF_ELEMENTS (lit_unicode_non_letter_ident_part_chars)));
+} /* reference_is_unicode_non_letter_ident_part */
+
+#ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
+
+/**
+ * Search a character in the bidirectional conversion tables.
+ *
+ * @return the length of the converted character sequence - if the character is found
+ *         0 - otherwise
+ */
+static ecma_length_t
+reference_search_bidirectional_conversions (ecma_char_t c, /**< code unit */
+                                            ecma_char_t *output_buffer_p, /**< [out] result characters */
+                                            bool is_lowercase) /**< lowercase conversion */
+{
+  for (size_t i = 0; i < NUM_OF_ELEMENTS (lit_character_case_ranges); i++)
+  {
+    ecma_char_t start_point = lit_character_case_ranges[i];
+    int range_length = lit_character_case_range_lengths[i / 2];
+
+    if (start_point <= c && c < start_point + range_length)
+    {
+      int distance = c - start_point;
+
+      if (i % 2 == 0)
+      {
+        output_buffer_p[0] = is_lowercase ? (ecma_char_t) (lit_character_case_ranges[i + 1] + distance) : c;
+      }
+      else
+      {
+        output_buffer_p[0] = is_lowercase ? c : (ecma_char_t) (lit_character_case_ranges[i - 1] + distance);
+      }
+
+      return 1;
+    }
+  }
+
+  for (size_t i = 0; i < NUM_OF_ELEMENTS (lit_character_pair_ranges); i++)
+  {
+    ecma_char_t start_point = lit_character_pair_ranges[i];
+
+    if (start_point <= c && c < start_point + lit_character_pair_range_lengths[i])
+    {
+      if ((c - start_point) % 2 == 0)
+      {
+        output_buffer_p[0] = is_lowercase ? (ecma_char_t) (c + 1) : c;
+      }
+      else
+      {
+        output_buffer_p[0] = is_lowercase ? c : (ecma_char_t) (c - 1);
+      }
+
+      return 1;
+    }
+  }
+
+  for (size_t i = 0; i < NUM_OF_ELEMENTS (lit_character_pairs); i++)
+  {
+    if (lit_character_pairs[i] == c)
+    {
+      if (i % 2 == 0)
+      {
+        output_buffer_p[0] = is_lowercase ? lit_character_pairs[i + 1] : c;
+      }
+      else
+      {
+        output_buffer_p[0] = is_lowercase ? c : lit_character_pairs[i - 1];
+      }
+
+      return 1;
+    }
+  }
+
+  return 0;
+} /* reference_search_bidirectional_conversions */
+
+/**
+ * Search a character in the one-to-one, one-to-two and one-to-three conversion tables.
+ *
+ * @return the length of the converted character sequence - if the character is found
+ *         0 - otherwise
+ */
+static ecma_length_t
+reference_search_conversions (ecma_char_t c, /**< code unit */
+                              ecma_char_t *output_buffer_p, /**< [out] result characters */
+                              const uint16_t *array_p, /**< conversion table */
+                              const uint8_t *counters_p) /**< number of conversions of each length */
+{
+  for (ecma_length_t length = 1; length <= LIT_MAXIMUM_OTHER_CASE_LENGTH; length++)
+  {
+    for (uint32_t i = 0; i < counters_p[length - 1]; i++)
+    {
+      if (array_p[0] == c)
+      {
+        memcpy (output_buffer_p, array_p + 1, length * sizeof (ecma_char_t));
+        return length;
+      }
+
+      array_p += length + 1;
+    }
+  }
+
+  return 0;
+} /* reference_search_conversions */
+
+/**
+ * Reference implementation of lit_char_to_lower_case.
+ *
+ * @return the length of the lowercase character sequence
+ */
+static ecma_length_t
+reference_to_lower_case (ecma_char_t c, /**< code unit */
+                         ecma_char_t *output_buffer_p) /**< [out] result characters */
+{
+  if (c >= LIT_CHAR_UPPERCASE_A && c <= LIT_CHAR_UPPERCASE_Z)
+  {
+    output_buffer_p[0] = (ecma_char_t) (c + (LIT_CHAR_LOWERCASE_A - LIT_CHAR_UPPERCASE_A));
+    return 1;
+  }
+
+  ecma_length_t length = reference_search_bidirectional_conversions (c, output_buffer_p, true);
+
+  if (length != 0)
+  {
+    return length;
+  }
+
+  for (size_t i = 0; i < NUM_OF_ELEMENTS (lit_lower_case_ranges); i += 2)
+  {
+    ecma_char_t start_point = lit_lower_case_ranges[i];
+
+    if (start_point <= c && c < start_point + lit_lower_case_range_lengths[i / 2])
+    {
+      output_buffer_p[0] = (ecma_char_t) (lit_lower_case_ranges[i + 1] + (c - start_point));
+      return 1;
+    }
+  }
+
+  length = reference_search_conversions (c,
+                                         output_buffer_p,
+                                         lit_lower_case_conversions,
+                                         lit_lower_case_conversion_counters);
+
+  if (length != 0)
+  {
+    return length;
+  }
+
+  output_buffer_p[0] = c;
+  return 1;
+} /* reference_to_lower_case */
+
+/**
+ * Reference implementation of lit_char_to_upper_case.
+ *
+ * @return the length of the uppercase character sequence
+ */
+static ecma_length_t
+reference_to_upper_case (ecma_char_t c, /**< code unit */
+                         ecma_char_t *output_buffer_p) /**< [out] result characters */
+{
+  if (c >= LIT_CHAR_LOWERCASE_A && c <= LIT_CHAR_LOWERCASE_Z)
+  {
+    output_buffer_p[0] = (ecma_char_t) (c - (LIT_CHAR_LOWERCASE_A - LIT_CHAR_UPPERCASE_A));
+    return 1;
+  }
+
+  ecma_length_t length = reference_search_bidirectional_conversions (c, output_buffer_p, false);
+
+  if (length != 0)
+  {
+    return length;
+  }
+
+  for (size_t i = 0; i < NUM_OF_ELEMENTS (lit_upper_case_special_ranges); i += 3)
+  {
+    ecma_char_t start_point = lit_upper_case_special_ranges[i];
+
+    if (start_point <= c && c <= start_point + lit_upper_case_special_range_lengths[i / 3])
+    {
+      output_buffer_p[0] = (ecma_char_t) (lit_upper_case_special_ranges[i + 1] + (c - start_point));
+      output_buffer_p[1] = lit_upper_case_special_ranges[i + 2];
+      return 2;
+    }
+  }
+
+  length = reference_search_conversions (c,
+                                         output_buffer_p,
+                                         lit_upper_case_conversions,
+                                         lit_upper_case_conversion_counters);
+
+  if (length != 0)
+  {
+    return length;
+  }
+
+  output_buffer_p[0] = c;
+  return 1;
+} /* reference_to_upper_case */
+
+#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  for (uint32_t i = 0; i <= UINT16_MAX; i++)
+  {
+    ecma_char_t c = (ecma_char_t) i;
+
+    TEST_ASSERT (lit_char_is_white_space (c) == reference_is_white_space (c));
+
+    bool is_start = lit_char_is_identifier_start_character (c);
+    bool is_part = lit_char_is_identifier_part_character (c);
+
+    if (c > LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+    {
+      TEST_ASSERT (is_start == reference_is_unicode_letter (c));
+      TEST_ASSERT (is_part == (reference_is_unicode_letter (c) || reference_is_unicode_non_letter_ident_part (c)));
+    }
+
+#ifndef CONFIG_DISABLE_UNICODE_CASE_CONVERSION
+    ecma_char_t result[LIT_MAXIMUM_OTHER_CASE_LENGTH];
+    ecma_char_t expected[LIT_MAXIMUM_OTHER_CASE_LENGTH];
+
+    ecma_length_t length = lit_char_to_lower_case (c, result, LIT_MAXIMUM_OTHER_CASE_LENGTH);
+    TEST_ASSERT (length == reference_to_lower_case (c, expected));
+    TEST_ASSERT (memcmp (result, expected, length * sizeof (ecma_char_t)) == 0);
+
+    length = lit_char_to_upper_case (c, result, LIT_MAXIMUM_OTHER_CASE_LENGTH);
+    TEST_ASSERT (length == reference_to_upper_case (c, expected));
+    TEST_ASSERT (memcmp (result, expected, length * sizeof (ecma_char_t)) == 0);
+#endif /* !CONFIG_DISABLE_UNICODE_CASE_CONVERSION */
+  }
+
+  return 0;
+} /* main */
@@ -0,0 +1,168 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static int cleared_count;
+static int cleared_id;
+
+static void
+weak_ref_cleared (void *user_p) /**< user pointer */
+{
+  cleared_count++;
+  cleared_id = *(int *) user_p;
+} /* weak_ref_cleared */
+
+static jerry_weak_ref_t *self_freeing_ref_p;
+
+static void
+weak_ref_free_self (void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == &self_freeing_ref_p);
+  jerry_free_weak_ref (self_freeing_ref_p);
+  self_freeing_ref_p = NULL;
+} /* weak_ref_free_self */
+
+static jerry_weak_ref_t *sibling_ref_p[3];
+
+static void
+weak_ref_free_siblings (void *user_p) /**< user pointer */
+{
+  JERRY_UNUSED (user_p);
+
+  for (int i = 0; i < 3; i++)
+  {
+    TEST_ASSERT (sibling_ref_p[i] != NULL);
+
+    jerry_value_t value = jerry_get_weak_ref_value (sibling_ref_p[i]);
+    TEST_ASSERT (jerry_value_is_undefined (value));
+
+    jerry_free_weak_ref (sibling_ref_p[i]);
+    sibling_ref_p[i] = NULL;
+  }
+} /* weak_ref_free_siblings */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  static int ids[3] = { 1, 2, 3 };
+
+  jerry_value_t number = jerry_create_number (1);
+  TEST_ASSERT (jerry_create_weak_ref (number, NULL, NULL) == NULL);
+  jerry_release_value (number);
+
+  /* A weak reference does not keep the object alive. */
+  jerry_value_t object = jerry_create_object ();
+  jerry_weak_ref_t *weak_ref_p = jerry_create_weak_ref (object, weak_ref_cleared, &ids[0]);
+  TEST_ASSERT (weak_ref_p != NULL);
+
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 0);
+
+  jerry_value_t value = jerry_get_weak_ref_value (weak_ref_p);
+  TEST_ASSERT (jerry_value_is_object (value));
+  TEST_ASSERT (value == object);
+  jerry_release_value (value);
+
+  jerry_release_value (object);
+  jerry_gc ();
+
+  TEST_ASSERT (cleared_count == 1);
+  TEST_ASSERT (cleared_id == 1);
+
+  value = jerry_get_weak_ref_value (weak_ref_p);
+  TEST_ASSERT (jerry_value_is_undefined (value));
+
+  jerry_free_weak_ref (weak_ref_p);
+
+  /* Objects reachable from the global object stay alive. */
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "cached");
+  object = jerry_create_object ();
+  jerry_release_value (jerry_set_property (global, name, object));
+
+  weak_ref_p = jerry_create_weak_ref (object, weak_ref_cleared, &ids[1]);
+  jerry_release_value (object);
+
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 1);
+
+  value = jerry_get_weak_ref_value (weak_ref_p);
+  TEST_ASSERT (jerry_value_is_object (value));
+  jerry_release_value (value);
+
+  TEST_ASSERT (jerry_delete_property (global, name));
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 2);
+  TEST_ASSERT (cleared_id == 2);
+
+  jerry_release_value (name);
+  jerry_release_value (global);
+  jerry_free_weak_ref (weak_ref_p);
+
+  /* A freed weak reference does not call its callback. */
+  object = jerry_create_object ();
+  weak_ref_p = jerry_create_weak_ref (object, weak_ref_cleared, &ids[2]);
+  jerry_free_weak_ref (weak_ref_p);
+  jerry_release_value (object);
+  jerry_gc ();
+  TEST_ASSERT (cleared_count == 2);
+
+  /* The callback may free its own weak reference. */
+  object = jerry_create_object ();
+  self_freeing_ref_p = jerry_create_weak_ref (object, weak_ref_free_self, &self_freeing_ref_p);
+  jerry_weak_ref_t *other_ref_p = jerry_create_weak_ref (object, NULL, NULL);
+  jerry_release_value (object);
+  jerry_gc ();
+  TEST_ASSERT (self_freeing_ref_p == NULL);
+
+  value = jerry_get_weak_ref_value (other_ref_p);
+  TEST_ASSERT (jerry_value_is_undefined (value));
+  jerry_free_weak_ref (other_ref_p);
+
+  /* The callback may free the other weak references, whose objects are already cleared. */
+  object = jerry_create_object ();
+  sibling_ref_p[0] = jerry_create_weak_ref (object, weak_ref_cleared, &ids[0]);
+  jerry_value_t other_object = jerry_create_object ();
+  sibling_ref_p[1] = jerry_create_weak_ref (other_object, weak_ref_cleared, &ids[1]);
+  jerry_weak_ref_t *freeing_ref_p = jerry_create_weak_ref (object, weak_ref_free_siblings, NULL);
+  sibling_ref_p[2] = jerry_create_weak_ref (object, weak_ref_cleared, &ids[2]);
+  jerry_release_value (object);
+  jerry_release_value (other_object);
+
+  cleared_count = 0;
+  jerry_gc ();
+
+  TEST_ASSERT (sibling_ref_p[0] == NULL && sibling_ref_p[1] == NULL && sibling_ref_p[2] == NULL);
+  TEST_ASSERT (cleared_count <= 2);
+  jerry_free_weak_ref (freeing_ref_p);
+  cleared_count = 2;
+
+  /* Weak references which are not freed by the application are freed by jerry_cleanup. */
+  object = jerry_create_object ();
+  jerry_create_weak_ref (object, weak_ref_cleared, &ids[2]);
+  jerry_release_value (object);
+
+  jerry_cleanup ();
+  TEST_ASSERT (cleared_count == 3);
+  TEST_ASSERT (cleared_id == 3);
+
+  return 0;
+} /* main */
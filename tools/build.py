@@ -51,6 +51,8 @@ def get_arguments():
     parser = argparse.ArgumentParser(parents=[devhelp_preparser])
     parser.add_argument('--all-in-one', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
                         help='all-in-one build (%(choices)s; default: %(default)s)')
+    parser.add_argument('--arraybuffer-port-alloc', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
+                        help='allocate large ArrayBuffers with the port allocator (%(choices)s; default: %(default)s)')
     parser.add_argument('--builddir', metavar='DIR', action='store', default=BUILD_DIR,
                         help='specify output directory (default: %(default)s)')
     parser.add_argument('--clean', action='store_true', default=False, help='clean build')
@@ -68,6 +70,9 @@ def get_arguments():
                         help='enable error messages (%(choices)s; default: %(default)s)')
     parser.add_argument('--external-context', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
                         help='enable external context (%(choices)s; default: %(default)s)')
+    parser.add_argument('--external-context-tls', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
+                        help='read the current instance of the external context from a thread local variable '
+                             '(%(choices)s; default: %(default)s)')
     parser.add_argument('-j', '--jobs', metavar='N', action='store', type=int, default=multiprocessing.cpu_count() + 1,
                         help='Allowed N build jobs at once (default: %(default)s)')
     parser.add_argument('--jerry-cmdline', metavar='X', choices=['ON', 'OFF'], default='ON', type=str.upper,
@@ -84,6 +89,8 @@ def get_arguments():
                         help='build and use jerry-libm (%(choices)s; default: %(default)s)')
     parser.add_argument('--jerry-port-default', metavar='X', choices=['ON', 'OFF'], default='ON', type=str.upper,
                         help='build default jerry port implementation (%(choices)s; default: %(default)s)')
+    parser.add_argument('--jit', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
+                        help='enable the baseline JIT compiler on x86-64 (%(choices)s; default: %(default)s)')
     parser.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], default='ON', type=str.upper,
                         help='enable js-parser (%(choices)s; default: %(default)s)')
     parser.add_argument('--line-info', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
@@ -98,6 +105,8 @@ def get_arguments():
                         help='size of memory heap, in kilobytes (default: %(default)s)')
     parser.add_argument('--profile', metavar='FILE', action='store', default=DEFAULT_PROFILE,
                         help='specify profile file (default: %(default)s)')
+    parser.add_argument('--quotas', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
+                        help='enable execution and memory quotas (%(choices)s; default: %(default)s)')
     parser.add_argument('--snapshot-exec', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
                         help='enable executing snapshot files (%(choices)s; default: %(default)s)')
     parser.add_argument('--snapshot-save', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
@@ -108,6 +117,8 @@ def get_arguments():
                         help='enable static linking of binaries (%(choices)s; default: %(default)s)')
     parser.add_argument('--strip', metavar='X', choices=['ON', 'OFF'], default='ON', type=str.upper,
                         help='strip release binaries (%(choices)s; default: %(default)s)')
+    parser.add_argument('--tracepoints', metavar='X', choices=['ON', 'OFF'], default='OFF', type=str.upper,
+                        help='enable static tracepoints (%(choices)s; default: %(default)s)')
     parser.add_argument('--toolchain', metavar='FILE', action='store', default=default_toolchain(),
                         help='add toolchain file (default: %(default)s)')
     parser.add_argument('--unittests', action='store_const', const='ON', default='OFF',
@@ -150,6 +161,7 @@ def generate_build_options(arguments):
     build_options = []
 
     build_options.append('-DENABLE_ALL_IN_ONE=%s' % arguments.all_in_one)
+    build_options.append('-DFEATURE_ARRAYBUFFER_PORT_ALLOC=%s' % arguments.arraybuffer_port_alloc)
     build_options.append('-DCMAKE_BUILD_TYPE=%s' % arguments.build_type)
     build_options.append('-DEXTERNAL_COMPILE_FLAGS=' + ' '.join(arguments.compile_flag))
     build_options.append('-DFEATURE_CPOINTER_32_BIT=%s' % arguments.cpointer_32bit)
@@ -162,6 +174,7 @@ def generate_build_options(arguments):
     build_options.append('-DJERRY_EXT=%s' % arguments.jerry_ext)
     build_options.append('-DJERRY_LIBC=%s' % arguments.jerry_libc)
     build_options.append('-DJERRY_LIBM=%s' % arguments.jerry_libm)
+    build_options.append('-DFEATURE_JIT=%s' % arguments.jit)
     build_options.append('-DFEATURE_JS_PARSER=%s' % arguments.js_parser)
     build_options.append('-DEXTERNAL_LINK_LIBS=' + ' '.join(arguments.link_lib))
     build_options.append('-DEXTERNAL_LINKER_FLAGS=' + ' '.join(arguments.linker_flag))
@@ -169,13 +182,16 @@ def generate_build_options(arguments):
     build_options.append('-DMEM_HEAP_SIZE_KB=%d' % arguments.mem_heap)
 
     build_options.append('-DFEATURE_PROFILE=%s' % arguments.profile)
+    build_options.append('-DFEATURE_QUOTAS=%s' % arguments.quotas)
     build_options.append('-DFEATURE_DEBUGGER=%s' % arguments.jerry_debugger)
     build_options.append('-DFEATURE_EXTERNAL_CONTEXT=%s' % arguments.external_context)
+    build_options.append('-DFEATURE_EXTERNAL_CONTEXT_TLS=%s' % arguments.external_context_tls)
     build_options.append('-DFEATURE_SNAPSHOT_EXEC=%s' % arguments.snapshot_exec)
     build_options.append('-DFEATURE_SNAPSHOT_SAVE=%s' % arguments.snapshot_save)
     build_options.append('-DFEATURE_SYSTEM_ALLOCATOR=%s' % arguments.system_allocator)
     build_options.append('-DENABLE_STATIC_LINK=%s' % arguments.static_link)
     build_options.append('-DENABLE_STRIP=%s' % arguments.strip)
+    build_options.append('-DFEATURE_TRACEPOINTS=%s' % arguments.tracepoints)
     build_options.append('-DFEATURE_VM_EXEC_STOP=%s' % arguments.vm_exec_stop)
 
     if arguments.toolchain:
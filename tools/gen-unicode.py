@@ -30,6 +30,30 @@ from settings import PROJECT_DIR
 RANGES_C_SOURCE = os.path.join(PROJECT_DIR, 'jerry-core/lit/lit-unicode-ranges.inc.h')
 CONVERSIONS_C_SOURCE = os.path.join(PROJECT_DIR, 'jerry-core/lit/lit-unicode-conversions.inc.h')
 
+# The interval based tables are only used as a reference by the unit tests
+RANGES_REFERENCE_C_SOURCE = os.path.join(PROJECT_DIR, 'tests/unit-core/test-unicode-ranges.inc.h')
+CONVERSIONS_REFERENCE_C_SOURCE = os.path.join(PROJECT_DIR, 'tests/unit-core/test-unicode-conversions.inc.h')
+
+# Number of code units covered by the two-level tables (the basic multilingual plane)
+CODE_UNIT_COUNT = 0x10000
+
+# Supported range of the --block-bits option
+MIN_BLOCK_BITS = 2
+MAX_BLOCK_BITS = 10
+
+# Unicode character classes (must be kept in sync with the lit_char_get_unicode_class function)
+UNICODE_CLASS_NONE = 0
+UNICODE_CLASS_LETTER = 1
+UNICODE_CLASS_NON_LETTER_IDENT_PART = 2
+UNICODE_CLASS_SEPARATOR = 3
+
+# Number of bits used by a character class, and the number of classes packed into a byte
+UNICODE_CLASS_BITS = 2
+UNICODE_CLASSES_PER_BYTE = 4
+
+# Must be the same as LIT_MAXIMUM_OTHER_CASE_LENGTH in lit-char-helpers.h
+MAXIMUM_OTHER_CASE_LENGTH = 3
+
 
 # common code generation
 
@@ -44,11 +68,16 @@ class UniCodeSource(object):
         self.__header.append(completion)
         self.__header.append("")  # for an extra empty line
 
-    def add_table(self, table, table_name, table_type, table_descr):
+    def add_define(self, define_name, value, define_descr):
+        self.__data.append(define_descr)
+        self.__data.append("#define LIT_%s %s" % (define_name, value))
+        self.__data.append("")  # for an extra empty line
+
+    def add_table(self, table, table_name, table_type, table_descr, digit_number=4):
         self.__data.append(table_descr)
         self.__data.append("static const %s lit_%s[] JERRY_CONST_DATA =" % (table_type, table_name))
         self.__data.append("{")
-        self.__data.append(format_code(table, 1))
+        self.__data.append(format_code(table, 1, digit_number))
         self.__data.append("};")
         self.__data.append("")  # for an extra empty line
 
@@ -58,6 +87,299 @@ class UniCodeSource(object):
             generated_source.write("\n".join(self.__data))
 
 
+# functions for two-level tables
+
+
+def split_blocks(values, block_bits):
+    """
+    Split the per code unit values into blocks of 2^block_bits values and merge the identical blocks.
+
+    :param values: List of values, one for each code unit.
+    :param block_bits: Number of low bits of a code unit which select the value in a block.
+    :return: List of block indices (one for each page), and the list of distinct blocks.
+    """
+
+    block_size = 1 << block_bits
+    pages = []
+    blocks = []
+    block_indices = {}
+
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+
+        if block not in block_indices:
+            block_indices[block] = len(blocks)
+            blocks.append(block)
+
+        pages.append(block_indices[block])
+
+    return pages, blocks
+
+
+def get_table_type(max_value):
+    """
+    Get the smallest C type which can represent all values of a table.
+
+    :return: C type name and the number of bytes used by a value.
+    """
+
+    if max_value <= 0xff:
+        return "uint8_t", 1
+
+    return "uint16_t", 2
+
+
+def get_two_level_table_size(values, block_bits, value_bits):
+    """
+    Calculate the size of a two-level table in bytes.
+
+    :param values: List of values, one for each code unit.
+    :param block_bits: Number of low bits of a code unit which select the value in a block.
+    :param value_bits: Number of bits used by a value in a block.
+    :return: The total size of the page and the block tables.
+    """
+
+    pages, blocks = split_blocks(values, block_bits)
+    page_size = get_table_type(len(blocks) - 1)[1]
+
+    return len(pages) * page_size + (len(blocks) << block_bits) * value_bits // 8
+
+
+def select_block_bits(values, value_bits, block_bits):
+    """
+    Select the block size of a two-level table.
+
+    Each lookup reads one page and one block entry regardless of the block size, so the block
+    size only affects the size of the tables: small blocks are merged more often, but they need
+    a longer page table. Unless a block size is specified, the one with the smallest tables is used.
+
+    :return: Number of low bits of a code unit which select the value in a block.
+    """
+
+    if block_bits is not None:
+        return block_bits
+
+    return min(range(MIN_BLOCK_BITS, MAX_BLOCK_BITS + 1),
+               key=lambda bits: get_two_level_table_size(values, bits, value_bits))
+
+
+def add_two_level_table(c_source, values, value_bits, block_bits, table_name, table_descr, block_descr=""):
+    """
+    Add the page and the block tables of a two-level table to the generated source.
+
+    The value of a code unit is stored in the
+      blocks[(pages[code_unit >> BLOCK_BITS] << BLOCK_BITS) | (code_unit & ((1 << BLOCK_BITS) - 1))]
+    entry. When value_bits is less than 8, more values are packed into a byte starting from the lowest bits.
+    """
+
+    pages, blocks = split_blocks(values, block_bits)
+
+    define_name = "%s_BLOCK_BITS" % table_name.upper()
+    c_source.add_define(define_name, block_bits,
+                        "/**\n"
+                        " * Number of low bits of a code unit which select its entry in a block of\n"
+                        " * the lit_%s_blocks table.\n"
+                        " */" % table_name)
+
+    page_type, page_size = get_table_type(len(blocks) - 1)
+    c_source.add_table(pages,
+                       "%s_pages" % table_name,
+                       page_type,
+                       ("/**\n"
+                        " * Block indices of the pages of %s.\n"
+                        " */" % table_descr),
+                       page_size * 2)
+
+    values_per_byte = 8 // value_bits if value_bits < 8 else 1
+    block_values = []
+
+    for block in blocks:
+        if values_per_byte == 1:
+            block_values.extend(block)
+            continue
+
+        for start in range(0, len(block), values_per_byte):
+            packed_value = 0
+
+            for idx, value in enumerate(block[start:start + values_per_byte]):
+                packed_value |= value << (idx * value_bits)
+
+            block_values.append(packed_value)
+
+    block_type, block_size = get_table_type(max(block_values))
+    c_source.add_table(block_values,
+                       "%s_blocks" % table_name,
+                       block_type,
+                       ("/**\n"
+                        " * Distinct blocks of %s.%s\n"
+                        " */" % (table_descr, block_descr)),
+                       block_size * 2)
+
+
+def get_unicode_classes(letters, non_letters, separators):
+    """
+    Create the unicode character class list of the code units.
+
+    :return: List of unicode character classes, one for each code unit.
+    """
+
+    classes = [UNICODE_CLASS_NONE] * CODE_UNIT_COUNT
+
+    for letter in letters:
+        classes[letter] = UNICODE_CLASS_LETTER
+
+    for non_letter in non_letters:
+        classes[non_letter] = UNICODE_CLASS_NON_LETTER_IDENT_PART
+
+    for separator in separators:
+        classes[separator] = UNICODE_CLASS_SEPARATOR
+
+    return classes
+
+
+def encode_case_mapping(letter_id, letter_case):
+    """
+    Encode the case mapping of a code unit. The first character is stored as a (16 bit)
+    distance from the code unit, the other characters are stored unchanged.
+
+    :return: Tuple of the distance and the remaining characters.
+    """
+
+    if letter_id not in letter_case:
+        return (0,)
+
+    mapped_value = [ord(char) for char in letter_case[letter_id]]
+
+    return ((mapped_value[0] - letter_id) & 0xffff,) + tuple(mapped_value[1:])
+
+
+def get_case_conversions(lower_case, upper_case):
+    """
+    Collect the distinct lower and upper case mappings of the code units. One-to-one mappings
+    are stored before the mappings which contain a character sequence.
+
+    :return: List of conversion indices (one for each code unit), the list of distinct
+             conversions, and the index of the first conversion with a character sequence.
+    """
+
+    mappings = [(encode_case_mapping(letter_id, lower_case), encode_case_mapping(letter_id, upper_case))
+                for letter_id in range(CODE_UNIT_COUNT)]
+
+    single_conversions = []
+    sequence_conversions = []
+
+    for mapping in mappings:
+        if len(mapping[0]) == 1 and len(mapping[1]) == 1:
+            conversions = single_conversions
+        else:
+            conversions = sequence_conversions
+
+        if mapping not in conversions:
+            conversions.append(mapping)
+
+    conversions = single_conversions + sequence_conversions
+    conversion_indices = dict((mapping, idx) for idx, mapping in enumerate(conversions))
+
+    return [conversion_indices[mapping] for mapping in mappings], conversions, len(single_conversions)
+
+
+def generate_two_level_ranges(script_args, letters, non_letters, separators):
+    classes = get_unicode_classes(letters, non_letters, separators)
+    block_bits = select_block_bits(classes, UNICODE_CLASS_BITS, script_args.block_bits)
+
+    c_source = UniCodeSource(RANGES_C_SOURCE)
+
+    header_completion = ["/* This file is automatically generated by the %s script" % os.path.basename(__file__),
+                         " * from %s. Do not edit! */" % os.path.basename(script_args.unicode_data),
+                         ""]
+
+    c_source.complete_header("\n".join(header_completion))
+
+    c_source.add_define("UNICODE_CLASS_LETTER", UNICODE_CLASS_LETTER,
+                        ("/**\n"
+                         " * Unicode letters from the following Unicode categories: Lu, Ll, Lt, Lm, Lo, Nl\n"
+                         " */"))
+
+    c_source.add_define("UNICODE_CLASS_NON_LETTER_IDENT_PART", UNICODE_CLASS_NON_LETTER_IDENT_PART,
+                        ("/**\n"
+                         " * Non-letter characters that can be used as a non-first character of an identifier\n"
+                         " * from the following Unicode categories: Nd, Mn, Mc, Pc\n"
+                         " */"))
+
+    c_source.add_define("UNICODE_CLASS_SEPARATOR", UNICODE_CLASS_SEPARATOR,
+                        ("/**\n"
+                         " * Unicode separator characters from Unicode category: Zs\n"
+                         " */"))
+
+    add_two_level_table(c_source, classes, UNICODE_CLASS_BITS, block_bits, "unicode_class",
+                        "the unicode character class table",
+                        ("\n"
+                         " *\n"
+                         " * Each byte contains the classes of %d code units starting from the lowest bits."
+                         % UNICODE_CLASSES_PER_BYTE))
+
+    c_source.generate()
+
+
+def generate_two_level_conversions(script_args, lower_case, upper_case):
+    conversion_indices, conversions, sequence_start = get_case_conversions(lower_case, upper_case)
+    _, index_size = get_table_type(len(conversions) - 1)
+    block_bits = select_block_bits(conversion_indices, index_size * 8, script_args.block_bits)
+
+    sequences = []
+    for mapping in conversions[sequence_start:]:
+        for sequence in mapping:
+            padding = [0] * (MAXIMUM_OTHER_CASE_LENGTH - len(sequence))
+            sequences.extend(list(sequence[1:]) + padding)
+
+    c_source = UniCodeSource(CONVERSIONS_C_SOURCE)
+
+    unicode_file = os.path.basename(script_args.unicode_data)
+    spec_casing_file = os.path.basename(script_args.special_casing)
+
+    header_completion = ["/* This file is automatically generated by the %s script" % os.path.basename(__file__),
+                         " * from %s and %s files. Do not edit! */" % (unicode_file, spec_casing_file),
+                         ""]
+
+    c_source.complete_header("\n".join(header_completion))
+
+    add_two_level_table(c_source, conversion_indices, index_size * 8, block_bits, "unicode_case",
+                        "the case conversion table",
+                        ("\n"
+                         " *\n"
+                         " * Each entry is an index of the lit_unicode_lower_case_distances\n"
+                         " * and lit_unicode_upper_case_distances tables."))
+
+    c_source.add_table([mapping[0][0] for mapping in conversions],
+                       "unicode_lower_case_distances",
+                       "uint16_t",
+                       ("/**\n"
+                        " * Distance of the first lowercase character from the converted code unit (modulo 65536).\n"
+                        " */"))
+
+    c_source.add_table([mapping[1][0] for mapping in conversions],
+                       "unicode_upper_case_distances",
+                       "uint16_t",
+                       ("/**\n"
+                        " * Distance of the first uppercase character from the converted code unit (modulo 65536).\n"
+                        " */"))
+
+    c_source.add_define("UNICODE_CASE_SEQUENCE_START", sequence_start,
+                        ("/**\n"
+                         " * Index of the first case conversion which has a character sequence.\n"
+                         " */"))
+
+    c_source.add_table(sequences,
+                       "unicode_case_sequences",
+                       "uint16_t",
+                       ("/**\n"
+                        " * Remaining lowercase and uppercase characters of the case conversions\n"
+                        " * starting from LIT_UNICODE_CASE_SEQUENCE_START. Unused characters are zero.\n"
+                        " */"))
+
+    c_source.generate()
+
+
 # functions for unicode ranges
 
 
@@ -161,11 +483,13 @@ def split_list(category_list):
 def generate_ranges(script_args):
     letters, non_letters, separators = read_categories(script_args.unicode_data)
 
+    generate_two_level_ranges(script_args, letters, non_letters, separators)
+
     letter_tables = split_list(list(group_ranges(letters)))
     non_letter_tables = split_list(list(group_ranges(non_letters)))
     separator_tables = split_list(list(group_ranges(separators)))
 
-    c_source = UniCodeSource(RANGES_C_SOURCE)
+    c_source = UniCodeSource(RANGES_REFERENCE_C_SOURCE)
 
     header_completion = ["/* This file is automatically generated by the %s script" % os.path.basename(__file__),
                          " * from %s. Do not edit! */" % os.path.basename(script_args.unicode_data),
@@ -652,6 +976,8 @@ def generate_conversions(script_args):
     lower_case = case_mappings[0]
     upper_case = case_mappings[1]
 
+    generate_two_level_conversions(script_args, lower_case, upper_case)
+
     character_case_ranges = extract_ranges(lower_case, upper_case)
     character_pair_ranges = extract_character_pair_ranges(lower_case, upper_case)
     character_pairs = extract_character_pairs(lower_case, upper_case)
@@ -666,7 +992,7 @@ def generate_conversions(script_args):
         warnings.warn('Not all elements extracted from the uppercase table!')
 
     # Generate conversions output
-    c_source = UniCodeSource(CONVERSIONS_C_SOURCE)
+    c_source = UniCodeSource(CONVERSIONS_REFERENCE_C_SOURCE)
 
     unicode_file = os.path.basename(script_args.unicode_data)
     spec_casing_file = os.path.basename(script_args.special_casing)
@@ -766,9 +1092,15 @@ def main():
                         help='specify the unicode data file')
     parser.add_argument('--special-casing', metavar='FILE', action='store', required=True,
                         help='specify the special casing file')
+    parser.add_argument('--block-bits', metavar='N', action='store', type=int,
+                        help='specify the block size (2^N code units) of the two-level lookup tables '
+                        '(%d-%d, default: the block size with the smallest tables)' % (MIN_BLOCK_BITS, MAX_BLOCK_BITS))
 
     script_args = parser.parse_args()
 
+    if script_args.block_bits is not None and not MIN_BLOCK_BITS <= script_args.block_bits <= MAX_BLOCK_BITS:
+        parser.error('The block bits must be between %d and %d!' % (MIN_BLOCK_BITS, MAX_BLOCK_BITS))
+
     if not os.path.isfile(script_args.unicode_data) or not os.access(script_args.unicode_data, os.R_OK):
         parser.error('The %s file is missing or not readable!' % script_args.unicode_data)
 
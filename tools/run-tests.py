@@ -36,11 +36,11 @@ JERRY_UNITTESTS_OPTIONS = [
     Options('unittests',
             ['--unittests', '--profile=es2015-subset', '--jerry-cmdline=off', '--error-messages=on',
              '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on', '--vm-exec-stop=on',
-             '--mem-stats=on']),
+             '--quotas=on', '--mem-stats=on']),
     Options('unittests-debug',
             ['--unittests', '--debug', '--profile=es2015-subset', '--jerry-cmdline=off',
              '--error-messages=on', '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on',
-             '--vm-exec-stop=on', '--mem-stats=on']),
+             '--vm-exec-stop=on', '--quotas=on', '--mem-stats=on']),
     Options('doctests',
             ['--doctests', '--jerry-cmdline=off', '--error-messages=on', '--snapshot-save=on',
              '--snapshot-exec=on', '--vm-exec-stop=on', '--profile=es2015-subset']),
@@ -50,11 +50,19 @@ JERRY_UNITTESTS_OPTIONS = [
     Options('unittests-es5.1',
             ['--unittests', '--profile=es5.1', '--jerry-cmdline=off', '--error-messages=on',
              '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on', '--vm-exec-stop=on',
-             '--mem-stats=on']),
+             '--quotas=on', '--mem-stats=on']),
     Options('unittests-es5.1-debug',
             ['--unittests', '--debug', '--profile=es5.1', '--jerry-cmdline=off',
              '--error-messages=on', '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on',
-             '--vm-exec-stop=on', '--mem-stats=on']),
+             '--vm-exec-stop=on', '--quotas=on', '--mem-stats=on']),
+    Options('unittests-debug-cpointer_32bit',
+            ['--unittests', '--debug', '--profile=es2015-subset', '--jerry-cmdline=off',
+             '--error-messages=on', '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on',
+             '--vm-exec-stop=on', '--quotas=on', '--mem-stats=on', '--cpointer-32bit=on', '--mem-heap=8192']),
+    Options('unittests-debug-arraybuffer_port_alloc',
+            ['--unittests', '--debug', '--profile=es2015-subset', '--jerry-cmdline=off', '--jerry-libc=off',
+             '--error-messages=on', '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on',
+             '--vm-exec-stop=on', '--quotas=on', '--mem-stats=on', '--arraybuffer-port-alloc=on']),
     Options('doctests-es5.1',
             ['--doctests', '--jerry-cmdline=off', '--error-messages=on', '--snapshot-save=on',
              '--snapshot-exec=on', '--vm-exec-stop=on', '--profile=es5.1']),
@@ -81,7 +89,10 @@ JERRY_TESTS_OPTIONS = [
     Options('jerry_tests-es5.1-debug',
             ['--debug', '--profile=es5.1']),
     Options('jerry_tests-debug-external_context',
-            ['--debug', '--jerry-libc=off', '--external-context=on'])
+            ['--debug', '--jerry-libc=off', '--external-context=on']),
+    Options('jerry_tests-debug-jit',
+            ['--debug', '--profile=es2015-subset', '--jerry-libc=off', '--jit=on',
+             '--compile-flag=-DCONFIG_VM_JIT_THRESHOLD=0'])
 ]
 
 # Test options for jerry-test-suite
@@ -153,6 +164,14 @@ JERRY_BUILDOPTIONS = [
             ['--jerry-libc=off', '--compile-flag=-m32', '--cpointer-32bit=on', '--system-allocator=on']),
     Options('buildoption_test-external_context',
             ['--jerry-libc=off', '--external-context=on']),
+    Options('buildoption_test-external_context_tls',
+            ['--jerry-libc=off', '--external-context=on', '--external-context-tls=on']),
+    Options('buildoption_test-tracepoints',
+            ['--unittests', '--debug', '--profile=es2015-subset', '--jerry-libc=off', '--tracepoints=on',
+             '--error-messages=on', '--snapshot-save=on', '--snapshot-exec=on', '--line-info=on',
+             '--vm-exec-stop=on', '--quotas=on', '--mem-stats=on']),
+    Options('buildoption_test-jit',
+            ['--jerry-libc=off', '--jit=on']),
     Options('buildoption_test-cmdline_test',
             ['--jerry-cmdline-test=on']),
     Options('buildoption_test-cmdline_snapshot',
@@ -377,10 +396,19 @@ def run_unittests(options):
 
 def run_buildoption_test(options):
     for job in JERRY_BUILDOPTIONS:
-        ret, _ = create_binary(job, options)
+        ret, bin_dir_path = create_binary(job, options)
         if ret:
             break
 
+        if '--unittests' in job.build_args:
+            ret = run_check([
+                settings.UNITTEST_RUNNER_SCRIPT,
+                bin_dir_path,
+                "-q" if options.quiet else "",
+            ])
+            if ret:
+                break
+
     return ret
 
 Check = collections.namedtuple('Check', ['enabled', 'runner', 'arg'])